@@ -0,0 +1,404 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "batch.h"
+#include "grammar.h"
+#include "reader.h"
+#include "print.h"
+#include "ctx.h"
+#include "stats.h"
+
+// Input is read in blocks and cut into chunks at the end of a line where no
+// form is left open. The scan only counts parens and looks for characters
+// the grammar has no use for, which is enough to find every place where
+// the REPL would start afresh on the next line:
+//
+//  - a line that ends with the count back at zero (or below) ends a form,
+//    either because it closed every list or because it was an error
+//  - a line where the count drops below zero has a stray ')', and a line
+//    with a character that can never be part of a form is broken too, so
+//    either one ends a form whatever else is on it
+//
+// A line that is wrong in a subtler way, like "1." in the middle of an open
+// list, goes unnoticed here. That only means the chunk gets cut a little
+// later, the worker still sees the error and starts afresh where the REPL
+// would. A cut is never placed where the REPL would still be reading a form.
+
+enum { SCAN_OTHER, SCAN_OPEN, SCAN_CLOSE, SCAN_NEWLINE, SCAN_BAD };
+
+static unsigned char lispy_scan_class[256];
+
+static void lispy_scan_init(void)
+{
+    for (int c = 0; c < 256; c++)
+    {
+        lispy_scan_class[c] = strchr("0123456789.+-*/% \t\v\f\r", c) && c != '\0' ? SCAN_OTHER : SCAN_BAD;
+    }
+
+    lispy_scan_class['('] = SCAN_OPEN;
+    lispy_scan_class[')'] = SCAN_CLOSE;
+    lispy_scan_class['\n'] = SCAN_NEWLINE;
+}
+
+typedef struct lispy_source
+{
+    FILE* f;
+    int eof;
+
+    char* buf;
+    size_t len;
+    size_t slots;
+
+    size_t scanned;
+    size_t cut;
+    long depth;
+    int broken;
+} lispy_source;
+
+static void lispy_source_init(lispy_source* s, FILE* f)
+{
+    s->f = f;
+    s->eof = 0;
+    s->slots = LISPY_BATCH_CHUNK * 2;
+    s->buf = malloc(s->slots);
+    s->len = 0;
+    s->scanned = 0;
+    s->cut = 0;
+    s->depth = 0;
+    s->broken = 0;
+}
+
+static void lispy_source_free(lispy_source* s)
+{
+    free(s->buf);
+}
+
+static void lispy_source_scan(lispy_source* s)
+{
+    for (; s->scanned < s->len; s->scanned++)
+    {
+        switch (lispy_scan_class[(unsigned char)s->buf[s->scanned]])
+        {
+            case SCAN_OTHER: break;
+            case SCAN_OPEN: s->depth++; break;
+            case SCAN_CLOSE: if (--s->depth < 0) { s->broken = 1; } break;
+            case SCAN_BAD: s->broken = 1; break;
+            case SCAN_NEWLINE:
+                if (s->broken || s->depth <= 0)
+                {
+                    s->cut = s->scanned + 1;
+                    s->depth = 0;
+                    s->broken = 0;
+                }
+                break;
+        }
+    }
+}
+
+// Hands out the next chunk of input, NUL terminated, which the caller then
+// owns. At the end of the input whatever is left goes out as the last
+// chunk, complete or not. Returns 0 once there is nothing left.
+static int lispy_source_next(lispy_source* s, char** text, size_t* len)
+{
+    while (1)
+    {
+        lispy_source_scan(s);
+
+        if (s->cut >= LISPY_BATCH_CHUNK || (s->eof && s->len > 0))
+        {
+            size_t n = s->eof ? s->len : s->cut;
+            size_t rest = s->len - n;
+
+            *text = s->buf;
+            *len = n;
+
+            while (s->slots < rest + LISPY_BATCH_CHUNK + 1) { s->slots *= 2; }
+            s->buf = malloc(s->slots);
+            memcpy(s->buf, *text + n, rest);
+            (*text)[n] = '\0';
+
+            s->len = rest;
+            s->scanned -= n;
+            s->cut = 0;
+            return 1;
+        }
+
+        if (s->eof) { return 0; }
+
+        // always leave room for the terminator
+        if (s->slots - s->len < LISPY_BATCH_CHUNK + 1)
+        {
+            s->slots *= 2;
+            s->buf = realloc(s->buf, s->slots);
+        }
+
+        size_t got = fread(s->buf + s->len, 1, LISPY_BATCH_CHUNK, s->f);
+        if (got == 0) { s->eof = 1; }
+        s->len += got;
+    }
+}
+
+void lispy_batch_run(mpc_parser_t* Lispy, lval_reader* reader, lval_cache* cache, char* text, size_t len, lval_buf* out)
+{
+    char* end = text + len;
+    char* line = text;
+
+    while (line < end)
+    {
+        char* nl = memchr(line, '\n', end - line);
+        if (nl == NULL) { nl = end; }
+        *nl = '\0';
+
+        lval* val = lval_reader_read_line(reader, Lispy, cache, line, out);
+        if (val != NULL)
+        {
+            lval* result = lval_eval(val);
+            lval_buf_println(out, result);
+            lval_del(result);
+        }
+
+        line = nl + 1;
+    }
+
+    // chunks never end inside a form, only the end of the input can, so
+    // whatever is still open here is an error
+    if (lval_reader_finish(reader) == LVAL_READER_ERROR) { lval_buf_error(out, LERR_PARSE, reader->error); }
+    lval_reader_reset(reader);
+
+    lispy_stats_publish(lispy_ctx_get());
+}
+
+static int lispy_batch_serial(lispy_source* src, mpc_parser_t* Lispy, const char* filename, const lval_print_limits* limits, lval_format format)
+{
+    lval_reader reader;
+    lval_reader_init(&reader, filename);
+
+    lval_buf out;
+    lval_buf_init(&out, lval_file_sink, stdout);
+    out.limits = *limits;
+    out.format = format;
+
+    char* text;
+    size_t len;
+
+    while (lispy_source_next(src, &text, &len))
+    {
+        lispy_batch_run(Lispy, &reader, NULL, text, len, &out);
+        free(text);
+    }
+
+    int ok = lval_buf_flush(&out);
+    lval_buf_free(&out);
+    lval_reader_free(&reader);
+
+    return ok ? 0 : 1;
+}
+
+#ifndef _WIN32
+
+typedef struct lispy_chunk
+{
+    char* text;
+    size_t len;
+
+    lval_buf out;
+    int done;
+} lispy_chunk;
+
+// Chunks are numbered in the order they are read and live in a ring of
+// slots until they have been printed. The main thread only reads ahead as
+// far as the ring allows, which bounds the memory held by chunks that are
+// finished but still waiting for an earlier one.
+typedef struct lispy_batch_queue
+{
+    mpc_parser_t* Lispy;
+    const char* filename;
+    lval_print_limits limits;
+    lval_format format;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+
+    int slots;
+    lispy_chunk* chunks;
+    long queued;
+    long taken;
+    int closed;
+} lispy_batch_queue;
+
+static void* lispy_batch_worker(void* arg)
+{
+    lispy_batch_queue* q = arg;
+    lval_reader reader;
+    lval_reader_init(&reader, q->filename);
+
+    lispy_ctx ctx;
+    lispy_ctx_init(&ctx);
+    lispy_ctx_set(&ctx);
+
+    while (1)
+    {
+        pthread_mutex_lock(&q->lock);
+        while (q->taken == q->queued && !q->closed) { pthread_cond_wait(&q->work, &q->lock); }
+
+        if (q->taken == q->queued)
+        {
+            pthread_mutex_unlock(&q->lock);
+            break;
+        }
+
+        lispy_chunk* c = &q->chunks[q->taken++ % q->slots];
+        pthread_mutex_unlock(&q->lock);
+
+        lval_buf_init(&c->out, NULL, NULL);
+        c->out.limits = q->limits;
+        c->out.format = q->format;
+        lispy_batch_run(q->Lispy, &reader, NULL, c->text, c->len, &c->out);
+
+        free(c->text);
+        c->text = NULL;
+
+        pthread_mutex_lock(&q->lock);
+        c->done = 1;
+        pthread_cond_signal(&q->done);
+        pthread_mutex_unlock(&q->lock);
+    }
+
+    lval_reader_free(&reader);
+    lispy_ctx_set(NULL);
+    lispy_ctx_free(&ctx);
+
+    return NULL;
+}
+
+static int lispy_batch_parallel(lispy_source* src, mpc_parser_t* Lispy, const char* filename, int jobs, const lval_print_limits* limits, lval_format format)
+{
+    lispy_batch_queue q;
+    q.Lispy = Lispy;
+    q.filename = filename;
+    q.limits = *limits;
+    q.format = format;
+    pthread_mutex_init(&q.lock, NULL);
+    pthread_cond_init(&q.work, NULL);
+    pthread_cond_init(&q.done, NULL);
+    q.slots = jobs * LISPY_BATCH_WINDOW;
+    q.chunks = calloc(q.slots, sizeof(lispy_chunk));
+    q.queued = 0;
+    q.taken = 0;
+    q.closed = 0;
+
+    pthread_t* threads = malloc(sizeof(pthread_t) * jobs);
+    int started = 0;
+    while (started < jobs && pthread_create(&threads[started], NULL, lispy_batch_worker, &q) == 0)
+    {
+        started++;
+    }
+
+    int status = 0;
+
+    if (started == 0)
+    {
+        status = lispy_batch_serial(src, Lispy, filename, limits, format);
+    }
+    else
+    {
+        long printed = 0;
+        int more = 1;
+
+        while (1)
+        {
+            // keep every slot busy before waiting on the oldest chunk
+            while (more && q.queued - printed < q.slots)
+            {
+                char* text;
+                size_t len;
+                more = lispy_source_next(src, &text, &len);
+                if (!more) { break; }
+
+                lispy_chunk* c = &q.chunks[q.queued % q.slots];
+                c->text = text;
+                c->len = len;
+                c->done = 0;
+
+                pthread_mutex_lock(&q.lock);
+                q.queued++;
+                pthread_cond_signal(&q.work);
+                pthread_mutex_unlock(&q.lock);
+            }
+
+            if (printed == q.queued) { break; }
+
+            lispy_chunk* c = &q.chunks[printed % q.slots];
+            pthread_mutex_lock(&q.lock);
+            while (!c->done) { pthread_cond_wait(&q.done, &q.lock); }
+            pthread_mutex_unlock(&q.lock);
+
+            if (!lval_file_sink(stdout, c->out.data, c->out.len)) { status = 1; }
+            lval_buf_free(&c->out);
+            printed++;
+        }
+
+        pthread_mutex_lock(&q.lock);
+        q.closed = 1;
+        pthread_cond_broadcast(&q.work);
+        pthread_mutex_unlock(&q.lock);
+    }
+
+    for (int i = 0; i < started; i++) { pthread_join(threads[i], NULL); }
+
+    free(threads);
+    free(q.chunks);
+    pthread_cond_destroy(&q.done);
+    pthread_cond_destroy(&q.work);
+    pthread_mutex_destroy(&q.lock);
+
+    return status;
+}
+
+#endif
+
+int lispy_batch(const char* path, int jobs, const lval_print_limits* limits, lval_format format)
+{
+    FILE* f = path ? fopen(path, "rb") : stdin;
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    const char* filename = path ? path : "<stdin>";
+    lispy_scan_init();
+    lispy_source src;
+    lispy_source_init(&src, f);
+
+    // one parser for every worker, parsing never changes it
+    lispy_grammar* grammar = lispy_grammar_new();
+
+    int status;
+
+#ifdef _WIN32
+    // no threads here, work through the chunks one after the other
+    (void)jobs;
+    status = lispy_batch_serial(&src, grammar->Lispy, filename, limits, format);
+#else
+    status = jobs > 1 ? lispy_batch_parallel(&src, grammar->Lispy, filename, jobs, limits, format) : lispy_batch_serial(&src, grammar->Lispy, filename, limits, format);
+#endif
+
+    if (ferror(f))
+    {
+        perror(filename);
+        status = 1;
+    }
+
+    lispy_grammar_del(grammar);
+    lispy_source_free(&src);
+    if (path) { fclose(f); }
+
+    return status;
+}
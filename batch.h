@@ -0,0 +1,36 @@
+#ifndef batch_h
+#define batch_h
+
+#include <stddef.h>
+#include "parsing.h"
+#include "print.h"
+#include "reader.h"
+
+// Batch mode: reads a whole script, evaluates every form in it and prints
+// the results in source order, spreading the work over several threads.
+//
+// The input is cut into chunks of many top-level forms by a quick scan that
+// only counts parens. Each worker parses and evaluates whole chunks with the
+// one shared grammar and a context of its own (ctx.h) and renders the
+// results into memory, the main thread then writes the chunks out in the
+// order they were read.
+
+// roughly how many bytes of input go into one chunk
+#define LISPY_BATCH_CHUNK (64 * 1024)
+
+// how many chunks per worker may be in flight before reading stops and
+// waits for the output to catch up
+#define LISPY_BATCH_WINDOW 4
+
+// Runs the script at path, or stdin when path is NULL, with the given
+// number of worker threads and prints every result within limits, in the
+// given format. Returns the exit status for main.
+int lispy_batch(const char*, int, const lval_print_limits*, lval_format);
+
+// Evaluates every line of text just like the REPL would and writes the
+// results and any errors to out. Forms left open at the end are an error
+// and the reader starts afresh afterwards. The lines are cut in place, so
+// text[len] has to be writable. cache may be NULL.
+void lispy_batch_run(mpc_parser_t*, lval_reader*, lval_cache*, char*, size_t, lval_buf*);
+
+#endif
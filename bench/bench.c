@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../parsing.h"
+#include "../grammar.h"
+#include "../print.h"
+#include "../ctx.h"
+
+// Micro-benchmarks for the stages a line of Lispy goes through, each timed
+// on its own:
+//
+//     parse  mpc_parse of the line into an AST
+//     read   lval_read of that AST
+//     eval   lval_eval of a copy of what was read
+//     print  rendering what was read into a buffer
+//
+// Every workload is one synthetic line built at startup. Each stage is run
+// a number of times to warm up, then timed once per run, and the runs go
+// into the minimum, median, p99, maximum and mean. Everything a run sets up
+// or throws away, like copies and ASTs, is done outside the clock.
+//
+// Results are written one row per workload and stage, tab separated with a
+// header or, with --json, as one JSON document per line. With --packrat
+// the parse stage memoizes (mpc_parse_memo), which is how its overhead on
+// the Lispy grammar is measured, and with --ctx it parses with one parse
+// context kept over every run (mpc_parse_with_ctx), the way lispy does.
+// The grammar is compiled (mpc_compile), so parses run its program unless
+// --engine has them walk the parsers instead. Either way every workload
+// is first parsed both ways, and by the grammar mpca_lang makes out of
+// LISPY_GRAMMAR (lispy_grammar_from_lang), and has to come out the same
+// every time.
+//
+// --fuzz N times nothing. It makes N random lines out of pieces of Lispy,
+// most of which do not parse, and has each parsed by the compiled grammar,
+// by its parsers without the program (MPC_PARSE_NO_MACHINE) and by the
+// grammar from mpca_lang. The three have to agree on every line, on the
+// AST when it parses and on the error message when it does not, or bench
+// prints the line and exits with 1. --seed picks the lines.
+
+#define BENCH_RUNS 200
+#define BENCH_WARMUP 20
+#define BENCH_MEMO_SLOTS 4096
+#define BENCH_FUZZ_PIECES 24
+
+typedef struct bench_workload
+{
+    const char* name;
+    int size;
+    void (*gen)(lval_buf*, int);
+} bench_workload;
+
+// What the stages of one workload work on
+typedef struct bench_case
+{
+    mpc_parser_t* parser;
+    mpc_memo_t* memo;       // NULL unless --packrat
+    mpc_parse_ctx_t* pctx;  // NULL unless --ctx or --engine
+    char* text;
+    size_t len;
+    mpc_ast_t* ast;
+    lval* form;
+    lval_buf out;
+} bench_case;
+
+static void bench_printf(lval_buf* b, const char* fmt, long x, long y)
+{
+    char tmp[64];
+    snprintf(tmp, sizeof(tmp), fmt, x, y);
+    lval_buf_puts(b, tmp);
+}
+
+// + 0 1 2 ... one flat sum
+static void bench_gen_wide(lval_buf* b, int n)
+{
+    lval_buf_putc(b, '+');
+    for (int i = 0; i < n; i++) { bench_printf(b, " %ld", i, 0); }
+}
+
+// (+ 1 (+ 1 (+ 1 ... 1))) nested n deep
+static void bench_gen_deep(lval_buf* b, int n)
+{
+    for (int i = 0; i < n; i++) { lval_buf_puts(b, "(+ 1 "); }
+    lval_buf_putc(b, '1');
+    for (int i = 0; i < n; i++) { lval_buf_putc(b, ')'); }
+}
+
+// integers, floats and products of both in one sum
+static void bench_gen_mixed(lval_buf* b, int n)
+{
+    lval_buf_putc(b, '+');
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 3 == 0) { bench_printf(b, " %ld", i, 0); }
+        else if (i % 3 == 1) { bench_printf(b, " %ld.%02ld", i, i % 100); }
+        else { bench_printf(b, " (* %ld %ld.5)", i, i % 7); }
+    }
+}
+
+// a sum where every operand is an error, from evaluation or from reading
+static void bench_gen_errors(lval_buf* b, int n)
+{
+    lval_buf_putc(b, '+');
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 4 == 0) { bench_printf(b, " (/ %ld 0)", i, 0); }
+        else if (i % 4 == 1) { bench_printf(b, " (%% %ld 0)", i, 0); }
+        else if (i % 4 == 2) { bench_printf(b, " (- %ld (/ 1 0))", i, 0); }
+        else { lval_buf_puts(b, " 99999999999999999999"); }
+    }
+}
+
+// (0 1 2 ...) a list of literals, which only fails to evaluate
+static void bench_gen_list(lval_buf* b, int n)
+{
+    lval_buf_putc(b, '(');
+    for (int i = 0; i < n; i++) { bench_printf(b, i ? " %ld" : "%ld", i, 0); }
+    lval_buf_putc(b, ')');
+}
+
+static const bench_workload bench_workloads[] = {
+    { "wide", 256, bench_gen_wide },
+    { "deep", 64, bench_gen_deep },
+    { "mixed", 256, bench_gen_mixed },
+    { "errors", 128, bench_gen_errors },
+    { "list", 1024, bench_gen_list },
+};
+
+#define BENCH_WORKLOADS (int)(sizeof(bench_workloads) / sizeof(bench_workloads[0]))
+
+static long long bench_parse(bench_case* c)
+{
+    mpc_result_t r;
+
+    long long start = lispy_clock_ns();
+    int ok = c->memo ? mpc_parse_memo("<bench>", c->text, c->parser, &r, c->memo)
+        : c->pctx ? mpc_parse_with_ctx(c->pctx, "<bench>", c->text, c->parser, &r, NULL)
+        : mpc_parse("<bench>", c->text, c->parser, &r);
+    long long ns = lispy_clock_ns() - start;
+
+    if (ok) { mpc_ast_delete(r.output); }
+    else { mpc_err_delete(r.error); }
+
+    return ns;
+}
+
+static long long bench_read(bench_case* c)
+{
+    long long start = lispy_clock_ns();
+    lval* val = lval_read(c->ast);
+    long long ns = lispy_clock_ns() - start;
+
+    lval_del(val);
+    return ns;
+}
+
+static long long bench_eval(bench_case* c)
+{
+    lval* val = lval_copy(c->form);
+
+    long long start = lispy_clock_ns();
+    lval* result = lval_eval(val);
+    long long ns = lispy_clock_ns() - start;
+
+    lval_del(result);
+    return ns;
+}
+
+static long long bench_print(bench_case* c)
+{
+    c->out.len = 0;
+
+    long long start = lispy_clock_ns();
+    lval_buf_print(&c->out, c->form);
+    return lispy_clock_ns() - start;
+}
+
+// What fuzzed lines are made of
+static const char* bench_fuzz_pieces[] = {
+    "(", "(", ")", ")", "+", "-", "*", "/", "%", "0", "7", "42", "-3",
+    "1.5", "-0.25", "1.", ".5", "--1", "99999999999999999999",
+    " ", " ", "  ", "\t", "x", "#", "\\",
+};
+
+#define BENCH_FUZZ_KINDS (int)(sizeof(bench_fuzz_pieces) / sizeof(bench_fuzz_pieces[0]))
+
+static void bench_result_free(int ok, mpc_result_t* r)
+{
+    if (ok) { mpc_ast_delete(r->output); }
+    else { mpc_err_delete(r->error); }
+}
+
+// Whether b came out the same as a, errors by their message. Frees b.
+static int bench_fuzz_same(int x, mpc_result_t* a, int y, mpc_result_t* b)
+{
+    int same = x == y;
+
+    if (same && x) { same = mpc_ast_eq(a->output, b->output); }
+    else if (same)
+    {
+        char* e = mpc_err_string(a->error);
+        char* f = mpc_err_string(b->error);
+        same = strcmp(e, f) == 0;
+        free(e);
+        free(f);
+    }
+
+    bench_result_free(y, b);
+    return same;
+}
+
+static int bench_fuzz(lispy_grammar* grammar, lispy_grammar* reference, int lines, unsigned seed)
+{
+    mpc_parse_ctx_t* machine = mpc_parse_ctx_new();
+    mpc_parse_ctx_t* walk = mpc_parse_ctx_new();
+    mpc_parse_ctx_set_flags(walk, MPC_PARSE_NO_MACHINE);
+
+    lval_buf line;
+    lval_buf_init(&line, NULL, NULL);
+    srand(seed);
+
+    int bad = 0, parsed = 0;
+    for (int i = 0; i < lines && !bad; i++)
+    {
+        line.len = 0;
+        int n = rand() % BENCH_FUZZ_PIECES;
+        for (int j = 0; j < n; j++) { lval_buf_puts(&line, bench_fuzz_pieces[rand() % BENCH_FUZZ_KINDS]); }
+        lval_buf_putc(&line, '\0');
+
+        mpc_result_t a, b, c;
+        int x = mpc_parse_with_ctx(machine, "<fuzz>", line.data, grammar->Lispy, &a, NULL);
+        int y = mpc_parse_with_ctx(walk, "<fuzz>", line.data, grammar->Lispy, &b, NULL);
+        int z = mpc_parse("<fuzz>", line.data, reference->Lispy, &c);
+
+        if (!bench_fuzz_same(x, &a, y, &b))
+        {
+            fprintf(stderr, "fuzz: the compiled parser and the parsers differ on \"%s\"\n", line.data);
+            bad = 1;
+        }
+        if (!bench_fuzz_same(x, &a, z, &c))
+        {
+            fprintf(stderr, "fuzz: lispy_grammar_new and mpca_lang differ on \"%s\"\n", line.data);
+            bad = 1;
+        }
+
+        parsed += x;
+        bench_result_free(x, &a);
+    }
+
+    if (!bad) { printf("fuzz: %d lines, %d parsed, all the same\n", lines, parsed); }
+
+    lval_buf_free(&line);
+    mpc_parse_ctx_delete(machine);
+    mpc_parse_ctx_delete(walk);
+    return bad;
+}
+
+typedef struct bench_stage
+{
+    const char* name;
+    long long (*run)(bench_case*);
+} bench_stage;
+
+static const bench_stage bench_stages[] = {
+    { "parse", bench_parse },
+    { "read", bench_read },
+    { "eval", bench_eval },
+    { "print", bench_print },
+};
+
+static int bench_cmp(const void* a, const void* b)
+{
+    long long x = *(const long long*)a;
+    long long y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_report(const char* workload, const char* stage, size_t len, long long* ns, int runs, int json)
+{
+    qsort(ns, runs, sizeof(long long), bench_cmp);
+
+    double sum = 0;
+    for (int i = 0; i < runs; i++) { sum += ns[i]; }
+
+    // the smallest value with at least 99% of the runs at or below it
+    int p99 = (runs * 99 + 99) / 100 - 1;
+
+    if (json)
+    {
+        printf("{\"workload\":\"%s\",\"stage\":\"%s\",\"bytes\":%lu,\"runs\":%d,"
+            "\"min_ns\":%lld,\"median_ns\":%lld,\"p99_ns\":%lld,\"max_ns\":%lld,\"mean_ns\":%.0f}\n",
+            workload, stage, (unsigned long)len, runs, ns[0], ns[runs / 2], ns[p99], ns[runs - 1], sum / runs);
+    }
+    else
+    {
+        printf("%s\t%s\t%lu\t%d\t%lld\t%lld\t%lld\t%lld\t%.0f\n",
+            workload, stage, (unsigned long)len, runs, ns[0], ns[runs / 2], ns[p99], ns[runs - 1], sum / runs);
+    }
+    fflush(stdout);
+}
+
+// Reads a count for one of the options, a whole number above zero
+static int bench_parse_count(const char* s, int* x)
+{
+    char* end;
+    long n = strtol(s, &end, 10);
+    *x = (int)n;
+
+    return end != s && *end == '\0' && n > 0 && n <= 100000000;
+}
+
+static int bench_wanted(const char* name, char** only, int num)
+{
+    if (num == 0) { return 1; }
+
+    for (int i = 0; i < num; i++)
+    {
+        if (strcmp(name, only[i]) == 0) { return 1; }
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int runs = BENCH_RUNS;
+    int warmup = BENCH_WARMUP;
+    int json = 0;
+    int packrat = 0;
+    int with_ctx = 0;
+    int engine = 0;
+    int fuzz = 0;
+    int seed = 1;
+    char** only = malloc(sizeof(char*) * argc);
+    int only_num = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc && bench_parse_count(argv[i + 1], &runs)) { i++; }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc && bench_parse_count(argv[i + 1], &warmup)) { i++; }
+        else if (strcmp(argv[i], "--json") == 0) { json = 1; }
+        else if (strcmp(argv[i], "--packrat") == 0) { packrat = 1; }
+        else if (strcmp(argv[i], "--ctx") == 0) { with_ctx = 1; }
+        else if (strcmp(argv[i], "--engine") == 0) { engine = 1; }
+        else if (strcmp(argv[i], "--fuzz") == 0 && i + 1 < argc && bench_parse_count(argv[i + 1], &fuzz)) { i++; }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc && bench_parse_count(argv[i + 1], &seed)) { i++; }
+        else if (argv[i][0] != '-') { only[only_num++] = argv[i]; }
+        else
+        {
+            fprintf(stderr, "usage: %s [--runs N] [--warmup N] [--json] [--packrat | --ctx | --engine] [--fuzz N [--seed N]] [WORKLOAD...]\nworkloads:", argv[0]);
+            for (int j = 0; j < BENCH_WORKLOADS; j++) { fprintf(stderr, " %s", bench_workloads[j].name); }
+            fputc('\n', stderr);
+            return 1;
+        }
+    }
+
+    lispy_grammar* grammar = lispy_grammar_new();
+    lispy_grammar* reference = lispy_grammar_from_lang();
+    if (reference == NULL) { return 1; }
+
+    if (fuzz)
+    {
+        int bad = bench_fuzz(grammar, reference, fuzz, (unsigned)seed);
+        lispy_grammar_del(reference);
+        lispy_grammar_del(grammar);
+        free(only);
+        return bad;
+    }
+    long long* ns = malloc(sizeof(long long) * runs);
+    mpc_memo_t* memo = NULL;
+    if (packrat) { memo = mpc_memo_new(BENCH_MEMO_SLOTS, (mpc_copy_t)mpc_ast_copy, (mpc_dtor_t)mpc_ast_delete); }
+    mpc_parse_ctx_t* pctx = with_ctx || engine ? mpc_parse_ctx_new() : NULL;
+    mpc_parse_ctx_t* walk = mpc_parse_ctx_new();
+    mpc_parse_ctx_set_flags(walk, MPC_PARSE_NO_MACHINE);
+    if (engine) { mpc_parse_ctx_set_flags(pctx, MPC_PARSE_NO_MACHINE); }
+
+    if (!json) { puts("workload\tstage\tbytes\truns\tmin_ns\tmedian_ns\tp99_ns\tmax_ns\tmean_ns"); }
+
+    for (int w = 0; w < BENCH_WORKLOADS; w++)
+    {
+        const bench_workload* wl = &bench_workloads[w];
+        if (!bench_wanted(wl->name, only, only_num)) { continue; }
+
+        bench_case c;
+        c.parser = grammar->Lispy;
+        c.memo = memo;
+        c.pctx = pctx;
+
+        lval_buf text;
+        lval_buf_init(&text, NULL, NULL);
+        wl->gen(&text, wl->size);
+        c.text = lval_buf_take(&text, &c.len);
+        lval_buf_free(&text);
+
+        mpc_result_t r;
+        if (!mpc_parse("<bench>", c.text, c.parser, &r))
+        {
+            fprintf(stderr, "%s: ", wl->name);
+            mpc_err_print_to(r.error, stderr);
+            mpc_err_delete(r.error);
+            return 1;
+        }
+
+        c.ast = r.output;
+
+        if (!mpc_parse_with_ctx(walk, "<bench>", c.text, c.parser, &r, NULL))
+        {
+            mpc_err_delete(r.error);
+            fprintf(stderr, "%s: only the compiled parser accepts it\n", wl->name);
+            return 1;
+        }
+
+        int same = mpc_ast_eq(c.ast, r.output);
+        mpc_ast_delete(r.output);
+        if (!same)
+        {
+            fprintf(stderr, "%s: the compiled parser and the parsers give different ASTs\n", wl->name);
+            return 1;
+        }
+
+        if (!mpc_parse("<bench>", c.text, reference->Lispy, &r))
+        {
+            mpc_err_delete(r.error);
+            fprintf(stderr, "%s: only lispy_grammar_new accepts it\n", wl->name);
+            return 1;
+        }
+
+        same = mpc_ast_eq(c.ast, r.output);
+        mpc_ast_delete(r.output);
+        if (!same)
+        {
+            fprintf(stderr, "%s: lispy_grammar_new and mpca_lang give different ASTs\n", wl->name);
+            return 1;
+        }
+
+        c.form = lval_read(c.ast);
+        lval_buf_init(&c.out, NULL, NULL);
+
+        for (int s = 0; s < (int)(sizeof(bench_stages) / sizeof(bench_stages[0])); s++)
+        {
+            for (int i = 0; i < warmup; i++) { bench_stages[s].run(&c); }
+            for (int i = 0; i < runs; i++) { ns[i] = bench_stages[s].run(&c); }
+
+            bench_report(wl->name, bench_stages[s].name, c.len, ns, runs, json);
+        }
+
+        lval_buf_free(&c.out);
+        lval_del(c.form);
+        mpc_ast_delete(c.ast);
+        free(c.text);
+    }
+
+    if (memo) { mpc_memo_delete(memo); }
+    if (pctx) { mpc_parse_ctx_delete(pctx); }
+    mpc_parse_ctx_delete(walk);
+    free(ns);
+    free(only);
+    lispy_grammar_del(reference);
+    lispy_grammar_del(grammar);
+
+    return 0;
+}
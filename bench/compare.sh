@@ -0,0 +1,50 @@
+#!/bin/sh
+# Compares the medians of benchmark runs, as bench writes them without
+# --json: the first file is the baseline and every other one gets its
+# median and its speedup over the baseline, with the geometric mean of
+# the speedups at the bottom. A file can hold several runs one after the
+# other, the lowest median of each benchmark is the one compared.
+#
+#     sh bench/compare.sh build/o2.tsv build/lto.tsv build/release.tsv
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 BASELINE.tsv OTHER.tsv..." >&2
+    exit 1
+fi
+
+awk -F '\t' '
+FNR == 1 {
+    file++
+    name[file] = FILENAME
+    sub(/.*\//, "", name[file])
+    sub(/\.tsv$/, "", name[file])
+}
+$1 == "workload" { next }
+{
+    key = $1 "\t" $2
+    if (file == 1 && !(key in seen)) { seen[key] = 1; keys[++n] = key }
+    if (!((file, key) in median) || $6 < median[file, key]) { median[file, key] = $6 }
+}
+END {
+    printf "%-8s %-6s %12s", "workload", "stage", name[1]
+    for (f = 2; f <= file; f++) { printf " %12s %8s", name[f], "speedup" }
+    printf "\n"
+
+    for (i = 1; i <= n; i++) {
+        key = keys[i]
+        split(key, k, "\t")
+        printf "%-8s %-6s %12d", k[1], k[2], median[1, key]
+        for (f = 2; f <= file; f++) {
+            if (!((f, key) in median) || median[f, key] <= 0) { printf " %12s %8s", "-", "-"; continue }
+            s = median[1, key] / median[f, key]
+            logs[f] += log(s)
+            count[f]++
+            printf " %12d %7.2fx", median[f, key], s
+        }
+        printf "\n"
+    }
+
+    printf "%-8s %-6s %12s", "geomean", "", ""
+    for (f = 2; f <= file; f++) { printf " %12s %7.2fx", "", count[f] ? exp(logs[f] / count[f]) : 0 }
+    printf "\n"
+}' "$@"
@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "cache.h"
+
+// The REPL and batch feeds send the same lines over and over, so the result
+// of mpc_parse + lval_read is kept around keyed by the text of the line.
+//
+// The cache is direct mapped: a line can only live in the slot picked by its
+// hash, and a new line simply evicts whatever was there before. The full text
+// is kept next to the hash so a collision can never hand back the wrong value.
+
+static unsigned long lval_cache_hash(const char* s, size_t* len)
+{
+    // FNV-1a
+    unsigned long h = 2166136261UL;
+    const char* p = s;
+
+    while (*p)
+    {
+        h ^= (unsigned char)*p++;
+        h *= 16777619UL;
+    }
+
+    *len = p - s;
+    return h;
+}
+
+static void lval_cache_clear(lval_cache_entry* e)
+{
+    free(e->text);
+    if (e->tmpl) { lval_del(e->tmpl); }
+
+    e->hash = 0;
+    e->len = 0;
+    e->text = NULL;
+    e->tmpl = NULL;
+}
+
+lval_cache* lval_cache_new(int slots)
+{
+    lval_cache* c = malloc(sizeof(lval_cache));
+    c->slots = slots;
+    c->entries = calloc(slots, sizeof(lval_cache_entry));
+
+    c->lookups = 0;
+    c->hits = 0;
+    c->bytes_saved = 0;
+
+    return c;
+}
+
+void lval_cache_del(lval_cache* c)
+{
+    for (int i = 0; i < c->slots; i++)
+    {
+        lval_cache_clear(&c->entries[i]);
+    }
+
+    free(c->entries);
+    free(c);
+}
+
+lval* lval_cache_get(lval_cache* c, const char* text)
+{
+    size_t len;
+    unsigned long h = lval_cache_hash(text, &len);
+    lval_cache_entry* e = &c->entries[h & (c->slots - 1)];
+
+    c->lookups++;
+
+    if (e->text == NULL || e->hash != h || e->len != len) { return NULL; }
+    if (memcmp(e->text, text, len) != 0) { return NULL; }
+
+    c->hits++;
+    c->bytes_saved += len;
+
+    // evaluation consumes its argument so the template itself is never handed out
+    return lval_copy(e->tmpl);
+}
+
+void lval_cache_put(lval_cache* c, const char* text, lval* val)
+{
+    size_t len;
+    unsigned long h = lval_cache_hash(text, &len);
+    lval_cache_entry* e = &c->entries[h & (c->slots - 1)];
+
+    if (len > LVAL_CACHE_MAX_LINE) { return; }
+
+    lval_cache_clear(e);
+
+    e->hash = h;
+    e->len = len;
+    e->text = malloc(len + 1);
+    memcpy(e->text, text, len + 1);
+    e->tmpl = lval_copy(val);
+}
+
+void lval_cache_report(lval_cache* c, FILE* f)
+{
+    double rate = c->lookups ? 100.0 * c->hits / c->lookups : 0.0;
+
+    fprintf(f, "cache: %lu lookups, %lu hits (%.1f%%), %lu bytes not reparsed\n",
+        c->lookups, c->hits, rate, c->bytes_saved);
+}
@@ -0,0 +1,41 @@
+#ifndef cache_h
+#define cache_h
+
+#include <stdio.h>
+#include "parsing.h"
+
+// number of slots in the REPL's cache, must be a power of two
+#define LVAL_CACHE_SLOTS 1024
+
+// lines longer than this are never cached, which keeps the total size of
+// the cache bounded by roughly LVAL_CACHE_SLOTS * LVAL_CACHE_MAX_LINE
+#define LVAL_CACHE_MAX_LINE 4096
+
+typedef struct lval_cache_entry
+{
+    unsigned long hash;
+    size_t len;
+    char* text;
+    lval* tmpl; // read but never evaluated, only ever copied
+} lval_cache_entry;
+
+// A cache is not locked, it belongs to one thread the way a context does
+typedef struct lval_cache
+{
+    int slots;
+    lval_cache_entry* entries;
+
+    unsigned long lookups;
+    unsigned long hits;
+    unsigned long bytes_saved;
+} lval_cache;
+
+lval_cache* lval_cache_new(int);
+void lval_cache_del(lval_cache*);
+
+lval* lval_cache_get(lval_cache*, const char*);
+void lval_cache_put(lval_cache*, const char*, lval*);
+
+void lval_cache_report(lval_cache*, FILE*);
+
+#endif
@@ -0,0 +1,156 @@
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "ctx.h"
+#include "stats.h"
+
+lispy_budget lispy_budget_limits = { 0, 0, 0, 0 };
+
+// A thread that never sets a context of its own uses this one. It starts
+// out zeroed, which is an empty context.
+static LISPY_THREAD_LOCAL lispy_ctx lispy_ctx_own;
+static LISPY_THREAD_LOCAL lispy_ctx* lispy_ctx_current = NULL;
+
+void lispy_ctx_init(lispy_ctx* ctx)
+{
+    ctx->pool = NULL;
+    ctx->pool_num = 0;
+
+    ctx->steps = 0;
+    ctx->depth = 0;
+    ctx->bytes = 0;
+    ctx->deadline = 0;
+    ctx->exhausted = 0;
+
+    memset(&ctx->stats, 0, sizeof(lispy_stats));
+
+    ctx->profile = NULL;
+    ctx->slot = NULL;
+    ctx->parser = NULL;
+}
+
+void lispy_ctx_free(lispy_ctx* ctx)
+{
+    lispy_stats_retire(ctx);
+
+    while (ctx->pool != NULL)
+    {
+        lval* next = (lval*)ctx->pool->cell;
+        free(ctx->pool);
+        ctx->pool = next;
+    }
+
+    ctx->pool_num = 0;
+
+    if (ctx->parser != NULL)
+    {
+        mpc_parse_ctx_delete(ctx->parser);
+        ctx->parser = NULL;
+    }
+}
+
+lispy_ctx* lispy_ctx_set(lispy_ctx* ctx)
+{
+    lispy_ctx* prev = lispy_ctx_get();
+    lispy_ctx_current = ctx;
+
+    return prev;
+}
+
+lispy_ctx* lispy_ctx_get(void)
+{
+    return lispy_ctx_current ? lispy_ctx_current : &lispy_ctx_own;
+}
+
+mpc_parse_ctx_t* lispy_ctx_parser(lispy_ctx* ctx)
+{
+    if (ctx->parser == NULL) { ctx->parser = mpc_parse_ctx_new(); }
+    return ctx->parser;
+}
+
+long long lispy_clock_ns(void)
+{
+#ifdef _WIN32
+    return (long long)GetTickCount64() * 1000000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+void lispy_budget_begin(lispy_ctx* ctx)
+{
+    ctx->steps = 0;
+    ctx->depth = 0;
+    ctx->bytes = 0;
+    ctx->exhausted = 0;
+    ctx->deadline = lispy_budget_limits.ms > 0 ? lispy_clock_ns() + lispy_budget_limits.ms * 1000000LL : 0;
+}
+
+void lispy_budget_check_time(lispy_ctx* ctx)
+{
+    if (ctx->deadline > 0 && lispy_clock_ns() >= ctx->deadline && !ctx->exhausted)
+    {
+        ctx->exhausted = LERR_TIME;
+    }
+}
+
+lval* lispy_budget_error(lispy_ctx* ctx)
+{
+    switch (ctx->exhausted)
+    {
+        case LERR_STEPS: return lval_err(LERR_STEPS, "Step limit reached");
+        case LERR_DEPTH: return lval_err(LERR_DEPTH, "Nesting limit reached");
+        case LERR_TIME: return lval_err(LERR_TIME, "Time limit reached");
+        case LERR_MEMORY: return lval_err(LERR_MEMORY, "Memory limit reached");
+        default: break;
+    }
+
+    return lval_err(ctx->exhausted, "Evaluation stopped");
+}
+
+// Lvals that are freed go on the context's pool and are handed out again
+// before going to malloc, so threads that build and drop lots of small
+// values never contend with each other for the allocator.
+
+lval* lval_alloc(void)
+{
+    lispy_ctx* ctx = lispy_ctx_get();
+    lval* val = ctx->pool;
+    lispy_budget_alloc(ctx, sizeof(lval));
+
+    if (val == NULL)
+    {
+        ctx->stats.lval_new++;
+        return malloc(sizeof(lval));
+    }
+
+    ctx->pool = (lval*)val->cell;
+    ctx->pool_num--;
+    ctx->stats.lval_reused++;
+
+    return val;
+}
+
+void lval_free(lval* val)
+{
+    lispy_ctx* ctx = lispy_ctx_get();
+
+    if (ctx->pool_num >= LVAL_POOL_MAX)
+    {
+        ctx->stats.lval_freed++;
+        free(val);
+        return;
+    }
+
+    val->cell = (lval**)ctx->pool;
+    ctx->pool = val;
+    ctx->pool_num++;
+}
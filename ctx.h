@@ -0,0 +1,155 @@
+#ifndef ctx_h
+#define ctx_h
+
+#include "parsing.h"
+
+// Everything a thread needs to read and evaluate Lispy that is not shared
+// with other threads. The parser is not in here: a parser graph is never
+// written to while parsing, so one graph serves every thread (see mpc.h).
+//
+// Each thread works with its current context, which lval_alloc and friends
+// reach through a thread local pointer, so nothing on the hot path takes a
+// lock. A thread that never sets one gets a context of its own anyway.
+
+// most lvals a context keeps around for reuse once they have been freed
+#define LVAL_POOL_MAX 4096
+
+// Counters kept by every context, plain fields that only its own thread
+// touches. Other threads get to see them once published (stats.h).
+typedef struct lispy_stats
+{
+    unsigned long lval_new;    // lvals that came from malloc
+    unsigned long lval_reused; // lvals handed out again from the pool
+    unsigned long lval_freed;  // lvals given back to free, the pool was full
+    unsigned long forms;       // forms read, ready to be evaluated
+
+    unsigned long allocs[LVAL_TYPES]; // lvals built, by type
+    unsigned long frees[LVAL_TYPES];  // lvals deleted, by type
+    unsigned long pop_bytes;          // bytes moved by lval_pop
+    unsigned long add_reallocs;       // cell arrays grown by lval_add
+
+    mpc_stats_t mpc;                  // mpc_parse calls, backtracks and reparses
+    unsigned long errors[LERR_CODES]; // parse errors and error results
+} lispy_stats;
+
+// How much one evaluation may use, 0 means no limit. An evaluation is one
+// call to lval_eval from outside the evaluator, steps are calls to lval_eval
+// within it, depth is how deeply sexprs nest while being evaluated, a whole
+// line being one itself, and bytes are what the lvals built meanwhile take
+// up, cells and strings included. The limits hold for every thread, set
+// them before starting any.
+typedef struct lispy_budget
+{
+    unsigned long steps;
+    long depth;
+    long ms;
+    size_t bytes;
+} lispy_budget;
+
+extern lispy_budget lispy_budget_limits;
+
+// the clock is only looked at every this many steps
+#define LISPY_BUDGET_CLOCK_STEPS 256
+
+typedef struct lispy_ctx
+{
+    // freed lvals, chained through their cell pointer
+    lval* pool;
+    int pool_num;
+
+    // what the evaluation under way has used so far, and the error that
+    // ended it once something ran out
+    unsigned long steps;
+    long depth;
+    size_t bytes;
+    long long deadline;
+    lval_error exhausted;
+
+    lispy_stats stats;
+
+    // where the time goes, NULL unless profiling (profile.h)
+    struct lispy_profile* profile;
+
+    // where the stats are published, NULL until they first are
+    struct lispy_stats_slot* slot;
+
+    // the stacks and buffers mpc parses with, kept from one line to the
+    // next, NULL until the first parse
+    mpc_parse_ctx_t* parser;
+} lispy_ctx;
+
+void lispy_ctx_init(lispy_ctx*);
+
+// Gives the pooled lvals and the parse context back to malloc and adds the
+// counters to the totals of contexts that are gone. Values that were
+// allocated under the context stay valid, only its spare capacity goes.
+void lispy_ctx_free(lispy_ctx*);
+
+// Makes ctx the current context of the calling thread, NULL goes back to
+// the thread's own. Returns the context that was current before.
+lispy_ctx* lispy_ctx_set(lispy_ctx*);
+lispy_ctx* lispy_ctx_get(void);
+
+// The parse context of ctx, made on first use
+mpc_parse_ctx_t* lispy_ctx_parser(lispy_ctx*);
+
+// Monotonic time in nanoseconds
+long long lispy_clock_ns(void);
+
+// Starts the budget of a new evaluation
+void lispy_budget_begin(lispy_ctx*);
+
+// Checks the clock and sets exhausted if the deadline has passed
+void lispy_budget_check_time(lispy_ctx*);
+
+// The error an evaluation ends with once its budget ran out
+lval* lispy_budget_error(lispy_ctx*);
+
+// Counts one step into the evaluation of a value. Returns 0 if the
+// evaluation has to stop instead.
+static inline int lispy_budget_step(lispy_ctx* ctx)
+{
+    if (ctx->exhausted) { return 0; }
+
+    ctx->steps++;
+    if (lispy_budget_limits.steps > 0 && ctx->steps > lispy_budget_limits.steps)
+    {
+        ctx->exhausted = LERR_STEPS;
+        return 0;
+    }
+
+    if (ctx->deadline > 0 && ctx->steps % LISPY_BUDGET_CLOCK_STEPS == 0)
+    {
+        lispy_budget_check_time(ctx);
+        return !ctx->exhausted;
+    }
+
+    return 1;
+}
+
+// Goes one sexpr deeper. Returns 0 if that is too deep, the caller leaves
+// depth as it is then.
+static inline int lispy_budget_enter(lispy_ctx* ctx)
+{
+    if (lispy_budget_limits.depth > 0 && ctx->depth >= lispy_budget_limits.depth)
+    {
+        ctx->exhausted = LERR_DEPTH;
+        return 0;
+    }
+
+    ctx->depth++;
+    return 1;
+}
+
+// Counts memory taken by an evaluation. Allocations cannot fail from here,
+// so running out only marks the evaluation, which stops at its next step.
+static inline void lispy_budget_alloc(lispy_ctx* ctx, size_t n)
+{
+    ctx->bytes += n;
+    if (lispy_budget_limits.bytes > 0 && ctx->bytes > lispy_budget_limits.bytes && !ctx->exhausted)
+    {
+        ctx->exhausted = LERR_MEMORY;
+    }
+}
+
+#endif
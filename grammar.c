@@ -0,0 +1,172 @@
+#include <stdlib.h>
+
+#include "grammar.h"
+
+// mpca_lang parses the grammar text with a parser of its own, and every
+// regex in it goes through mpc_re, which builds and throws away yet another
+// parser just to read the regex. Short lived processes pay for all of that
+// on every start even though the result is always the same.
+//
+// lispy_grammar_new builds the combinators mpca_lang would have produced for
+// LISPY_GRAMMAR directly, so nothing gets parsed and far fewer allocations
+// are made. It is not free, the numbers still get their DFAs built and the
+// whole grammar is compiled (mpc_compile), but all told it takes about a
+// quarter of the time mpca_lang did. The parsers it returns produce exactly
+// the same ASTs, tags and error messages. lispy_grammar_from_lang still goes through
+// mpca_lang and is kept as the reference to check against, bench refuses
+// to run when the two parse any of its workloads differently.
+//
+// If LISPY_GRAMMAR changes, the construction below has to change with it.
+
+// The regex leaves, written out the way mpc_re would have built them, each
+// handed to mpc_regular as mpc_re does. The numbers get a DFA, the anchors
+// cannot have one.
+
+static mpc_parser_t* lispy_re_digits(void)
+{
+    // [0-9]+
+    return mpc_many1(mpcf_strfold, mpc_oneof("0123456789"));
+}
+
+static mpc_parser_t* lispy_re_integer(void)
+{
+    // -?[0-9]+
+    return mpc_regular(mpc_and(2, mpcf_strfold,
+        mpc_maybe_lift(mpc_char('-'), mpcf_ctor_str),
+        lispy_re_digits(),
+        free));
+}
+
+static mpc_parser_t* lispy_re_flt(void)
+{
+    // -?[0-9]+([.][0-9]+)
+    return mpc_regular(mpc_and(3, mpcf_strfold,
+        mpc_maybe_lift(mpc_char('-'), mpcf_ctor_str),
+        lispy_re_digits(),
+        mpc_and(2, mpcf_strfold, mpc_oneof("."), lispy_re_digits(), free),
+        free, free));
+}
+
+static mpc_parser_t* lispy_re_soi(void)
+{
+    // ^
+    return mpc_regular(mpc_and(2, mpcf_snd, mpc_soi(), mpc_lift(mpcf_ctor_str), free));
+}
+
+static mpc_parser_t* lispy_re_eoi(void)
+{
+    // $
+    return mpc_regular(mpc_and(2, mpcf_snd, mpc_eoi(), mpc_lift(mpcf_ctor_str), free));
+}
+
+// The grammar level pieces, one per kind of term in the grammar text
+
+static mpc_parser_t* lispy_regex(mpc_parser_t* re)
+{
+    return mpca_state(mpca_tag(mpc_apply(mpc_tok(re), mpcf_str_ast), "regex"));
+}
+
+static mpc_parser_t* lispy_char(char c)
+{
+    return mpca_state(mpca_tag(mpc_apply(mpc_tok(mpc_char(c)), mpcf_str_ast), "char"));
+}
+
+static mpc_parser_t* lispy_ref(mpc_parser_t* p, const char* name)
+{
+    return mpca_state(mpca_root(mpca_add_tag(p, name)));
+}
+
+static mpc_parser_t* lispy_term(int n, mpc_parser_t** xs)
+{
+    // a sequence of factors is folded onto an empty pass, as mpca_lang does
+    mpc_parser_t* p = mpc_pass();
+    for (int i = 0; i < n; i++)
+    {
+        p = mpca_and(2, p, xs[i]);
+    }
+
+    return p;
+}
+
+static mpc_parser_t* lispy_alternatives(int n, mpc_parser_t** xs)
+{
+    // "a | b | c" nests to the right: a | (b | c)
+    if (n == 1) { return lispy_term(1, &xs[0]); }
+    return mpca_or(2, lispy_term(1, &xs[0]), lispy_alternatives(n - 1, xs + 1));
+}
+
+lispy_grammar* lispy_grammar_new(void)
+{
+    lispy_grammar* g = malloc(sizeof(lispy_grammar));
+
+    g->Flt = mpc_new("flt");
+    g->Integer = mpc_new("integer");
+    g->Symbol = mpc_new("symbol");
+    g->Sexpr = mpc_new("sexpr");
+    g->Expr = mpc_new("expr");
+    g->Lispy = mpc_new("lispy");
+
+    mpc_parser_t* integer[] = { lispy_regex(lispy_re_integer()) };
+    mpc_define(g->Integer, lispy_term(1, integer));
+
+    mpc_parser_t* flt[] = { lispy_regex(lispy_re_flt()) };
+    mpc_define(g->Flt, lispy_term(1, flt));
+
+    mpc_parser_t* symbol[] = {
+        lispy_char('+'), lispy_char('-'), lispy_char('*'), lispy_char('/'), lispy_char('%')
+    };
+    mpc_define(g->Symbol, lispy_alternatives(5, symbol));
+
+    mpc_parser_t* sexpr[] = {
+        lispy_char('('), mpca_many(lispy_ref(g->Expr, "expr")), lispy_char(')')
+    };
+    mpc_define(g->Sexpr, lispy_term(3, sexpr));
+
+    mpc_parser_t* expr[] = {
+        lispy_ref(g->Flt, "flt"), lispy_ref(g->Integer, "integer"),
+        lispy_ref(g->Symbol, "symbol"), lispy_ref(g->Sexpr, "sexpr")
+    };
+    mpc_define(g->Expr, lispy_alternatives(4, expr));
+
+    mpc_parser_t* lispy[] = {
+        lispy_regex(lispy_re_soi()), mpca_many(lispy_ref(g->Expr, "expr")), lispy_regex(lispy_re_eoi())
+    };
+    mpc_define(g->Lispy, lispy_term(3, lispy));
+
+    // lines are parsed by the machine program of the whole grammar, the
+    // parsers themselves are only walked for the error of a bad line
+    mpc_compile(g->Lispy);
+
+    return g;
+}
+
+lispy_grammar* lispy_grammar_from_lang(void)
+{
+    lispy_grammar* g = malloc(sizeof(lispy_grammar));
+
+    g->Flt = mpc_new("flt");
+    g->Integer = mpc_new("integer");
+    g->Symbol = mpc_new("symbol");
+    g->Sexpr = mpc_new("sexpr");
+    g->Expr = mpc_new("expr");
+    g->Lispy = mpc_new("lispy");
+
+    mpc_err_t* err = mpca_lang(MPCA_LANG_DEFAULT, LISPY_GRAMMAR,
+        g->Flt, g->Integer, g->Symbol, g->Sexpr, g->Expr, g->Lispy, NULL);
+
+    if (err != NULL)
+    {
+        mpc_err_print_to(err, stderr);
+        mpc_err_delete(err);
+        lispy_grammar_del(g);
+        return NULL;
+    }
+
+    return g;
+}
+
+void lispy_grammar_del(lispy_grammar* g)
+{
+    mpc_cleanup(6, g->Flt, g->Integer, g->Symbol, g->Sexpr, g->Expr, g->Lispy);
+    free(g);
+}
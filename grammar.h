@@ -0,0 +1,29 @@
+#ifndef grammar_h
+#define grammar_h
+
+#include "lib/mpc.h"
+
+// The Lispy grammar, as handed to mpca_lang
+#define LISPY_GRAMMAR                                       \
+    "integer : /-?[0-9]+/ ;                              \n" \
+    "flt     : /-?[0-9]+([.][0-9]+)/ ;                   \n" \
+    "symbol  : '+' | '-' | '*' | '/' | '%' ;             \n" \
+    "sexpr   : '(' <expr>* ')' ;                         \n" \
+    "expr    : <flt> | <integer> | <symbol> | <sexpr> ;  \n" \
+    "lispy   : /^/ <expr>* /$/ ;                         \n"
+
+typedef struct lispy_grammar
+{
+    mpc_parser_t* Flt;
+    mpc_parser_t* Integer;
+    mpc_parser_t* Symbol;
+    mpc_parser_t* Sexpr;
+    mpc_parser_t* Expr;
+    mpc_parser_t* Lispy;
+} lispy_grammar;
+
+lispy_grammar* lispy_grammar_new(void);
+lispy_grammar* lispy_grammar_from_lang(void);
+void lispy_grammar_del(lispy_grammar*);
+
+#endif
@@ -122,13 +122,12 @@ void mpc_err_string_cat(char *buffer, int *pos, int *max, char const *fmt, ...)
   va_end(va);
 }
 
-static char char_unescape_buffer[3];
-
-static const char *mpc_err_char_unescape(char c) {
+static const char *mpc_err_char_unescape(char c, char *buffer) {
   
-  char_unescape_buffer[0] = '\'';
-  char_unescape_buffer[1] = ' ';
-  char_unescape_buffer[2] = '\'';
+  buffer[0] = '\'';
+  buffer[1] = ' ';
+  buffer[2] = '\'';
+  buffer[3] = '\0';
   
   switch (c) {
     
@@ -142,8 +141,8 @@ static const char *mpc_err_char_unescape(char c) {
     case '\t': return "tab";
     case ' ' : return "space";
     default:
-      char_unescape_buffer[1] = c;
-      return char_unescape_buffer;
+      buffer[1] = c;
+      return buffer;
   }
   
 }
@@ -151,6 +150,7 @@ static const char *mpc_err_char_unescape(char c) {
 char *mpc_err_string(mpc_err_t *x) {
   
   char *buffer = calloc(1, 1024);
+  char received[4];
   int max = 1023;
   int pos = 0; 
   int i;
@@ -178,7 +178,7 @@ char *mpc_err_string(mpc_err_t *x) {
   }
   
   mpc_err_string_cat(buffer, &pos, &max, " at ");
-  mpc_err_string_cat(buffer, &pos, &max, mpc_err_char_unescape(x->recieved));
+  mpc_err_string_cat(buffer, &pos, &max, "%s", mpc_err_char_unescape(x->recieved, received));
   mpc_err_string_cat(buffer, &pos, &max, "\n");
   
   return realloc(buffer, strlen(buffer) + 1);
@@ -318,20 +318,27 @@ typedef struct {
   char *filename;  
   mpc_state_t state;
   
-  char *string;
+  const char *string;
+  long length;
   char *buffer;
   FILE *file;
   
   int backtrack;
   int marks_num;
+  int marks_slots;
+  int marks_peak;
+  long marks_hwm;
   mpc_state_t* marks;
   char* lasts;
   
   char last;
+  unsigned long rewinds;
+  unsigned long reparses;
   
 } mpc_input_t;
 
-static mpc_input_t *mpc_input_new_string(const char *filename, const char *string) {
+/* Strings are not copied, the caller keeps them until the input is gone */
+static mpc_input_t *mpc_input_new_string(const char *filename, const char *string, long length) {
 
   mpc_input_t *i = malloc(sizeof(mpc_input_t));
   
@@ -341,17 +348,22 @@ static mpc_input_t *mpc_input_new_string(const char *filename, const char *strin
   
   i->state = mpc_state_new();
   
-  i->string = malloc(strlen(string) + 1);
-  strcpy(i->string, string);
+  i->string = string;
+  i->length = length;
   i->buffer = NULL;
   i->file = NULL;
   
   i->backtrack = 1;
   i->marks_num = 0;
+  i->marks_slots = 0;
+  i->marks_peak = 0;
+  i->marks_hwm = 0;
   i->marks = NULL;
   i->lasts = NULL;
 
   i->last = '\0';
+  i->rewinds = 0;
+  i->reparses = 0;
   
   return i;
 }
@@ -367,15 +379,21 @@ static mpc_input_t *mpc_input_new_pipe(const char *filename, FILE *pipe) {
   i->state = mpc_state_new();
   
   i->string = NULL;
+  i->length = 0;
   i->buffer = NULL;
   i->file = pipe;
   
   i->backtrack = 1;
   i->marks_num = 0;
+  i->marks_slots = 0;
+  i->marks_peak = 0;
+  i->marks_hwm = 0;
   i->marks = NULL;
   i->lasts = NULL;
   
   i->last = '\0';
+  i->rewinds = 0;
+  i->reparses = 0;
   
   return i;
   
@@ -391,15 +409,21 @@ static mpc_input_t *mpc_input_new_file(const char *filename, FILE *file) {
   i->state = mpc_state_new();
   
   i->string = NULL;
+  i->length = 0;
   i->buffer = NULL;
   i->file = file;
   
   i->backtrack = 1;
   i->marks_num = 0;
+  i->marks_slots = 0;
+  i->marks_peak = 0;
+  i->marks_hwm = 0;
   i->marks = NULL;
   i->lasts = NULL;
   
   i->last = '\0';
+  i->rewinds = 0;
+  i->reparses = 0;
   
   return i;
 }
@@ -408,7 +432,6 @@ static void mpc_input_delete(mpc_input_t *i) {
   
   free(i->filename);
   
-  if (i->type == MPC_INPUT_STRING) { free(i->string); }
   if (i->type == MPC_INPUT_PIPE) { free(i->buffer); }
   
   free(i->marks);
@@ -424,8 +447,12 @@ static void mpc_input_mark(mpc_input_t *i) {
   if (i->backtrack < 1) { return; }
   
   i->marks_num++;
-  i->marks = realloc(i->marks, sizeof(mpc_state_t) * i->marks_num);
-  i->lasts = realloc(i->lasts, sizeof(char) * i->marks_num);
+  if (i->marks_num > i->marks_slots) {
+    i->marks_slots = i->marks_num + i->marks_num / 2;
+    i->marks = realloc(i->marks, sizeof(mpc_state_t) * i->marks_slots);
+    i->lasts = realloc(i->lasts, sizeof(char) * i->marks_slots);
+  }
+  if (i->marks_num > i->marks_peak) { i->marks_peak = i->marks_num; }
   i->marks[i->marks_num-1] = i->state;
   i->lasts[i->marks_num-1] = i->last;
   
@@ -440,8 +467,6 @@ static void mpc_input_unmark(mpc_input_t *i) {
   if (i->backtrack < 1) { return; }
   
   i->marks_num--;
-  i->marks = realloc(i->marks, sizeof(mpc_state_t) * i->marks_num);
-  i->lasts = realloc(i->lasts, sizeof(char) * i->marks_num);
   
   if (i->type == MPC_INPUT_PIPE && i->marks_num == 0) {
     free(i->buffer);
@@ -454,6 +479,7 @@ static void mpc_input_rewind(mpc_input_t *i) {
   
   if (i->backtrack < 1) { return; }
   
+  i->rewinds++;
   i->state = i->marks[i->marks_num-1];
   i->last  = i->lasts[i->marks_num-1];
   
@@ -473,7 +499,7 @@ static char mpc_input_buffer_get(mpc_input_t *i) {
 }
 
 static int mpc_input_terminated(mpc_input_t *i) {
-  if (i->type == MPC_INPUT_STRING && i->state.pos == (long)strlen(i->string)) { return 1; }
+  if (i->type == MPC_INPUT_STRING && i->state.pos >= i->length) { return 1; }
   if (i->type == MPC_INPUT_FILE && feof(i->file)) { return 1; }
   if (i->type == MPC_INPUT_PIPE && feof(i->file)) { return 1; }
   return 0;
@@ -485,7 +511,7 @@ static char mpc_input_getc(mpc_input_t *i) {
   
   switch (i->type) {
     
-    case MPC_INPUT_STRING: return i->string[i->state.pos];
+    case MPC_INPUT_STRING: return i->state.pos < i->length ? i->string[i->state.pos] : '\0';
     case MPC_INPUT_FILE: c = fgetc(i->file); return c;
     case MPC_INPUT_PIPE:
     
@@ -508,7 +534,7 @@ static char mpc_input_peekc(mpc_input_t *i) {
   char c = '\0';
   
   switch (i->type) {
-    case MPC_INPUT_STRING: return i->string[i->state.pos];
+    case MPC_INPUT_STRING: return i->state.pos < i->length ? i->string[i->state.pos] : '\0';
     case MPC_INPUT_FILE: 
       
       c = fgetc(i->file);
@@ -610,13 +636,13 @@ static int mpc_input_range(mpc_input_t *i, char c, char d, char **o) {
 static int mpc_input_oneof(mpc_input_t *i, const char *c, char **o) {
   char x = mpc_input_getc(i);
   if (mpc_input_terminated(i)) { return 0; }
-  return strchr(c, x) != 0 ? mpc_input_success(i, x, o) : mpc_input_failure(i, x);  
+  return x != '\0' && strchr(c, x) != 0 ? mpc_input_success(i, x, o) : mpc_input_failure(i, x);  
 }
 
 static int mpc_input_noneof(mpc_input_t *i, const char *c, char **o) {
   char x = mpc_input_getc(i);
   if (mpc_input_terminated(i)) { return 0; }
-  return strchr(c, x) == 0 ? mpc_input_success(i, x, o) : mpc_input_failure(i, x);  
+  return x == '\0' || strchr(c, x) == 0 ? mpc_input_success(i, x, o) : mpc_input_failure(i, x);  
 }
 
 static int mpc_input_satisfy(mpc_input_t *i, int(*cond)(char), char **o) {
@@ -683,12 +709,14 @@ enum {
   MPC_TYPE_COUNT     = 22,
   
   MPC_TYPE_OR        = 23,
-  MPC_TYPE_AND       = 24
+  MPC_TYPE_AND       = 24,
+  
+  MPC_TYPE_DFA       = 25
 };
 
 typedef struct { char *m; } mpc_pdata_fail_t;
 typedef struct { mpc_ctor_t lf; void *x; } mpc_pdata_lift_t;
-typedef struct { mpc_parser_t *x; char *m; } mpc_pdata_expect_t;
+typedef struct { mpc_parser_t *x; char *m; int id; } mpc_pdata_expect_t;
 typedef struct { int(*f)(char,char); } mpc_pdata_anchor_t;
 typedef struct { char x; } mpc_pdata_single_t;
 typedef struct { char x; char y; } mpc_pdata_range_t;
@@ -701,6 +729,7 @@ typedef struct { mpc_parser_t *x; mpc_dtor_t dx; mpc_ctor_t lf; } mpc_pdata_not_
 typedef struct { int n; mpc_fold_t f; mpc_parser_t *x; mpc_dtor_t dx; } mpc_pdata_repeat_t;
 typedef struct { int n; mpc_parser_t **xs; } mpc_pdata_or_t;
 typedef struct { int n; mpc_fold_t f; mpc_parser_t **xs; mpc_dtor_t *dxs;  } mpc_pdata_and_t;
+typedef struct { mpc_parser_t *x; struct mpc_dfa_t *dfa; } mpc_pdata_dfa_t;
 
 typedef union {
   mpc_pdata_fail_t fail;
@@ -718,76 +747,728 @@ typedef union {
   mpc_pdata_repeat_t repeat;
   mpc_pdata_and_t and;
   mpc_pdata_or_t or;
+  mpc_pdata_dfa_t dfa;
 } mpc_pdata_t;
 
+struct mpc_program_t;
+
 struct mpc_parser_t {
   char retained;
   char *name;
   char type;
   mpc_pdata_t data;
+  struct mpc_program_t *program;
 };
 
+/*
+** Regular Parsers
+**
+** mpc_regular, which mpc_re puts around every regex, holds a DFA for the
+** parser it wraps when one can be made. The parser is turned into a
+** Thompson NFA and that into a DFA by the subset construction, all of it
+** up front: parsers are shared between threads, and a DFA built as it
+** went would be written to while others read it. A match is a loop over
+** a table that gives one string for all of it, rather than a string per
+** character folded together.
+**
+** Parsers match the way PEGs do, taking the first alternative that works
+** and repeating as often as they can without ever giving any back, where
+** a DFA finds the longest match. The two agree when every choice can be
+** made on the next character alone: alternatives start with different
+** characters and none matches nothing, and what is repeated or optional
+** cannot start like what may come after it. Anything else, anchors,
+** counts and lookahead among it, or a DFA that would be too large, gets
+** none, and is matched by its parsers. So are parses that build errors,
+** which depend on how the parsers got where they failed.
+*/
+
+#define MPC_SET_BYTES 32
+#define MPC_NFA_MAX 512
+#define MPC_DFA_MAX 256
+
+typedef struct {
+  int chars;
+  int out;
+  int out2;
+  unsigned char set[MPC_SET_BYTES];
+} mpc_nfa_state_t;
+
+typedef struct {
+  int num;
+  int slots;
+  mpc_nfa_state_t *states;
+} mpc_nfa_t;
+
+/* Transitions are by state and character, -1 where there are none */
+struct mpc_dfa_t {
+  int num;
+  int *next;
+  char *accept;
+};
+
+typedef struct mpc_dfa_t mpc_dfa_t;
+
+static int mpc_set_has(const unsigned char *set, char c) {
+  unsigned char x = (unsigned char)c;
+  return set[x / 8] & (1 << (x % 8));
+}
+
+static void mpc_set_add(unsigned char *set, char c) {
+  unsigned char x = (unsigned char)c;
+  set[x / 8] |= (unsigned char)(1 << (x % 8));
+}
+
+static int mpc_set_disjoint(const unsigned char *x, const unsigned char *y) {
+  int j;
+  for (j = 0; j < MPC_SET_BYTES; j++) {
+    if (x[j] & y[j]) { return 0; }
+  }
+  return 1;
+}
+
+/* The same tests as the mpc_input_ functions make, char for char */
+static void mpc_set_chars(unsigned char *set, mpc_parser_t *p) {
+  
+  int j;
+  
+  for (j = 0; j < 256; j++) {
+    if (p->type == MPC_TYPE_ANY ||
+        (p->type == MPC_TYPE_SINGLE ? (char)j == p->data.single.x :
+         p->type == MPC_TYPE_RANGE ? (char)j >= p->data.range.x && (char)j <= p->data.range.y :
+         (j != 0 && strchr(p->data.string.x, (char)j) != NULL) == (p->type == MPC_TYPE_ONEOF))) {
+      mpc_set_add(set, (char)j);
+    }
+  }
+}
+
+/*
+** What p can start with added to set, and whether it can match nothing,
+** or -1 if p is not made of what a DFA can stand in for: characters,
+** empty strings, and what mpcf_strfold puts together out of them.
+** Expectations only name what failed, and are looked through.
+*/
+static int mpc_regular_first(mpc_parser_t *p, unsigned char *set) {
+  
+  int j, x, nullable;
+  
+  if (p->name) { return -1; }
+  
+  switch (p->type) {
+    
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SINGLE:
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+      mpc_set_chars(set, p);
+      return 0;
+    
+    case MPC_TYPE_LIFT: return p->data.lift.lf == mpcf_ctor_str ? 1 : -1;
+    
+    case MPC_TYPE_EXPECT: return mpc_regular_first(p->data.expect.x, set);
+    
+    case MPC_TYPE_MAYBE:
+      if (p->data.not.lf != mpcf_ctor_str) { return -1; }
+      return mpc_regular_first(p->data.not.x, set) < 0 ? -1 : 1;
+    
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+      if (p->data.repeat.f != mpcf_strfold) { return -1; }
+      x = mpc_regular_first(p->data.repeat.x, set);
+      return x < 0 ? -1 : (p->type == MPC_TYPE_MANY || x);
+    
+    case MPC_TYPE_OR:
+      nullable = 0;
+      for (j = 0; j < p->data.or.n; j++) {
+        x = mpc_regular_first(p->data.or.xs[j], set);
+        if (x < 0) { return -1; }
+        nullable = nullable || x;
+      }
+      return nullable;
+    
+    case MPC_TYPE_AND:
+      if (p->data.and.f != mpcf_strfold) { return -1; }
+      for (j = 0; j < p->data.and.n; j++) {
+        x = mpc_regular_first(p->data.and.xs[j], set);
+        if (x <= 0) { return x; }
+      }
+      return 1;
+    
+    default: return -1;
+  }
+}
+
+/* Whether p matches as its DFA does when followed by what is in follow */
+static int mpc_regular_check(mpc_parser_t *p, const unsigned char *follow) {
+  
+  unsigned char first[MPC_SET_BYTES];
+  unsigned char seen[MPC_SET_BYTES];
+  unsigned char rest[MPC_SET_BYTES];
+  mpc_parser_t *c;
+  int j, k, x;
+  
+  memset(first, 0, MPC_SET_BYTES);
+  if (mpc_regular_first(p, first) < 0) { return 0; }
+  
+  switch (p->type) {
+    
+    case MPC_TYPE_EXPECT: return mpc_regular_check(p->data.expect.x, follow);
+    
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+      c = p->type == MPC_TYPE_MAYBE ? p->data.not.x : p->data.repeat.x;
+      memset(first, 0, MPC_SET_BYTES);
+      if (mpc_regular_first(c, first) != 0) { return 0; }
+      if (!mpc_set_disjoint(first, follow)) { return 0; }
+      if (p->type == MPC_TYPE_MAYBE) { return mpc_regular_check(c, follow); }
+      for (j = 0; j < MPC_SET_BYTES; j++) { first[j] |= follow[j]; }
+      return mpc_regular_check(c, first);
+    
+    case MPC_TYPE_OR:
+      memset(seen, 0, MPC_SET_BYTES);
+      for (j = 0; j < p->data.or.n; j++) {
+        memset(first, 0, MPC_SET_BYTES);
+        if (mpc_regular_first(p->data.or.xs[j], first) != 0) { return 0; }
+        if (!mpc_set_disjoint(first, seen)) { return 0; }
+        if (!mpc_regular_check(p->data.or.xs[j], follow)) { return 0; }
+        for (k = 0; k < MPC_SET_BYTES; k++) { seen[k] |= first[k]; }
+      }
+      return 1;
+    
+    case MPC_TYPE_AND:
+      memcpy(rest, follow, MPC_SET_BYTES);
+      for (j = p->data.and.n - 1; j >= 0; j--) {
+        if (!mpc_regular_check(p->data.and.xs[j], rest)) { return 0; }
+        memset(first, 0, MPC_SET_BYTES);
+        x = mpc_regular_first(p->data.and.xs[j], first);
+        if (!x) { memset(rest, 0, MPC_SET_BYTES); }
+        for (k = 0; k < MPC_SET_BYTES; k++) { rest[k] |= first[k]; }
+      }
+      return 1;
+    
+    default: return 1;
+  }
+}
+
+static int mpc_nfa_state(mpc_nfa_t *n) {
+  
+  if (n->num == MPC_NFA_MAX) { return -1; }
+  
+  if (n->num == n->slots) {
+    n->slots = n->slots ? n->slots * 2 : 32;
+    n->states = realloc(n->states, sizeof(mpc_nfa_state_t) * n->slots);
+  }
+  
+  memset(&n->states[n->num], 0, sizeof(mpc_nfa_state_t));
+  n->states[n->num].out = -1;
+  n->states[n->num].out2 = -1;
+  return n->num++;
+}
+
+/* Thompson's construction, every piece with a start and an end of its own */
+static int mpc_nfa_build(mpc_nfa_t *n, mpc_parser_t *p, int *start, int *end) {
+  
+  int j, s, e, xs, xe, at;
+  
+  if (p->type == MPC_TYPE_EXPECT) { return mpc_nfa_build(n, p->data.expect.x, start, end); }
+  
+  s = mpc_nfa_state(n);
+  e = mpc_nfa_state(n);
+  if (s < 0 || e < 0) { return 0; }
+  *start = s;
+  *end = e;
+  
+  switch (p->type) {
+    
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SINGLE:
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+      n->states[s].chars = 1;
+      mpc_set_chars(n->states[s].set, p);
+      n->states[s].out = e;
+      return 1;
+    
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+      if (!mpc_nfa_build(n, p->type == MPC_TYPE_MAYBE ? p->data.not.x : p->data.repeat.x, &xs, &xe)) { return 0; }
+      n->states[s].out = xs;
+      if (p->type != MPC_TYPE_MANY1) { n->states[s].out2 = e; }
+      n->states[xe].out = p->type == MPC_TYPE_MAYBE ? e : p->type == MPC_TYPE_MANY ? s : xs;
+      if (p->type == MPC_TYPE_MANY1) { n->states[xe].out2 = e; }
+      return 1;
+    
+    case MPC_TYPE_OR:
+      at = s;
+      for (j = 0; j < p->data.or.n; j++) {
+        if (!mpc_nfa_build(n, p->data.or.xs[j], &xs, &xe)) { return 0; }
+        n->states[xe].out = e;
+        n->states[at].out = xs;
+        if (j < p->data.or.n - 1) {
+          xs = mpc_nfa_state(n);
+          if (xs < 0) { return 0; }
+          n->states[at].out2 = xs;
+          at = xs;
+        }
+      }
+      if (p->data.or.n == 0) { n->states[s].out = e; }
+      return 1;
+    
+    case MPC_TYPE_AND:
+      at = s;
+      for (j = 0; j < p->data.and.n; j++) {
+        if (!mpc_nfa_build(n, p->data.and.xs[j], &xs, &xe)) { return 0; }
+        n->states[at].out = xs;
+        at = xe;
+      }
+      n->states[at].out = e;
+      return 1;
+    
+    default:
+      n->states[s].out = e;
+      return 1;
+  }
+}
+
+static int mpc_nfa_has(const unsigned char *set, int k) {
+  return set[k / 8] & (1 << (k % 8));
+}
+
+/* Adds every state reached from those in set without consuming anything */
+static void mpc_nfa_close(mpc_nfa_t *n, unsigned char *set, int *stack) {
+  
+  int j, k, top = 0;
+  int outs[2];
+  
+  for (j = 0; j < n->num; j++) {
+    if (mpc_nfa_has(set, j)) { stack[top++] = j; }
+  }
+  
+  while (top > 0) {
+    k = stack[--top];
+    if (n->states[k].chars) { continue; }
+    outs[0] = n->states[k].out;
+    outs[1] = n->states[k].out2;
+    for (j = 0; j < 2; j++) {
+      if (outs[j] >= 0 && !mpc_nfa_has(set, outs[j])) {
+        set[outs[j] / 8] |= (unsigned char)(1 << (outs[j] % 8));
+        stack[top++] = outs[j];
+      }
+    }
+  }
+}
+
+static void mpc_dfa_delete(mpc_dfa_t *d) {
+  if (d == NULL) { return; }
+  free(d->next);
+  free(d->accept);
+  free(d);
+}
+
+/* The subset construction, NULL if it makes more than MPC_DFA_MAX states */
+static mpc_dfa_t *mpc_dfa_build(mpc_nfa_t *n, int start, int end) {
+  
+  int bytes = (n->num + 7) / 8;
+  unsigned char *sets = calloc(MPC_DFA_MAX + 1, bytes);
+  unsigned char *to = sets + MPC_DFA_MAX * bytes;
+  int *stack = malloc(sizeof(int) * n->num);
+  int *chars = malloc(sizeof(int) * n->num);
+  mpc_dfa_t *d = calloc(1, sizeof(mpc_dfa_t));
+  int q, c, j, k, r, chars_num;
+  
+  d->next = malloc(sizeof(int) * 256 * MPC_DFA_MAX);
+  d->accept = calloc(MPC_DFA_MAX, 1);
+  
+  sets[start / 8] |= (unsigned char)(1 << (start % 8));
+  mpc_nfa_close(n, sets, stack);
+  d->num = 1;
+  
+  for (q = 0; q < d->num; q++) {
+    
+    d->accept[q] = mpc_nfa_has(sets + q * bytes, end) != 0;
+    
+    chars_num = 0;
+    for (k = 0; k < n->num; k++) {
+      if (n->states[k].chars && mpc_nfa_has(sets + q * bytes, k)) { chars[chars_num++] = k; }
+    }
+    
+    for (c = 0; c < 256; c++) {
+      
+      memset(to, 0, bytes);
+      r = 0;
+      for (j = 0; j < chars_num; j++) {
+        k = chars[j];
+        if (mpc_set_has(n->states[k].set, (char)c)) {
+          to[n->states[k].out / 8] |= (unsigned char)(1 << (n->states[k].out % 8));
+          r = 1;
+        }
+      }
+      
+      if (!r) { d->next[q * 256 + c] = -1; continue; }
+      
+      mpc_nfa_close(n, to, stack);
+      for (r = 0; r < d->num; r++) {
+        if (memcmp(sets + r * bytes, to, bytes) == 0) { break; }
+      }
+      
+      if (r == d->num) {
+        if (d->num == MPC_DFA_MAX) {
+          mpc_dfa_delete(d);
+          d = NULL;
+          goto done;
+        }
+        memcpy(sets + r * bytes, to, bytes);
+        d->num++;
+      }
+      
+      d->next[q * 256 + c] = r;
+    }
+  }
+  
+  d->next = realloc(d->next, sizeof(int) * 256 * d->num);
+  
+done:
+  free(sets);
+  free(stack);
+  free(chars);
+  return d;
+}
+
+static mpc_dfa_t *mpc_dfa_new(mpc_parser_t *p) {
+  
+  unsigned char follow[MPC_SET_BYTES];
+  mpc_nfa_t n;
+  mpc_dfa_t *d = NULL;
+  int start, end;
+  
+  memset(follow, 0, MPC_SET_BYTES);
+  if (!mpc_regular_check(p, follow)) { return NULL; }
+  
+  n.num = 0;
+  n.slots = 0;
+  n.states = NULL;
+  if (mpc_nfa_build(&n, p, &start, &end)) { d = mpc_dfa_build(&n, start, end); }
+  free(n.states);
+  return d;
+}
+
+/* The length of the longest match at the start of x, -1 if there is none */
+static long mpc_dfa_match(const mpc_dfa_t *d, const char *x, long len) {
+  
+  long j, match = d->accept[0] ? 0 : -1;
+  int q = 0;
+  
+  for (j = 0; j < len; j++) {
+    q = d->next[q * 256 + (unsigned char)x[j]];
+    if (q < 0) { break; }
+    if (d->accept[q]) { match = j + 1; }
+  }
+  
+  return match;
+}
+
+static int mpc_input_dfa(mpc_input_t *i, const mpc_dfa_t *d, char **o) {
+  
+  const char *x = i->string + i->state.pos;
+  long j, n = mpc_dfa_match(d, x, i->length - i->state.pos);
+  
+  if (n < 0) { return 0; }
+  
+  *o = malloc(n + 1);
+  memcpy(*o, x, n);
+  (*o)[n] = '\0';
+  for (j = 0; j < n; j++) { mpc_input_success(i, x[j], NULL); }
+  return 1;
+}
+
 /*
 ** Stack Type
 */
 
+/* A frame of the parsing machine, see mpc_compile */
+
+enum {
+  MPC_FRAME_CHOICE,
+  MPC_FRAME_CALL,
+  MPC_FRAME_MARK
+};
+
+struct mpc_frame_t {
+  int kind;
+  int pc;
+  int values;
+  char last;
+  mpc_state_t state;
+};
+
+typedef struct mpc_frame_t mpc_frame_t;
+
+/* Input that a value of the parsing machine stands for while it has not
+   been made into a string, len is -1 when the value is one of its own */
+
+typedef struct {
+  long pos;
+  long len;
+} mpc_span_t;
+
+
 typedef struct {
 
   int parsers_num;
   int parsers_slots;
+  int parsers_peak;
+  long parsers_hwm;
   mpc_parser_t **parsers;
   int *states;
+  long *starts;
 
   int results_num;
   int results_slots;
+  int results_peak;
+  long results_hwm;
   mpc_result_t *results;
   int *returns;
   
+  int frames_num;
+  int frames_slots;
+  int frames_peak;
+  long frames_hwm;
+  mpc_frame_t *frames;
+  
+  int values_num;
+  int values_slots;
+  int values_peak;
+  long values_hwm;
+  mpc_val_t **values;
+  mpc_dtor_t *dtors;
+  mpc_span_t *spans;
+  
   mpc_err_t *err;
   
+  int diagnose;
+  mpc_state_t expect_state;
+  char expect_recieved;
+  int expect_num;
+  int expect_slots;
+  mpc_parser_t **expects;
+  int expect_words;
+  unsigned long *expect_bits;
+  
 } mpc_stack_t;
 
-static mpc_stack_t *mpc_stack_new(const char *filename) {
-  mpc_stack_t *s = malloc(sizeof(mpc_stack_t));
+/*
+** A stack keeps its memory from one parse to the next, it only grows while
+** parsing and is trimmed in between (see mpc_trim_slots).
+*/
+
+static void mpc_stack_init(mpc_stack_t *s) {
   
   s->parsers_num = 0;
   s->parsers_slots = 0;
+  s->parsers_peak = 0;
+  s->parsers_hwm = 0;
   s->parsers = NULL;
   s->states = NULL;
+  s->starts = NULL;
   
   s->results_num = 0;
   s->results_slots = 0;
+  s->results_peak = 0;
+  s->results_hwm = 0;
   s->results = NULL;
   s->returns = NULL;
   
-  s->err = mpc_err_fail(filename, mpc_state_invalid(), "Unknown Error");
+  s->frames_num = 0;
+  s->frames_slots = 0;
+  s->frames_peak = 0;
+  s->frames_hwm = 0;
+  s->frames = NULL;
   
-  return s;
+  s->values_num = 0;
+  s->values_slots = 0;
+  s->values_peak = 0;
+  s->values_hwm = 0;
+  s->values = NULL;
+  s->dtors = NULL;
+  s->spans = NULL;
+  
+  s->err = NULL;
+  
+  s->diagnose = 1;
+  s->expect_num = 0;
+  s->expect_slots = 0;
+  s->expects = NULL;
+  s->expect_words = 0;
+  s->expect_bits = NULL;
+}
+
+/*
+** Errors are only built when a parse that fails needs them (diagnose is
+** set), which is the parse done again after one that failed without. A
+** parse that does not build them records the furthest position an
+** expect failed at, and which expects failed there, as a bit per expect
+** and a list of those in the order they failed.
+*/
+
+#define MPC_EXPECT_BITS (int)(sizeof(unsigned long) * 8)
+
+static void mpc_stack_expect_clear(mpc_stack_t *s) {
+  int j, id;
+  for (j = 0; j < s->expect_num; j++) {
+    id = s->expects[j]->data.expect.id;
+    s->expect_bits[id / MPC_EXPECT_BITS] &= ~(1UL << (id % MPC_EXPECT_BITS));
+  }
+  s->expect_num = 0;
+}
+
+static void mpc_stack_expect(mpc_stack_t *s, mpc_input_t *i, mpc_parser_t *p) {
+  
+  int id = p->data.expect.id;
+  int words = id / MPC_EXPECT_BITS + 1;
+  
+  if (i->state.pos < s->expect_state.pos) { return; }
+  
+  if (i->state.pos > s->expect_state.pos) {
+    mpc_stack_expect_clear(s);
+    s->expect_state = i->state;
+    s->expect_recieved = mpc_input_peekc(i);
+  }
+  
+  if (words > s->expect_words) {
+    s->expect_bits = realloc(s->expect_bits, sizeof(unsigned long) * words);
+    memset(s->expect_bits + s->expect_words, 0, sizeof(unsigned long) * (words - s->expect_words));
+    s->expect_words = words;
+  }
+  
+  if (s->expect_bits[id / MPC_EXPECT_BITS] & (1UL << (id % MPC_EXPECT_BITS))) { return; }
+  s->expect_bits[id / MPC_EXPECT_BITS] |= 1UL << (id % MPC_EXPECT_BITS);
+  
+  if (s->expect_num == s->expect_slots) {
+    s->expect_slots = s->expect_slots ? s->expect_slots * 2 : 8;
+    s->expects = realloc(s->expects, sizeof(mpc_parser_t*) * s->expect_slots);
+  }
+  s->expects[s->expect_num++] = p;
+}
+
+/*
+** The error out of what a parse recorded, which names what was expected
+** at the furthest point any expect failed. It is not what building the
+** errors would have given, that also takes in how the parsers around
+** those expects failed.
+*/
+static mpc_err_t *mpc_stack_expect_err(mpc_stack_t *s, const char *filename) {
+  
+  int j;
+  mpc_err_t *e;
+  
+  if (s->expect_num == 0) { return mpc_err_fail(filename, mpc_state_invalid(), "Unknown Error"); }
+  
+  e = mpc_err_new(filename, s->expect_state, s->expects[0]->data.expect.m, s->expect_recieved);
+  for (j = 1; j < s->expect_num; j++) {
+    if (!mpc_err_contains_expected(e, s->expects[j]->data.expect.m)) {
+      mpc_err_add_expected(e, s->expects[j]->data.expect.m);
+    }
+  }
+  
+  return e;
+}
+
+static void mpc_stack_start(mpc_stack_t *s, const char *filename) {
+  s->parsers_num = 0;
+  s->results_num = 0;
+  s->err = s->diagnose ? mpc_err_fail(filename, mpc_state_invalid(), "Unknown Error") : NULL;
+  s->expect_state = mpc_state_invalid();
+  mpc_stack_expect_clear(s);
+}
+
+static void mpc_stack_free(mpc_stack_t *s) {
+  free(s->parsers);
+  free(s->states);
+  free(s->starts);
+  free(s->results);
+  free(s->returns);
+  free(s->frames);
+  free(s->values);
+  free(s->dtors);
+  free(s->spans);
+  free(s->expects);
+  free(s->expect_bits);
+}
+
+/*
+** Memory kept from one parse to the next is cut back once it has been far
+** more than parses needed for a while. The high-water mark falls by an
+** eighth with every parse that stays below it, and once the slots are over
+** MPC_TRIM_FACTOR times the mark they are cut to twice the mark. Returns
+** how many slots to keep.
+*/
+
+#define MPC_TRIM_MIN 64
+#define MPC_TRIM_FACTOR 4
+
+static long mpc_trim_slots(long slots, long peak, long *hwm) {
+  *hwm -= *hwm / 8;
+  if (peak > *hwm) { *hwm = peak; }
+  if (slots <= MPC_TRIM_MIN || slots <= MPC_TRIM_FACTOR * *hwm) { return slots; }
+  return 2 * *hwm > MPC_TRIM_MIN ? 2 * *hwm : MPC_TRIM_MIN;
+}
+
+static void mpc_stack_trim(mpc_stack_t *s) {
+  
+  long n = mpc_trim_slots(s->parsers_slots, s->parsers_peak, &s->parsers_hwm);
+  if (n != s->parsers_slots) {
+    s->parsers_slots = n;
+    s->parsers = realloc(s->parsers, sizeof(mpc_parser_t*) * s->parsers_slots);
+    s->states = realloc(s->states, sizeof(int) * s->parsers_slots);
+    s->starts = realloc(s->starts, sizeof(long) * s->parsers_slots);
+  }
+  
+  n = mpc_trim_slots(s->results_slots, s->results_peak, &s->results_hwm);
+  if (n != s->results_slots) {
+    s->results_slots = n;
+    s->results = realloc(s->results, sizeof(mpc_result_t) * s->results_slots);
+    s->returns = realloc(s->returns, sizeof(int) * s->results_slots);
+  }
+  
+  n = mpc_trim_slots(s->frames_slots, s->frames_peak, &s->frames_hwm);
+  if (n != s->frames_slots) {
+    s->frames_slots = n;
+    s->frames = realloc(s->frames, sizeof(mpc_frame_t) * s->frames_slots);
+  }
+  
+  n = mpc_trim_slots(s->values_slots, s->values_peak, &s->values_hwm);
+  if (n != s->values_slots) {
+    s->values_slots = n;
+    s->values = realloc(s->values, sizeof(mpc_val_t*) * s->values_slots);
+    s->dtors = realloc(s->dtors, sizeof(mpc_dtor_t) * s->values_slots);
+    s->spans = realloc(s->spans, sizeof(mpc_span_t) * s->values_slots);
+  }
 }
 
 static void mpc_stack_err(mpc_stack_t *s, mpc_err_t* e) {
   mpc_err_t *errs[2];
+  if (!s->diagnose) { return; }
   errs[0] = s->err;
   errs[1] = e;
   s->err = mpc_err_or(errs, 2);
 }
 
-static int mpc_stack_terminate(mpc_stack_t *s, mpc_result_t *r) {
+static int mpc_stack_finish(mpc_stack_t *s, mpc_result_t *r) {
   int success = s->returns[0];
   
   if (success) {
     r->output = s->results[0].output;
-    mpc_err_delete(s->err);
+    if (s->err) { mpc_err_delete(s->err); }
   } else {
     mpc_stack_err(s, s->results[0].error);
     r->error = s->err;
   }
   
-  free(s->parsers);
-  free(s->states);
-  free(s->results);
-  free(s->returns);
-  free(s);
+  s->err = NULL;
+  s->results_num = 0;
   
   return success;
 }
@@ -803,20 +1484,14 @@ static void mpc_stack_parsers_reserve_more(mpc_stack_t *s) {
     s->parsers_slots = ceil((s->parsers_slots+1) * 1.5);
     s->parsers = realloc(s->parsers, sizeof(mpc_parser_t*) * s->parsers_slots);
     s->states = realloc(s->states, sizeof(int) * s->parsers_slots);
-  }
-}
-
-static void mpc_stack_parsers_reserve_less(mpc_stack_t *s) {
-  if (s->parsers_slots > pow(s->parsers_num+1, 1.5)) {
-    s->parsers_slots = floor((s->parsers_slots-1) * (1.0/1.5));
-    s->parsers = realloc(s->parsers, sizeof(mpc_parser_t*) * s->parsers_slots);
-    s->states = realloc(s->states, sizeof(int) * s->parsers_slots);
+    s->starts = realloc(s->starts, sizeof(long) * s->parsers_slots);
   }
 }
 
 static void mpc_stack_pushp(mpc_stack_t *s, mpc_parser_t *p) {
   s->parsers_num++;
   mpc_stack_parsers_reserve_more(s);
+  if (s->parsers_num > s->parsers_peak) { s->parsers_peak = s->parsers_num; }
   s->parsers[s->parsers_num-1] = p;
   s->states[s->parsers_num-1] = 0;
 }
@@ -825,7 +1500,6 @@ static void mpc_stack_popp(mpc_stack_t *s, mpc_parser_t **p, int *st) {
   *p = s->parsers[s->parsers_num-1];
   *st = s->states[s->parsers_num-1];
   s->parsers_num--;
-  mpc_stack_parsers_reserve_less(s);
 }
 
 static void mpc_stack_peepp(mpc_stack_t *s, mpc_parser_t **p, int *st) {
@@ -859,17 +1533,10 @@ static void mpc_stack_results_reserve_more(mpc_stack_t *s) {
   }
 }
 
-static void mpc_stack_results_reserve_less(mpc_stack_t *s) {
-  if ( s->results_slots > pow(s->results_num+1, 1.5)) {
-    s->results_slots = floor((s->results_slots-1) * (1.0/1.5));
-    s->results = realloc(s->results, sizeof(mpc_result_t) * s->results_slots);
-    s->returns = realloc(s->returns, sizeof(int) * s->results_slots);
-  }
-}
-
 static void mpc_stack_pushr(mpc_stack_t *s, mpc_result_t x, int r) {
   s->results_num++;
   mpc_stack_results_reserve_more(s);
+  if (s->results_num > s->results_peak) { s->results_peak = s->results_num; }
   s->results[s->results_num-1] = x;
   s->returns[s->results_num-1] = r;
 }
@@ -879,7 +1546,6 @@ static int mpc_stack_popr(mpc_stack_t *s, mpc_result_t *x) {
   *x = s->results[s->results_num-1];
   r = s->returns[s->results_num-1];
   s->results_num--;
-  mpc_stack_results_reserve_less(s);
   return r;
 }
 
@@ -930,11 +1596,100 @@ static mpc_val_t *mpc_stack_merger_out(mpc_stack_t *s, int n, mpc_fold_t f) {
 }
 
 static mpc_err_t *mpc_stack_merger_err(mpc_stack_t *s, int n) {
-  mpc_err_t *x = mpc_err_or((mpc_err_t**)(&s->results[s->results_num-n]), n);
+  mpc_err_t *x = s->diagnose ? mpc_err_or((mpc_err_t**)(&s->results[s->results_num-n]), n) : NULL;
   mpc_stack_popr_n(s, n);
   return x;
 }
 
+/*
+** Packrat Memo
+**
+** Every entry is a result of a named parser at some position, or is
+** free when it has no parser. A failure holds no output, the input is
+** back where it started by the time a parser fails.
+*/
+
+struct mpc_memo_entry_t {
+  mpc_parser_t *p;
+  long pos;
+  int success;
+  mpc_state_t end;
+  char last;
+  mpc_val_t *output;
+};
+
+typedef struct mpc_memo_entry_t mpc_memo_entry_t;
+
+mpc_memo_t *mpc_memo_new(int slots, mpc_copy_t copy, mpc_dtor_t dtor) {
+  
+  mpc_memo_t *m = malloc(sizeof(mpc_memo_t));
+  
+  m->slots = 1;
+  while (m->slots < slots) { m->slots *= 2; }
+  
+  m->copy = copy;
+  m->dtor = dtor;
+  m->entries = calloc(m->slots, sizeof(mpc_memo_entry_t));
+  m->used = 0;
+  
+  m->hits = 0;
+  m->misses = 0;
+  m->evictions = 0;
+  m->reparses = 0;
+  
+  return m;
+}
+
+static void mpc_memo_clear(mpc_memo_t *m) {
+  
+  int j;
+  
+  if (m->used == 0) { return; }
+  
+  for (j = 0; j < m->slots; j++) {
+    if (m->entries[j].p && m->entries[j].success) { m->dtor(m->entries[j].output); }
+    m->entries[j].p = NULL;
+  }
+  
+  m->used = 0;
+}
+
+void mpc_memo_delete(mpc_memo_t *m) {
+  mpc_memo_clear(m);
+  free(m->entries);
+  free(m);
+}
+
+static mpc_memo_entry_t *mpc_memo_slot(mpc_memo_t *m, mpc_parser_t *p, long pos) {
+  unsigned long h = ((unsigned long)(size_t)p >> 4) ^ ((unsigned long)pos * 2654435761UL);
+  h ^= h >> 15;
+  return &m->entries[h & (unsigned long)(m->slots - 1)];
+}
+
+/* Parsers that pass on the result of another are left to that one */
+static int mpc_memo_wants(mpc_input_t *i, mpc_parser_t *p) {
+  return p->name && p->type != MPC_TYPE_PREDICT && i->backtrack > 0 && i->type == MPC_INPUT_STRING;
+}
+
+static void mpc_memo_store(mpc_memo_t *m, mpc_parser_t *p, long pos, mpc_input_t *i, int success, mpc_val_t *x) {
+  
+  mpc_memo_entry_t *e = mpc_memo_slot(m, p, pos);
+  
+  if (e->p) {
+    if (e->success) { m->dtor(e->output); }
+    m->evictions++;
+  } else {
+    m->used++;
+  }
+  
+  e->p = p;
+  e->pos = pos;
+  e->success = success;
+  e->end = i->state;
+  e->last = i->last;
+  e->output = success ? m->copy(x) : NULL;
+}
+
 /*
 ** This is rather pleasant. The core parsing routine
 ** is written in about 200 lines of C.
@@ -957,28 +1712,59 @@ static mpc_err_t *mpc_stack_merger_err(mpc_stack_t *s, int n) {
 */
 
 #define MPC_CONTINUE(st, x) mpc_stack_set_state(stk, st); mpc_stack_pushp(stk, x); continue
-#define MPC_SUCCESS(x) mpc_stack_popp(stk, &p, &st); mpc_stack_pushr(stk, mpc_result_out(x), 1); continue
-#define MPC_FAILURE(x) mpc_stack_popp(stk, &p, &st); mpc_stack_pushr(stk, mpc_result_err(x), 0); continue
-#define MPC_PRIMITIVE(x, f) if (f) { MPC_SUCCESS(x); } else { MPC_FAILURE(mpc_err_fail(i->filename, i->state, "Incorrect Input")); }
+#define MPC_MEMO(ok, x) if (memo && stk->starts[stk->parsers_num-1] >= 0) { mpc_memo_store(memo, p, stk->starts[stk->parsers_num-1], i, ok, x); }
+#define MPC_SUCCESS(x) { mpc_val_t *mpc_x = (x); MPC_MEMO(1, mpc_x); mpc_stack_popp(stk, &p, &st); mpc_stack_pushr(stk, mpc_result_out(mpc_x), 1); continue; }
+#define MPC_FAILURE(x) { mpc_err_t *mpc_e = (x); MPC_MEMO(0, NULL); mpc_stack_popp(stk, &p, &st); mpc_stack_pushr(stk, mpc_result_err(mpc_e), 0); continue; }
+#define MPC_ERR(x) (stk->diagnose ? (x) : NULL)
+#define MPC_PRIMITIVE(x, f) if (f) { MPC_SUCCESS(x); } else { MPC_FAILURE(MPC_ERR(mpc_err_fail(i->filename, i->state, "Incorrect Input"))); }
 
-int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
+static int mpc_parse_run(mpc_input_t *i, mpc_stack_t *stk, mpc_parser_t *init, mpc_result_t *final, mpc_memo_t *memo) {
   
   /* Stack */
   int st = 0;
   mpc_parser_t *p = NULL;
-  mpc_stack_t *stk = mpc_stack_new(i->filename);
   
   /* Variables */
   char *s;
   mpc_result_t r;
+  mpc_memo_entry_t *e;
 
   /* Go! */
+  mpc_stack_start(stk, i->filename);
   mpc_stack_pushp(stk, init);
   
   while (!mpc_stack_empty(stk)) {
     
     mpc_stack_peepp(stk, &p, &st);
     
+    /* Packrat: a parser tried here before gets its result back */
+    
+    if (memo && st == 0) {
+      
+      stk->starts[stk->parsers_num-1] = -1;
+      
+      if (mpc_memo_wants(i, p)) {
+        
+        e = mpc_memo_slot(memo, p, i->state.pos);
+        
+        if (e->p == p && e->pos == i->state.pos) {
+          memo->hits++;
+          mpc_stack_popp(stk, &p, &st);
+          if (e->success) {
+            i->state = e->end;
+            i->last = e->last;
+            mpc_stack_pushr(stk, mpc_result_out(memo->copy(e->output)), 1);
+          } else {
+            mpc_stack_pushr(stk, mpc_result_err(MPC_ERR(mpc_err_fail(i->filename, i->state, "Incorrect Input"))), 0);
+          }
+          continue;
+        }
+        
+        memo->misses++;
+        stk->starts[stk->parsers_num-1] = i->state.pos;
+      }
+    }
+    
     switch (p->type) {
       
       /* Basic Parsers */
@@ -993,9 +1779,9 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
       
       /* Other parsers */
       
-      case MPC_TYPE_UNDEFINED: MPC_FAILURE(mpc_err_fail(i->filename, i->state, "Parser Undefined!"));      
+      case MPC_TYPE_UNDEFINED: MPC_FAILURE(MPC_ERR(mpc_err_fail(i->filename, i->state, "Parser Undefined!")));
       case MPC_TYPE_PASS:      MPC_SUCCESS(NULL);
-      case MPC_TYPE_FAIL:      MPC_FAILURE(mpc_err_fail(i->filename, i->state, p->data.fail.m));
+      case MPC_TYPE_FAIL:      MPC_FAILURE(MPC_ERR(mpc_err_fail(i->filename, i->state, p->data.fail.m)));
       case MPC_TYPE_LIFT:      MPC_SUCCESS(p->data.lift.lf());
       case MPC_TYPE_LIFT_VAL:  MPC_SUCCESS(p->data.lift.x);
       case MPC_TYPE_STATE:     MPC_SUCCESS(mpc_state_copy(i->state));
@@ -1004,7 +1790,7 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
         if (mpc_input_anchor(i, p->data.anchor.f)) {
           MPC_SUCCESS(NULL);
         } else {
-          MPC_FAILURE(mpc_err_new(i->filename, i->state, "anchor", mpc_input_peekc(i)));
+          MPC_FAILURE(MPC_ERR(mpc_err_new(i->filename, i->state, "anchor", mpc_input_peekc(i))));
         }
       
       /* Application Parsers */
@@ -1015,6 +1801,7 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
           if (mpc_stack_popr(stk, &r)) {
             MPC_SUCCESS(r.output);
           } else {
+            if (!stk->diagnose) { mpc_stack_expect(stk, i, p); MPC_FAILURE(NULL); }
             mpc_err_delete(r.error); 
             MPC_FAILURE(mpc_err_new(i->filename, i->state, p->data.expect.m, mpc_input_peekc(i)));
           }
@@ -1040,6 +1827,24 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
           }
         }
       
+      /* Errors come out of the parsers, so only a parse that builds none
+         matches by the DFA */
+      
+      case MPC_TYPE_DFA:
+        if (st == 0) {
+          if (p->data.dfa.dfa && !stk->diagnose && i->type == MPC_INPUT_STRING && i->backtrack > 0) {
+            MPC_PRIMITIVE(s, mpc_input_dfa(i, p->data.dfa.dfa, &s));
+          }
+          MPC_CONTINUE(1, p->data.dfa.x);
+        }
+        if (st == 1) {
+          if (mpc_stack_popr(stk, &r)) {
+            MPC_SUCCESS(r.output);
+          } else {
+            MPC_FAILURE(r.error);
+          }
+        }
+      
       case MPC_TYPE_PREDICT:
         if (st == 0) { mpc_input_backtrack_disable(i); MPC_CONTINUE(1, p->data.predict.x); }
         if (st == 1) {
@@ -1058,7 +1863,7 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
           if (mpc_stack_popr(stk, &r)) {
             mpc_input_rewind(i);
             p->data.not.dx(r.output);
-            MPC_FAILURE(mpc_err_new(i->filename, i->state, "opposite", mpc_input_peekc(i)));
+            MPC_FAILURE(MPC_ERR(mpc_err_new(i->filename, i->state, "opposite", mpc_input_peekc(i))));
           } else {
             mpc_input_unmark(i);
             mpc_stack_err(stk, r.error);
@@ -1099,7 +1904,7 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
           } else {
             if (st == 1) {
               mpc_stack_popr(stk, &r);
-              MPC_FAILURE(mpc_err_many1(r.error));
+              MPC_FAILURE(MPC_ERR(mpc_err_many1(r.error)));
             } else {
               mpc_stack_popr(stk, &r);
               mpc_stack_err(stk, r.error);
@@ -1118,7 +1923,7 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
               mpc_stack_popr(stk, &r);
               mpc_stack_popr_out_single(stk, st-1, p->data.repeat.dx);
               mpc_input_rewind(i);
-              MPC_FAILURE(mpc_err_count(r.error, p->data.repeat.n));
+              MPC_FAILURE(MPC_ERR(mpc_err_count(r.error, p->data.repeat.n)));
             } else {
               mpc_stack_popr(stk, &r);
               mpc_stack_err(stk, r.error);
@@ -1145,44 +1950,1105 @@ int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
           if (st == p->data.or.n) { MPC_FAILURE(mpc_stack_merger_err(stk, p->data.or.n)); }
         }
       
-      case MPC_TYPE_AND:
-        
-        if (p->data.and.n == 0) { MPC_SUCCESS(p->data.and.f(0, NULL)); }
-        
-        if (st == 0) { mpc_input_mark(i); MPC_CONTINUE(st+1, p->data.and.xs[st]); }
-        if (st <= p->data.and.n) {
-          if (!mpc_stack_peekr(stk, &r)) {
-            mpc_input_rewind(i);
-            mpc_stack_popr(stk, &r);
-            mpc_stack_popr_out(stk, st-1, p->data.and.dxs);
-            MPC_FAILURE(r.error);
-          }
-          if (st <  p->data.and.n) { MPC_CONTINUE(st+1, p->data.and.xs[st]); }
-          if (st == p->data.and.n) { mpc_input_unmark(i); MPC_SUCCESS(mpc_stack_merger_out(stk, p->data.and.n, p->data.and.f)); }
-        }
+      case MPC_TYPE_AND:
+        
+        if (p->data.and.n == 0) { MPC_SUCCESS(p->data.and.f(0, NULL)); }
+        
+        if (st == 0) { mpc_input_mark(i); MPC_CONTINUE(st+1, p->data.and.xs[st]); }
+        if (st <= p->data.and.n) {
+          if (!mpc_stack_peekr(stk, &r)) {
+            mpc_input_rewind(i);
+            mpc_stack_popr(stk, &r);
+            mpc_stack_popr_out(stk, st-1, p->data.and.dxs);
+            MPC_FAILURE(r.error);
+          }
+          if (st <  p->data.and.n) { MPC_CONTINUE(st+1, p->data.and.xs[st]); }
+          if (st == p->data.and.n) { mpc_input_unmark(i); MPC_SUCCESS(mpc_stack_merger_out(stk, p->data.and.n, p->data.and.f)); }
+        }
+      
+      /* End */
+      
+      default:
+        
+        MPC_FAILURE(MPC_ERR(mpc_err_fail(i->filename, i->state, "Unknown Parser Type Id!")));
+    }
+  }
+  
+  return mpc_stack_finish(stk, final);
+  
+}
+
+#undef MPC_CONTINUE
+#undef MPC_MEMO
+#undef MPC_SUCCESS
+#undef MPC_FAILURE
+#undef MPC_ERR
+#undef MPC_PRIMITIVE
+
+/*
+** Parsing Machine
+**
+** mpc_compile lowers a parser and every parser it reaches into one array
+** of instructions for a small machine in the style of LPeg's parsing
+** machines, which does what walking the parsers would do without chasing
+** pointers through them. Named parsers become subroutines, called with
+** CALL, and everything else is laid out inline.
+**
+** The machine has a stack of frames and a stack of values. A CHOICE frame
+** holds where to go on failure and the input and number of values to go
+** back to, a CALL frame where to return to, and a MARK frame where the
+** values of a repetition start. A failure pops frames up to the nearest
+** CHOICE and goes back to it, destroying the values pushed since with
+** the destructor each was given by the `and` or `count` it belongs to.
+**
+** `and` needs no frame of its own: whatever catches its failure goes back
+** at least as far as where it started. So the input is gone back over
+** less often than by mpc_parse_run, and the backtracks counted differ,
+** but the outputs are the same. Failures build no errors at all, a parse
+** the machine fails is done again by mpc_parse_run for its error.
+**
+** Before an alternative of an `or`, and before each go of a `maybe` or a
+** repetition, a TEST_SET looks at the next character and skips what cannot
+** start with it, without pushing a frame or calling anything. What can
+** start what is worked out beforehand, see FIRST Sets below.
+*/
+
+enum {
+  MPC_OP_END,
+  MPC_OP_FAIL,
+  MPC_OP_ANY,
+  MPC_OP_CHAR,
+  MPC_OP_SET,
+  MPC_OP_SATISFY,
+  MPC_OP_STRING,
+  MPC_OP_DFA,
+  MPC_OP_ANCHOR,
+  MPC_OP_PASS,
+  MPC_OP_LIFT,
+  MPC_OP_LIFT_VAL,
+  MPC_OP_STATE,
+  MPC_OP_APPLY,
+  MPC_OP_APPLY_TO,
+  MPC_OP_DTOR,
+  MPC_OP_FOLD,
+  MPC_OP_MARK,
+  MPC_OP_FOLD_MANY,
+  MPC_OP_FOLD_MANY1,
+  MPC_OP_FOLD_COUNT,
+  MPC_OP_CHOICE,
+  MPC_OP_COMMIT,
+  MPC_OP_PARTIAL_COMMIT,
+  MPC_OP_FAIL_TWICE,
+  MPC_OP_TEST_SET,
+  MPC_OP_CALL,
+  MPC_OP_RET
+};
+
+typedef struct {
+  int op;
+  int arg;
+  int set;
+  union {
+    unsigned char *set;
+    char *string;
+    mpc_dfa_t *dfa;
+    mpc_val_t *val;
+    mpc_dtor_t dtor;
+    mpc_ctor_t lift;
+    mpc_apply_t apply;
+    mpc_apply_to_t apply_to;
+    mpc_fold_t fold;
+    int(*satisfy)(char);
+    int(*anchor)(char,char);
+  } u;
+  void *data;
+} mpc_instr_t;
+
+struct mpc_program_t {
+  mpc_instr_t *code;
+  int code_num;
+  int code_slots;
+  unsigned char *sets;
+  int sets_num;
+  char **strings;
+  int strings_num;
+  mpc_parser_t **subs;
+  int *subs_pc;
+  int subs_num;
+  struct mpc_first_t **firsts;
+  int firsts_slots;
+  int firsts_num;
+};
+
+typedef struct mpc_program_t mpc_program_t;
+
+static void mpc_first_clear(mpc_program_t *g);
+
+static void mpc_program_delete(mpc_program_t *g) {
+  
+  int j;
+  
+  if (g == NULL) { return; }
+  
+  mpc_first_clear(g);
+  for (j = 0; j < g->strings_num; j++) { free(g->strings[j]); }
+  free(g->strings);
+  free(g->code);
+  free(g->sets);
+  free(g->subs);
+  free(g->subs_pc);
+  free(g);
+}
+
+static int mpc_program_emit(mpc_program_t *g, int op, int arg) {
+  
+  mpc_instr_t *c;
+  
+  if (g->code_num == g->code_slots) {
+    g->code_slots = g->code_slots ? g->code_slots * 2 : 64;
+    g->code = realloc(g->code, sizeof(mpc_instr_t) * g->code_slots);
+  }
+  
+  c = &g->code[g->code_num];
+  memset(c, 0, sizeof(mpc_instr_t));
+  c->op = op;
+  c->arg = arg;
+  return g->code_num++;
+}
+
+static mpc_instr_t *mpc_program_add(mpc_program_t *g, int op, int arg) {
+  int pc = mpc_program_emit(g, op, arg);
+  return &g->code[pc];
+}
+
+/* A set of characters to match, in the pool, by its index */
+static int mpc_program_set(mpc_program_t *g) {
+  g->sets = realloc(g->sets, MPC_SET_BYTES * (g->sets_num + 1));
+  memset(g->sets + MPC_SET_BYTES * g->sets_num, 0, MPC_SET_BYTES);
+  return g->sets_num++;
+}
+
+static unsigned char *mpc_program_set_at(mpc_program_t *g, int set) {
+  return g->sets + MPC_SET_BYTES * set;
+}
+
+
+static int mpc_program_sub(mpc_program_t *g, mpc_parser_t *p) {
+  
+  int j;
+  for (j = 0; j < g->subs_num; j++) {
+    if (g->subs[j] == p) { return j; }
+  }
+  
+  g->subs = realloc(g->subs, sizeof(mpc_parser_t*) * (g->subs_num + 1));
+  g->subs_pc = realloc(g->subs_pc, sizeof(int) * (g->subs_num + 1));
+  g->subs[g->subs_num] = p;
+  g->subs_pc[g->subs_num] = -1;
+  return g->subs_num++;
+}
+
+/*
+** FIRST Sets
+**
+** For every parser, the characters the first one it consumes can be, and
+** whether it can succeed without consuming any, in which case it is
+** nullable. Both only ever say too much: a parser the analysis cannot see
+** into can start with anything and is nullable, and so is one met again
+** while its own set is still being worked out, which is only the case for
+** left recursion. A parser that is not nullable cannot succeed on a
+** character outside its set, nor at the end of the input.
+*/
+
+typedef struct mpc_first_t {
+  mpc_parser_t *p;
+  int done;
+  int nullable;
+  unsigned char set[MPC_SET_BYTES];
+} mpc_first_t;
+
+static mpc_first_t mpc_first_anything = {
+  NULL, 1, 1, {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }
+};
+
+static void mpc_first_clear(mpc_program_t *g) {
+  int j;
+  for (j = 0; j < g->firsts_slots; j++) { free(g->firsts[j]); }
+  free(g->firsts);
+  g->firsts = NULL;
+  g->firsts_slots = 0;
+  g->firsts_num = 0;
+}
+
+static unsigned long mpc_first_hash(mpc_parser_t *p) {
+  unsigned long h = (unsigned long)p;
+  return (h >> 4) ^ (h >> 12);
+}
+
+/* Open addressing on the parser, kept at most half full */
+static mpc_first_t **mpc_first_slot(mpc_program_t *g, mpc_parser_t *p) {
+  
+  unsigned long h = mpc_first_hash(p);
+  mpc_first_t **old;
+  int j, slots;
+  
+  if (2 * (g->firsts_num + 1) > g->firsts_slots) {
+    old = g->firsts;
+    slots = g->firsts_slots;
+    g->firsts_slots = slots ? slots * 2 : 64;
+    g->firsts = calloc(g->firsts_slots, sizeof(mpc_first_t*));
+    for (j = 0; j < slots; j++) {
+      if (old[j]) { *mpc_first_slot(g, old[j]->p) = old[j]; }
+    }
+    free(old);
+  }
+  
+  for (j = h & (g->firsts_slots - 1); g->firsts[j]; j = (j + 1) & (g->firsts_slots - 1)) {
+    if (g->firsts[j]->p == p) { break; }
+  }
+  return &g->firsts[j];
+}
+
+static void mpc_first_union(mpc_first_t *f, mpc_first_t *x) {
+  int j;
+  for (j = 0; j < MPC_SET_BYTES; j++) { f->set[j] |= x->set[j]; }
+  f->nullable = f->nullable || x->nullable;
+}
+
+static mpc_first_t *mpc_first(mpc_program_t *g, mpc_parser_t *p) {
+  
+  mpc_first_t **slot = mpc_first_slot(g, p);
+  mpc_first_t *f, *x;
+  int j;
+  
+  if (*slot) { return (*slot)->done ? *slot : &mpc_first_anything; }
+  
+  f = calloc(1, sizeof(mpc_first_t));
+  f->p = p;
+  *slot = f;
+  g->firsts_num++;
+  
+  switch (p->type) {
+    
+    case MPC_TYPE_UNDEFINED:
+    case MPC_TYPE_FAIL: break;
+    
+    case MPC_TYPE_PASS:
+    case MPC_TYPE_LIFT:
+    case MPC_TYPE_LIFT_VAL:
+    case MPC_TYPE_STATE:
+    case MPC_TYPE_ANCHOR:
+    case MPC_TYPE_NOT: f->nullable = 1; break;
+    
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SATISFY: memset(f->set, 0xFF, MPC_SET_BYTES); break;
+    
+    case MPC_TYPE_SINGLE:
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF: mpc_set_chars(f->set, p); break;
+    
+    case MPC_TYPE_STRING:
+      if (p->data.string.x[0]) { mpc_set_add(f->set, p->data.string.x[0]); }
+      else { f->nullable = 1; }
+      break;
+    
+    case MPC_TYPE_EXPECT:   mpc_first_union(f, mpc_first(g, p->data.expect.x)); break;
+    case MPC_TYPE_DFA:      mpc_first_union(f, mpc_first(g, p->data.dfa.x)); break;
+    case MPC_TYPE_APPLY:    mpc_first_union(f, mpc_first(g, p->data.apply.x)); break;
+    case MPC_TYPE_APPLY_TO: mpc_first_union(f, mpc_first(g, p->data.apply_to.x)); break;
+    case MPC_TYPE_PREDICT:  mpc_first_union(f, mpc_first(g, p->data.predict.x)); break;
+    
+    case MPC_TYPE_MAYBE:
+      mpc_first_union(f, mpc_first(g, p->data.not.x));
+      f->nullable = 1;
+      break;
+    
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      mpc_first_union(f, mpc_first(g, p->data.repeat.x));
+      if (p->type == MPC_TYPE_MANY || (p->type == MPC_TYPE_COUNT && p->data.repeat.n == 0)) { f->nullable = 1; }
+      break;
+    
+    case MPC_TYPE_OR:
+      if (p->data.or.n == 0) { f->nullable = 1; }
+      for (j = 0; j < p->data.or.n; j++) { mpc_first_union(f, mpc_first(g, p->data.or.xs[j])); }
+      break;
+    
+    case MPC_TYPE_AND:
+      f->nullable = 1;
+      for (j = 0; j < p->data.and.n && f->nullable; j++) {
+        x = mpc_first(g, p->data.and.xs[j]);
+        f->nullable = 0;
+        mpc_first_union(f, x);
+      }
+      break;
+    
+    default: mpc_first_union(f, &mpc_first_anything); break;
+  }
+  
+  f->done = 1;
+  return f;
+}
+
+/*
+** Goes to target, or fails when it is -1, if p cannot start with the next
+** character. Emits nothing for what is nullable, which can start with
+** anything.
+*/
+static int mpc_compile_test(mpc_program_t *g, mpc_parser_t *p, int target) {
+  
+  mpc_first_t *f = mpc_first(g, p);
+  int set, pc;
+  
+  if (f->nullable) { return -1; }
+  
+  set = mpc_program_set(g);
+  memcpy(mpc_program_set_at(g, set), f->set, MPC_SET_BYTES);
+  pc = mpc_program_emit(g, MPC_OP_TEST_SET, target);
+  g->code[pc].set = set;
+  return pc;
+}
+
+static int mpc_compile_body(mpc_program_t *g, mpc_parser_t *p);
+
+/* Named parsers are called, and compiled once each as a subroutine */
+static int mpc_compile_parser(mpc_program_t *g, mpc_parser_t *p) {
+  if (p->name) {
+    mpc_program_emit(g, MPC_OP_CALL, mpc_program_sub(g, p));
+    return 1;
+  }
+  return mpc_compile_body(g, p);
+}
+
+static int mpc_compile_body(mpc_program_t *g, mpc_parser_t *p) {
+  
+  int j, k, set, loop, choice, test;
+  int *commits;
+  const char *x;
+  
+  switch (p->type) {
+    
+    case MPC_TYPE_UNDEFINED:
+    case MPC_TYPE_FAIL:     mpc_program_emit(g, MPC_OP_FAIL, 0); return 1;
+    case MPC_TYPE_PASS:     mpc_program_emit(g, MPC_OP_PASS, 0); return 1;
+    case MPC_TYPE_STATE:    mpc_program_emit(g, MPC_OP_STATE, 0); return 1;
+    case MPC_TYPE_ANY:      mpc_program_emit(g, MPC_OP_ANY, 0); return 1;
+    case MPC_TYPE_SINGLE:   mpc_program_emit(g, MPC_OP_CHAR, p->data.single.x); return 1;
+    
+    case MPC_TYPE_LIFT:     mpc_program_add(g, MPC_OP_LIFT, 0)->u.lift = p->data.lift.lf; return 1;
+    case MPC_TYPE_LIFT_VAL: mpc_program_add(g, MPC_OP_LIFT_VAL, 0)->u.val = p->data.lift.x; return 1;
+    case MPC_TYPE_ANCHOR:   mpc_program_add(g, MPC_OP_ANCHOR, 0)->u.anchor = p->data.anchor.f; return 1;
+    case MPC_TYPE_SATISFY:  mpc_program_add(g, MPC_OP_SATISFY, 0)->u.satisfy = p->data.satisfy.f; return 1;
+    
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+      set = mpc_program_set(g);
+      mpc_set_chars(mpc_program_set_at(g, set), p);
+      mpc_program_add(g, MPC_OP_SET, 0)->set = set;
+      return 1;
+    
+    case MPC_TYPE_STRING:
+      x = p->data.string.x;
+      g->strings = realloc(g->strings, sizeof(char*) * (g->strings_num + 1));
+      g->strings[g->strings_num] = malloc(strlen(x) + 1);
+      strcpy(g->strings[g->strings_num], x);
+      mpc_program_add(g, MPC_OP_STRING, strlen(x))->u.string = g->strings[g->strings_num++];
+      return 1;
+    
+    /* Expectations only matter to errors */
+    
+    case MPC_TYPE_EXPECT: return mpc_compile_parser(g, p->data.expect.x);
+    
+    case MPC_TYPE_DFA:
+      if (!p->data.dfa.dfa) { return mpc_compile_parser(g, p->data.dfa.x); }
+      mpc_program_add(g, MPC_OP_DFA, 0)->u.dfa = p->data.dfa.dfa;
+      return 1;
+    
+    case MPC_TYPE_APPLY:
+      if (!mpc_compile_parser(g, p->data.apply.x)) { return 0; }
+      mpc_program_add(g, MPC_OP_APPLY, 0)->u.apply = p->data.apply.f;
+      return 1;
+    
+    case MPC_TYPE_APPLY_TO:
+      if (!mpc_compile_parser(g, p->data.apply_to.x)) { return 0; }
+      j = mpc_program_emit(g, MPC_OP_APPLY_TO, 0);
+      g->code[j].u.apply_to = p->data.apply_to.f;
+      g->code[j].data = p->data.apply_to.d;
+      return 1;
+    
+    case MPC_TYPE_NOT:
+      choice = mpc_program_emit(g, MPC_OP_CHOICE, 0);
+      if (!mpc_compile_parser(g, p->data.not.x)) { return 0; }
+      mpc_program_add(g, MPC_OP_DTOR, 0)->u.dtor = p->data.not.dx;
+      mpc_program_emit(g, MPC_OP_FAIL_TWICE, 0);
+      g->code[choice].arg = g->code_num;
+      mpc_program_add(g, MPC_OP_LIFT, 0)->u.lift = p->data.not.lf;
+      return 1;
+    
+    case MPC_TYPE_MAYBE:
+      test = mpc_compile_test(g, p->data.not.x, 0);
+      choice = mpc_program_emit(g, MPC_OP_CHOICE, 0);
+      if (!mpc_compile_parser(g, p->data.not.x)) { return 0; }
+      k = mpc_program_emit(g, MPC_OP_COMMIT, 0);
+      g->code[choice].arg = g->code_num;
+      if (test >= 0) { g->code[test].arg = g->code_num; }
+      mpc_program_add(g, MPC_OP_LIFT, 0)->u.lift = p->data.not.lf;
+      g->code[k].arg = g->code_num;
+      return 1;
+    
+    /* Every parser that succeeds pushes one value, so a repetition counts
+       what it matched by the values above its mark. The test of a go that
+       cannot start leaves the loop through a COMMIT of its frame. */
+    
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      mpc_program_emit(g, MPC_OP_MARK, 0);
+      loop = mpc_program_emit(g, MPC_OP_CHOICE, 0);
+      test = mpc_compile_test(g, p->data.repeat.x, 0);
+      if (!mpc_compile_parser(g, p->data.repeat.x)) { return 0; }
+      if (p->type == MPC_TYPE_COUNT) {
+        mpc_program_add(g, MPC_OP_DTOR, 0)->u.dtor = p->data.repeat.dx;
+      }
+      mpc_program_emit(g, MPC_OP_PARTIAL_COMMIT, loop + 1);
+      if (test >= 0) {
+        g->code[test].arg = g->code_num;
+        mpc_program_emit(g, MPC_OP_COMMIT, g->code_num + 1);
+      }
+      g->code[loop].arg = g->code_num;
+      j = mpc_program_emit(g,
+        p->type == MPC_TYPE_MANY ? MPC_OP_FOLD_MANY :
+        p->type == MPC_TYPE_MANY1 ? MPC_OP_FOLD_MANY1 : MPC_OP_FOLD_COUNT, p->data.repeat.n);
+      g->code[j].u.fold = p->data.repeat.f;
+      return 1;
+    
+    case MPC_TYPE_OR:
+      
+      if (p->data.or.n == 0) { mpc_program_emit(g, MPC_OP_PASS, 0); return 1; }
       
-      /* End */
+      commits = malloc(sizeof(int) * p->data.or.n);
+      for (j = 0; j < p->data.or.n - 1; j++) {
+        test = mpc_compile_test(g, p->data.or.xs[j], 0);
+        choice = mpc_program_emit(g, MPC_OP_CHOICE, 0);
+        if (!mpc_compile_parser(g, p->data.or.xs[j])) { free(commits); return 0; }
+        commits[j] = mpc_program_emit(g, MPC_OP_COMMIT, 0);
+        g->code[choice].arg = g->code_num;
+        if (test >= 0) { g->code[test].arg = g->code_num; }
+      }
+      mpc_compile_test(g, p->data.or.xs[j], -1);
+      if (!mpc_compile_parser(g, p->data.or.xs[j])) { free(commits); return 0; }
+      for (j = 0; j < p->data.or.n - 1; j++) { g->code[commits[j]].arg = g->code_num; }
+      free(commits);
+      return 1;
+    
+    case MPC_TYPE_AND:
+      for (j = 0; j < p->data.and.n; j++) {
+        if (!mpc_compile_parser(g, p->data.and.xs[j])) { return 0; }
+        if (j < p->data.and.n - 1) {
+          mpc_program_add(g, MPC_OP_DTOR, 0)->u.dtor = p->data.and.dxs[j];
+        }
+      }
+      mpc_program_add(g, MPC_OP_FOLD, p->data.and.n)->u.fold = p->data.and.f;
+      return 1;
+    
+    /* Turning off backtracking is left to mpc_parse_run */
+    
+    default: return 0;
+  }
+}
+
+int mpc_compile(mpc_parser_t *p) {
+  
+  int j;
+  mpc_program_t *g = calloc(1, sizeof(mpc_program_t));
+  
+  mpc_program_emit(g, MPC_OP_CALL, mpc_program_sub(g, p));
+  mpc_program_emit(g, MPC_OP_END, 0);
+  
+  for (j = 0; j < g->subs_num; j++) {
+    g->subs_pc[j] = g->code_num;
+    if (!mpc_compile_body(g, g->subs[j])) {
+      mpc_program_delete(g);
+      return 0;
+    }
+    mpc_program_emit(g, MPC_OP_RET, 0);
+  }
+  
+  for (j = 0; j < g->code_num; j++) {
+    if (g->code[j].op == MPC_OP_CALL) { g->code[j].arg = g->subs_pc[g->code[j].arg]; }
+    if (g->code[j].op == MPC_OP_SET || g->code[j].op == MPC_OP_TEST_SET) { g->code[j].u.set = mpc_program_set_at(g, g->code[j].set); }
+  }
+  
+  mpc_first_clear(g);
+  
+  mpc_program_delete(p->program);
+  p->program = g;
+  return 1;
+}
+
+static mpc_frame_t *mpc_machine_push_frame(mpc_stack_t *s, int kind) {
+  if (s->frames_num == s->frames_slots) {
+    s->frames_slots = s->frames_slots ? s->frames_slots * 2 : 32;
+    s->frames = realloc(s->frames, sizeof(mpc_frame_t) * s->frames_slots);
+  }
+  if (s->frames_num >= s->frames_peak) { s->frames_peak = s->frames_num + 1; }
+  s->frames[s->frames_num].kind = kind;
+  return &s->frames[s->frames_num++];
+}
+
+static void mpc_machine_reserve_values(mpc_stack_t *s) {
+  if (s->values_num == s->values_slots) {
+    s->values_slots = s->values_slots ? s->values_slots * 2 : 32;
+    s->values = realloc(s->values, sizeof(mpc_val_t*) * s->values_slots);
+    s->dtors = realloc(s->dtors, sizeof(mpc_dtor_t) * s->values_slots);
+    s->spans = realloc(s->spans, sizeof(mpc_span_t) * s->values_slots);
+  }
+}
+
+static void mpc_machine_push_value(mpc_stack_t *s, mpc_val_t *x) {
+  mpc_machine_reserve_values(s);
+  if (s->values_num >= s->values_peak) { s->values_peak = s->values_num + 1; }
+  s->values[s->values_num] = x;
+  s->dtors[s->values_num] = NULL;
+  s->spans[s->values_num].len = -1;
+  s->values_num++;
+}
+
+/*
+** What characters and strings match is pushed as a span of the input and
+** only made into a string once something wants it as one. Folding spans
+** next to each other with mpcf_strfold gives one span, mpcf_free throws a
+** span away and mpcf_str_ast copies it straight into its node, so most
+** of what matches is copied once or not at all.
+*/
+
+static void mpc_machine_push_span(mpc_stack_t *s, long pos, long len) {
+  mpc_machine_push_value(s, NULL);
+  s->spans[s->values_num-1].pos = pos;
+  s->spans[s->values_num-1].len = len;
+}
+
+static mpc_val_t *mpc_machine_value(mpc_stack_t *s, const char *str, int k) {
+  
+  mpc_span_t span = s->spans[k];
+  char *x;
+  
+  if (span.len < 0) { return s->values[k]; }
+  
+  x = malloc(span.len + 1);
+  memcpy(x, str + span.pos, span.len);
+  x[span.len] = '\0';
+  s->values[k] = x;
+  s->spans[k].len = -1;
+  return x;
+}
+
+static void mpc_machine_drop_values(mpc_stack_t *s, int n) {
+  while (s->values_num > n) {
+    s->values_num--;
+    if (s->spans[s->values_num].len >= 0) { continue; }
+    if (s->dtors[s->values_num]) { s->dtors[s->values_num](s->values[s->values_num]); }
+  }
+}
+
+static mpc_ast_t *mpc_ast_new_n(const char *tag, const char *contents, long len);
+
+static void mpc_machine_apply(mpc_stack_t *s, const char *str, mpc_apply_t f) {
+  
+  int k = s->values_num - 1;
+  mpc_span_t span = s->spans[k];
+  
+  if (span.len >= 0 && f == mpcf_free) {
+    s->values[k] = NULL;
+    s->spans[k].len = -1;
+  } else if (span.len >= 0 && f == mpcf_str_ast) {
+    s->values[k] = mpc_ast_new_n("", str + span.pos, span.len);
+    s->spans[k].len = -1;
+  } else {
+    s->values[k] = f(mpc_machine_value(s, str, k));
+  }
+}
+
+/* Folds the n values from base into one, which is at pos when n is 0 */
+static void mpc_machine_fold(mpc_stack_t *s, const char *str, mpc_fold_t f, int base, int n, long pos) {
+  
+  mpc_span_t *spans = s->spans + base;
+  long len = 0;
+  int j;
+  
+  if (f == mpcf_strfold) {
+    for (j = 0; j < n; j++) {
+      if (spans[j].len < 0 || spans[j].pos != spans[0].pos + len) { break; }
+      len += spans[j].len;
+    }
+    if (j == n) {
+      if (n > 0) { pos = spans[0].pos; }
+      s->values_num = base;
+      mpc_machine_push_span(s, pos, len);
+      return;
+    }
+  }
+  
+  for (j = 0; j < n; j++) { mpc_machine_value(s, str, base + j); }
+  s->values_num = base;
+  mpc_machine_push_value(s, f(n, s->values + base));
+}
+
+/*
+** Runs a program over a string input. The dispatch is direct threaded
+** through computed gotos where the compiler has them, and a switch
+** elsewhere.
+*/
+
+#define MPC_MACHINE_ADVANCE(c) \
+  last = (c); state.pos++; state.col++; \
+  if ((c) == '\n') { state.col = 0; state.row++; }
+
+#if defined(__GNUC__)
+#define MPC_MACHINE_OP(x) mpc_op_##x:
+#define MPC_MACHINE_NEXT(n) { pc = (n); op = &code[pc]; goto *mpc_machine_ops[op->op]; }
+#else
+#define MPC_MACHINE_OP(x) case MPC_OP_##x:
+#define MPC_MACHINE_NEXT(n) { pc = (n); op = &code[pc]; goto dispatch; }
+#endif
+
+static int mpc_machine_run(mpc_input_t *i, mpc_stack_t *s, mpc_program_t *g, mpc_result_t *final) {
+  
+  const mpc_instr_t *code = g->code;
+  const mpc_instr_t *op;
+  const char *str = i->string;
+  long len = i->length;
+  mpc_state_t state = i->state;
+  char last = i->last;
+  int pc = 0;
+  
+  mpc_frame_t *f;
+  mpc_val_t *x;
+  char c;
+  int n;
+  long m;
+  
+#if defined(__GNUC__)
+  static void *mpc_machine_ops[] = {
+    &&mpc_op_END, &&mpc_op_FAIL, &&mpc_op_ANY, &&mpc_op_CHAR, &&mpc_op_SET,
+    &&mpc_op_SATISFY, &&mpc_op_STRING, &&mpc_op_DFA, &&mpc_op_ANCHOR, &&mpc_op_PASS,
+    &&mpc_op_LIFT, &&mpc_op_LIFT_VAL, &&mpc_op_STATE, &&mpc_op_APPLY,
+    &&mpc_op_APPLY_TO, &&mpc_op_DTOR, &&mpc_op_FOLD, &&mpc_op_MARK,
+    &&mpc_op_FOLD_MANY, &&mpc_op_FOLD_MANY1, &&mpc_op_FOLD_COUNT,
+    &&mpc_op_CHOICE, &&mpc_op_COMMIT, &&mpc_op_PARTIAL_COMMIT,
+    &&mpc_op_FAIL_TWICE, &&mpc_op_TEST_SET, &&mpc_op_CALL, &&mpc_op_RET
+  };
+#endif
+  
+  /* folds of nothing are still handed an array, as mpc_parse_run does */
+  s->frames_num = 0;
+  s->values_num = 0;
+  mpc_machine_reserve_values(s);
+  
+  MPC_MACHINE_NEXT(0);
+  
+#if !defined(__GNUC__)
+  dispatch:
+  switch (op->op) {
+#endif
+    
+    MPC_MACHINE_OP(END)
+      i->state = state;
+      i->last = last;
+      final->output = mpc_machine_value(s, str, 0);
+      s->values_num = 0;
+      return 1;
+    
+    MPC_MACHINE_OP(FAIL)
+      goto fail;
+    
+    /* Matching */
+    
+    MPC_MACHINE_OP(ANY)
+      if (state.pos == len) { goto fail; }
+      c = str[state.pos];
+      mpc_machine_push_span(s, state.pos, 1);
+      MPC_MACHINE_ADVANCE(c);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(CHAR)
+      if (state.pos == len || str[state.pos] != (char)op->arg) { goto fail; }
+      c = str[state.pos];
+      mpc_machine_push_span(s, state.pos, 1);
+      MPC_MACHINE_ADVANCE(c);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(SET)
+      if (state.pos == len) { goto fail; }
+      c = str[state.pos];
+      if (!(op->u.set[(unsigned char)c / 8] & (1 << ((unsigned char)c % 8)))) { goto fail; }
+      mpc_machine_push_span(s, state.pos, 1);
+      MPC_MACHINE_ADVANCE(c);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(SATISFY)
+      if (state.pos == len || !op->u.satisfy(str[state.pos])) { goto fail; }
+      c = str[state.pos];
+      mpc_machine_push_span(s, state.pos, 1);
+      MPC_MACHINE_ADVANCE(c);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(STRING)
+      if (len - state.pos < op->arg || memcmp(str + state.pos, op->u.string, op->arg) != 0) { goto fail; }
+      mpc_machine_push_span(s, state.pos, op->arg);
+      for (n = 0; n < op->arg; n++) {
+        c = op->u.string[n];
+        MPC_MACHINE_ADVANCE(c);
+      }
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(DFA)
+      m = mpc_dfa_match(op->u.dfa, str + state.pos, len - state.pos);
+      if (m < 0) { goto fail; }
+      mpc_machine_push_span(s, state.pos, m);
+      while (m-- > 0) {
+        c = str[state.pos];
+        MPC_MACHINE_ADVANCE(c);
+      }
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(ANCHOR)
+      if (!op->u.anchor(last, state.pos < len ? str[state.pos] : '\0')) { goto fail; }
+      mpc_machine_push_value(s, NULL);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    /* Values */
+    
+    MPC_MACHINE_OP(PASS)
+      mpc_machine_push_value(s, NULL);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(LIFT)
+      if (op->u.lift == mpcf_ctor_str) {
+        mpc_machine_push_span(s, state.pos, 0);
+      } else {
+        mpc_machine_push_value(s, op->u.lift());
+      }
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(LIFT_VAL)
+      mpc_machine_push_value(s, op->u.val);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(STATE)
+      mpc_machine_push_value(s, mpc_state_copy(state));
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(APPLY)
+      mpc_machine_apply(s, str, op->u.apply);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(APPLY_TO)
+      x = mpc_machine_value(s, str, s->values_num-1);
+      s->values[s->values_num-1] = op->u.apply_to(x, op->data);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(DTOR)
+      s->dtors[s->values_num-1] = op->u.dtor;
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(FOLD)
+      mpc_machine_fold(s, str, op->u.fold, s->values_num - op->arg, op->arg, state.pos);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(MARK)
+      mpc_machine_push_frame(s, MPC_FRAME_MARK)->values = s->values_num;
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(FOLD_MANY)
+    MPC_MACHINE_OP(FOLD_MANY1)
+    MPC_MACHINE_OP(FOLD_COUNT)
+      f = &s->frames[--s->frames_num];
+      n = s->values_num - f->values;
+      if (op->op == MPC_OP_FOLD_MANY1 && n == 0) { goto fail; }
+      if (op->op == MPC_OP_FOLD_COUNT && n != op->arg) { goto fail; }
+      mpc_machine_fold(s, str, op->u.fold, f->values, n, state.pos);
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    /* Control */
+    
+    MPC_MACHINE_OP(CHOICE)
+      f = mpc_machine_push_frame(s, MPC_FRAME_CHOICE);
+      f->pc = op->arg;
+      f->values = s->values_num;
+      f->state = state;
+      f->last = last;
+      MPC_MACHINE_NEXT(pc + 1);
+    
+    MPC_MACHINE_OP(COMMIT)
+      s->frames_num--;
+      MPC_MACHINE_NEXT(op->arg);
+    
+    MPC_MACHINE_OP(PARTIAL_COMMIT)
+      f = &s->frames[s->frames_num-1];
+      f->values = s->values_num;
+      f->state = state;
+      f->last = last;
+      MPC_MACHINE_NEXT(op->arg);
+    
+    MPC_MACHINE_OP(FAIL_TWICE)
+      f = &s->frames[--s->frames_num];
+      if (f->state.pos != state.pos) { i->rewinds++; }
+      state = f->state;
+      last = f->last;
+      mpc_machine_drop_values(s, f->values);
+      goto fail;
+    
+    MPC_MACHINE_OP(TEST_SET)
+      if (state.pos < len) {
+        c = str[state.pos];
+        if (op->u.set[(unsigned char)c / 8] & (1 << ((unsigned char)c % 8))) { MPC_MACHINE_NEXT(pc + 1); }
+      }
+      if (op->arg < 0) { goto fail; }
+      MPC_MACHINE_NEXT(op->arg);
+    
+    MPC_MACHINE_OP(CALL)
+      mpc_machine_push_frame(s, MPC_FRAME_CALL)->pc = pc + 1;
+      MPC_MACHINE_NEXT(op->arg);
+    
+    MPC_MACHINE_OP(RET)
+      f = &s->frames[--s->frames_num];
+      MPC_MACHINE_NEXT(f->pc);
+    
+    fail:
+      while (s->frames_num > 0) {
+        f = &s->frames[--s->frames_num];
+        if (f->kind != MPC_FRAME_CHOICE) { continue; }
+        if (f->state.pos != state.pos) { i->rewinds++; }
+        state = f->state;
+        last = f->last;
+        mpc_machine_drop_values(s, f->values);
+        MPC_MACHINE_NEXT(f->pc);
+      }
       
-      default:
-        
-        MPC_FAILURE(mpc_err_fail(i->filename, i->state, "Unknown Parser Type Id!"));
+      mpc_machine_drop_values(s, 0);
+      i->state = state;
+      i->last = last;
+      return 0;
+    
+#if !defined(__GNUC__)
+  }
+  return 0;
+#endif
+}
+
+#undef MPC_MACHINE_ADVANCE
+#undef MPC_MACHINE_OP
+#undef MPC_MACHINE_NEXT
+
+/*
+** Strings are first parsed without building errors, by the program of the
+** parser when it has been compiled and by mpc_parse_run otherwise, and
+** only if that fails are they parsed again building them, unless the
+** flags say they are not wanted. Other inputs cannot be gone over twice
+** and build their errors as they go.
+*/
+static int mpc_parse_lazy(mpc_input_t *i, mpc_stack_t *stk, mpc_parser_t *init, mpc_result_t *final, mpc_memo_t *memo, int flags) {
+  
+  int x;
+  
+  stk->parsers_peak = 0;
+  stk->results_peak = 0;
+  stk->frames_peak = 0;
+  stk->values_peak = 0;
+  
+  if (i->type != MPC_INPUT_STRING) {
+    stk->diagnose = 1;
+    return mpc_parse_run(i, stk, init, final, memo);
+  }
+  
+  stk->diagnose = 0;
+  
+  if (init->program && !memo && !(flags & MPC_PARSE_NO_MACHINE)) {
+    if (mpc_machine_run(i, stk, init->program, final)) { return 1; }
+  } else {
+    if (mpc_parse_run(i, stk, init, final, memo)) { return 1; }
+    if (flags & MPC_PARSE_NO_DIAGNOSTICS) {
+      final->error = mpc_stack_expect_err(stk, i->filename);
+      return 0;
     }
+    if (memo) { memo->reparses++; }
   }
   
-  return mpc_stack_terminate(stk, final);
+  i->reparses++;
+  i->state = mpc_state_new();
+  i->backtrack = 1;
+  i->marks_num = 0;
+  i->last = '\0';
   
+  stk->diagnose = !(flags & MPC_PARSE_NO_DIAGNOSTICS);
+  x = mpc_parse_run(i, stk, init, final, NULL);
+  if (!x && !stk->diagnose) { final->error = mpc_stack_expect_err(stk, i->filename); }
+  return x;
 }
 
-#undef MPC_CONTINUE
-#undef MPC_SUCCESS
-#undef MPC_FAILURE
-#undef MPC_PRIMITIVE
+static int mpc_parse_input_memo(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final, mpc_memo_t *memo) {
+  int x;
+  mpc_stack_t stk;
+  mpc_stack_init(&stk);
+  x = mpc_parse_lazy(i, &stk, init, final, memo, MPC_PARSE_DEFAULT);
+  mpc_stack_free(&stk);
+  return x;
+}
+
+int mpc_parse_input(mpc_input_t *i, mpc_parser_t *init, mpc_result_t *final) {
+  return mpc_parse_input_memo(i, init, final, NULL);
+}
+
+int mpc_parse_n(const char *filename, const char *string, long length, mpc_parser_t *p, mpc_result_t *r) {
+  int x;
+  mpc_input_t *i = mpc_input_new_string(filename, string, length);
+  x = mpc_parse_input(i, p, r);
+  mpc_input_delete(i);
+  return x;
+}
 
 int mpc_parse(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r) {
+  return mpc_parse_n(filename, string, (long)strlen(string), p, r);
+}
+
+int mpc_parse_stats(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_stats_t *stats) {
   int x;
-  mpc_input_t *i = mpc_input_new_string(filename, string);
+  mpc_input_t *i = mpc_input_new_string(filename, string, (long)strlen(string));
   x = mpc_parse_input(i, p, r);
+  stats->parses++;
+  stats->backtracks += i->rewinds;
+  stats->reparses += i->reparses;
+  mpc_input_delete(i);
+  return x;
+}
+
+int mpc_parse_memo(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_memo_t *m) {
+  int x;
+  mpc_input_t *i = mpc_input_new_string(filename, string, (long)strlen(string));
+  x = mpc_parse_input_memo(i, p, r, m);
   mpc_input_delete(i);
+  mpc_memo_clear(m);
+  return x;
+}
+
+/*
+** Parse Context
+**
+** An input and a stack that are used over again, along with a copy of
+** the filename. The string being parsed is the caller's.
+*/
+
+struct mpc_parse_ctx_t {
+  mpc_input_t input;
+  long filename_slots;
+  mpc_stack_t stack;
+  int flags;
+};
+
+mpc_parse_ctx_t *mpc_parse_ctx_new(void) {
+  
+  mpc_parse_ctx_t *c = malloc(sizeof(mpc_parse_ctx_t));
+  mpc_input_t *i = &c->input;
+  
+  i->type = MPC_INPUT_STRING;
+  i->filename = NULL;
+  i->state = mpc_state_new();
+  
+  i->string = NULL;
+  i->length = 0;
+  i->buffer = NULL;
+  i->file = NULL;
+  
+  i->backtrack = 1;
+  i->marks_num = 0;
+  i->marks_slots = 0;
+  i->marks_peak = 0;
+  i->marks_hwm = 0;
+  i->marks = NULL;
+  i->lasts = NULL;
+  
+  i->last = '\0';
+  i->rewinds = 0;
+  i->reparses = 0;
+  
+  c->filename_slots = 0;
+  mpc_stack_init(&c->stack);
+  c->flags = MPC_PARSE_DEFAULT;
+  
+  return c;
+}
+
+void mpc_parse_ctx_set_flags(mpc_parse_ctx_t *c, int flags) {
+  c->flags = flags;
+}
+
+void mpc_parse_ctx_delete(mpc_parse_ctx_t *c) {
+  free(c->input.filename);
+  free(c->input.marks);
+  free(c->input.lasts);
+  mpc_stack_free(&c->stack);
+  free(c);
+}
+
+/* Copies s into buf, which only grows */
+static char *mpc_parse_ctx_copy(char *buf, long *slots, const char *s, long len) {
+  if (len + 1 > *slots) {
+    *slots = len + 1 > *slots * 2 ? len + 1 : *slots * 2;
+    buf = realloc(buf, *slots);
+  }
+  memcpy(buf, s, len + 1);
+  return buf;
+}
+
+static void mpc_parse_ctx_trim(mpc_parse_ctx_t *c) {
+  
+  mpc_input_t *i = &c->input;
+  long n;
+  
+  mpc_stack_trim(&c->stack);
+  
+  n = mpc_trim_slots(i->marks_slots, i->marks_peak, &i->marks_hwm);
+  if (n != i->marks_slots) {
+    i->marks_slots = n;
+    i->marks = realloc(i->marks, sizeof(mpc_state_t) * i->marks_slots);
+    i->lasts = realloc(i->lasts, sizeof(char) * i->marks_slots);
+  }
+}
+
+int mpc_parse_with_ctx(mpc_parse_ctx_t *c, const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_stats_t *stats) {
+  
+  int x;
+  mpc_input_t *i = &c->input;
+  
+  i->filename = mpc_parse_ctx_copy(i->filename, &c->filename_slots, filename, strlen(filename));
+  i->string = string;
+  i->length = (long)strlen(string);
+  
+  i->state = mpc_state_new();
+  i->backtrack = 1;
+  i->marks_num = 0;
+  i->marks_peak = 0;
+  i->last = '\0';
+  i->rewinds = 0;
+  i->reparses = 0;
+  
+  x = mpc_parse_lazy(i, &c->stack, p, r, NULL, c->flags);
+  
+  if (stats) {
+    stats->parses++;
+    stats->backtracks += i->rewinds;
+    stats->reparses += i->reparses;
+  }
+  
+  i->string = NULL;
+  mpc_parse_ctx_trim(c);
   return x;
 }
 
@@ -1249,6 +3115,9 @@ static void mpc_undefine_unretained(mpc_parser_t *p, int force) {
   
   if (p->retained && !force) { return; }
   
+  mpc_program_delete(p->program);
+  p->program = NULL;
+  
   switch (p->type) {
     
     case MPC_TYPE_FAIL: free(p->data.fail.m); break;
@@ -1263,6 +3132,11 @@ static void mpc_undefine_unretained(mpc_parser_t *p, int force) {
     case MPC_TYPE_APPLY_TO: mpc_undefine_unretained(p->data.apply_to.x, 0); break;
     case MPC_TYPE_PREDICT:  mpc_undefine_unretained(p->data.predict.x, 0);  break;
     
+    case MPC_TYPE_DFA:
+      mpc_undefine_unretained(p->data.dfa.x, 0);
+      mpc_dfa_delete(p->data.dfa.dfa);
+      break;
+    
     case MPC_TYPE_MAYBE:
     case MPC_TYPE_NOT:
       mpc_undefine_unretained(p->data.not.x, 0);
@@ -1299,6 +3173,7 @@ void mpc_delete(mpc_parser_t *p) {
       mpc_undefine_unretained(p, 0);
     } 
     
+    mpc_program_delete(p->program);
     free(p->name);
     free(p);
   
@@ -1336,6 +3211,8 @@ mpc_parser_t *mpc_undefine(mpc_parser_t *p) {
 mpc_parser_t *mpc_define(mpc_parser_t *p, mpc_parser_t *a) {
   
   if (p->retained) {
+    mpc_program_delete(p->program);
+    p->program = NULL;
     p->type = a->type;
     p->data = a->data;
   } else {
@@ -1345,6 +3222,7 @@ mpc_parser_t *mpc_define(mpc_parser_t *p, mpc_parser_t *a) {
     free(a2);
   }
   
+  mpc_program_delete(a->program);
   free(a);
   return p;  
 }
@@ -1443,10 +3321,19 @@ mpc_parser_t *mpc_state(void) {
   return p;
 }
 
+/*
+** Every expect is numbered as it is made, that number is its bit in the
+** sets of what was expected that parses record (see mpc_stack_expect).
+** Like the rest of building parsers, it is not for several threads at once.
+*/
+
+static int mpc_expect_ids = 0;
+
 mpc_parser_t *mpc_expect(mpc_parser_t *a, const char *expected) {
   mpc_parser_t *p = mpc_undefined();
   p->type = MPC_TYPE_EXPECT;
   p->data.expect.x = a;
+  p->data.expect.id = mpc_expect_ids++;
   p->data.expect.m = malloc(strlen(expected) + 1);
   strcpy(p->data.expect.m, expected);
   return p;
@@ -1487,6 +3374,7 @@ mpc_parser_t *mpc_expectf(mpc_parser_t *a, const char *fmt, ...) {
   buffer = realloc(buffer, strlen(buffer) + 1);
   p->data.expect.x = a;
   p->data.expect.m = buffer;
+  p->data.expect.id = mpc_expect_ids++;
   return p;
 }
 
@@ -1575,6 +3463,14 @@ mpc_parser_t *mpc_predictive(mpc_parser_t *a) {
   return p;
 }
 
+mpc_parser_t *mpc_regular(mpc_parser_t *a) {
+  mpc_parser_t *p = mpc_undefined();
+  p->type = MPC_TYPE_DFA;
+  p->data.dfa.x = a;
+  p->data.dfa.dfa = mpc_dfa_new(a);
+  return p;
+}
+
 mpc_parser_t *mpc_not_lift(mpc_parser_t *a, mpc_dtor_t da, mpc_ctor_t lf) {
   mpc_parser_t *p = mpc_undefined();
   p->type = MPC_TYPE_NOT;
@@ -2060,7 +3956,7 @@ mpc_parser_t *mpc_re(const char *re) {
   mpc_delete(RegexEnclose);
   mpc_cleanup(5, Regex, Term, Factor, Base, Range);
   
-  return r.output;
+  return mpc_regular(r.output);
   
 }
 
@@ -2261,13 +4157,19 @@ mpc_val_t *mpcf_snd_free(int n, mpc_val_t **xs) { return mpcf_nth_free(n, xs, 1)
 mpc_val_t *mpcf_trd_free(int n, mpc_val_t **xs) { return mpcf_nth_free(n, xs, 2); }
 
 mpc_val_t *mpcf_strfold(int n, mpc_val_t **xs) {
-  char *x = calloc(1, 1);
+  char *x;
+  size_t len = 0, l;
   int i;
+  for (i = 0; i < n; i++) { len += strlen(xs[i]); }
+  x = malloc(len + 1);
+  len = 0;
   for (i = 0; i < n; i++) {
-    x = realloc(x, strlen(x) + strlen(xs[i]) + 1);
-    strcat(x, xs[i]);
+    l = strlen(xs[i]);
+    memcpy(x + len, xs[i], l);
+    len += l;
     free(xs[i]);
   }
+  x[len] = '\0';
   return x;
 }
 
@@ -2374,6 +4276,7 @@ static void mpc_print_unretained(mpc_parser_t *p, int force) {
   if (p->type == MPC_TYPE_APPLY)    { mpc_print_unretained(p->data.apply.x, 0); }
   if (p->type == MPC_TYPE_APPLY_TO) { mpc_print_unretained(p->data.apply_to.x, 0); }
   if (p->type == MPC_TYPE_PREDICT)  { mpc_print_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)      { mpc_print_unretained(p->data.dfa.x, 0); }
 
   if (p->type == MPC_TYPE_NOT)   { mpc_print_unretained(p->data.not.x, 0); printf("!"); }
   if (p->type == MPC_TYPE_MAYBE) { mpc_print_unretained(p->data.not.x, 0); printf("?"); }
@@ -2495,6 +4398,27 @@ void mpc_ast_delete(mpc_ast_t *a) {
   
 }
 
+mpc_ast_t *mpc_ast_copy(mpc_ast_t *a) {
+  
+  int i;
+  mpc_ast_t *c;
+  
+  if (a == NULL) { return NULL; }
+  
+  c = mpc_ast_new(a->tag, a->contents);
+  c->state = a->state;
+  c->children_num = a->children_num;
+  
+  if (a->children_num > 0) {
+    c->children = malloc(sizeof(mpc_ast_t*) * a->children_num);
+    for (i = 0; i < a->children_num; i++) {
+      c->children[i] = mpc_ast_copy(a->children[i]);
+    }
+  }
+  
+  return c;
+}
+
 static void mpc_ast_delete_no_children(mpc_ast_t *a) {
   free(a->children);
   free(a->tag);
@@ -2502,15 +4426,16 @@ static void mpc_ast_delete_no_children(mpc_ast_t *a) {
   free(a);
 }
 
-mpc_ast_t *mpc_ast_new(const char *tag, const char *contents) {
+static mpc_ast_t *mpc_ast_new_n(const char *tag, const char *contents, long len) {
   
   mpc_ast_t *a = malloc(sizeof(mpc_ast_t));
   
   a->tag = malloc(strlen(tag) + 1);
   strcpy(a->tag, tag);
   
-  a->contents = malloc(strlen(contents) + 1);
-  strcpy(a->contents, contents);
+  a->contents = malloc(len + 1);
+  memcpy(a->contents, contents, len);
+  a->contents[len] = '\0';
   
   a->state = mpc_state_new();
   
@@ -2520,6 +4445,10 @@ mpc_ast_t *mpc_ast_new(const char *tag, const char *contents) {
   
 }
 
+mpc_ast_t *mpc_ast_new(const char *tag, const char *contents) {
+  return mpc_ast_new_n(tag, contents, (long)strlen(contents));
+}
+
 mpc_ast_t *mpc_ast_build(int n, const char *tag, ...) {
   
   mpc_ast_t *a = mpc_ast_new(tag, "");
@@ -3184,7 +5113,7 @@ mpc_err_t *mpca_lang(int flags, const char *language, ...) {
   st.parsers = NULL;
   st.flags = flags;
   
-  i = mpc_input_new_string("<mpca_lang>", language);
+  i = mpc_input_new_string("<mpca_lang>", language, (long)strlen(language));
   err = mpca_lang_st(i, &st);
   mpc_input_delete(i);
   
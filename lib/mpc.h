@@ -47,6 +47,14 @@ void mpc_err_print_to(mpc_err_t *e, FILE *f);
 
 /*
 ** Parsing
+**
+** Parsing is reentrant. All state of a parse lives in the input it
+** creates, and the parser graph is only ever read, so any number of
+** threads may parse with the same parsers at the same time without
+** locking. This holds as long as nothing defines, undefines, optimises
+** or deletes those parsers meanwhile, and as long as any apply or fold
+** function attached to them is itself reentrant, which is true of all
+** the mpcf_ functions.
 */
 
 typedef void mpc_val_t;
@@ -61,6 +69,67 @@ typedef struct mpc_parser_t mpc_parser_t;
 
 int mpc_parse(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r);
 int mpc_parse_file(const char *filename, FILE *file, mpc_parser_t *p, mpc_result_t *r);
+
+/*
+** mpc_parse_n parses the length bytes at string, which need not end in a
+** NUL and may hold them. Neither it nor mpc_parse copies the string, it
+** only has to outlive the call. Anchors such as mpc_eoi are handed a NUL
+** at the end of the input, and cannot tell one inside it from the end.
+*/
+
+int mpc_parse_n(const char *filename, const char *string, long length, mpc_parser_t *p, mpc_result_t *r);
+
+/*
+** Errors are only built for parses that fail. A string is parsed without
+** them first, and when that fails it is parsed again building them, so a
+** failure costs about two parses. Files and pipes build them as they go.
+*/
+
+/*
+** Like mpc_parse, adding to stats as it goes. A backtrack is every time
+** the input is rewound to try again from an earlier position, a reparse
+** every time a failed parse is done again for its error.
+*/
+
+typedef struct {
+  unsigned long parses;
+  unsigned long backtracks;
+  unsigned long reparses;
+} mpc_stats_t;
+
+int mpc_parse_stats(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_stats_t *stats);
+
+/*
+** A parse context holds on to the memory a parse works with, its stacks
+** and a copy of the filename, so that parsing one string after another with
+** it allocates next to nothing once it has seen inputs of that size. That
+** memory only grows during a parse and is given back between parses once
+** it has been far more than was needed for a while.
+**
+** A context is for one parse at a time, so one per thread. stats may be
+** NULL.
+**
+** With MPC_PARSE_NO_DIAGNOSTICS a failed parse is not done again, and its
+** error only names what was expected at the furthest point that anything
+** was, which is cheap but not always what mpc_parse would have said.
+** MPC_PARSE_NO_MACHINE parses a compiled parser (see mpc_compile) without
+** its program.
+*/
+
+enum {
+  MPC_PARSE_DEFAULT        = 0,
+  MPC_PARSE_NO_DIAGNOSTICS = 1,
+  MPC_PARSE_NO_MACHINE     = 2
+};
+
+struct mpc_parse_ctx_t;
+typedef struct mpc_parse_ctx_t mpc_parse_ctx_t;
+
+mpc_parse_ctx_t *mpc_parse_ctx_new(void);
+void mpc_parse_ctx_delete(mpc_parse_ctx_t *c);
+void mpc_parse_ctx_set_flags(mpc_parse_ctx_t *c, int flags);
+
+int mpc_parse_with_ctx(mpc_parse_ctx_t *c, const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_stats_t *stats);
 int mpc_parse_pipe(const char *filename, FILE *pipe, mpc_parser_t *p, mpc_result_t *r);
 int mpc_parse_contents(const char *filename, mpc_parser_t *p, mpc_result_t *r);
 
@@ -74,6 +143,81 @@ typedef mpc_val_t*(*mpc_ctor_t)(void);
 typedef mpc_val_t*(*mpc_apply_t)(mpc_val_t*);
 typedef mpc_val_t*(*mpc_apply_to_t)(mpc_val_t*,void*);
 typedef mpc_val_t*(*mpc_fold_t)(int,mpc_val_t**);
+typedef mpc_val_t*(*mpc_copy_t)(mpc_val_t*);
+
+/*
+** Packrat Parsing
+**
+** Like mpc_parse, but remembering what every named parser (one made with
+** mpc_new) did at each position of the input, so that when backtracking
+** tries it at the same position again the result is handed back instead
+** of being parsed a second time. That bounds the work of grammars which
+** would otherwise backtrack into the same rules over and over.
+**
+** Results are kept in a direct mapped table of a fixed number of slots,
+** which is all the memory it ever takes beyond the outputs it holds. A
+** result that lands in a slot already in use evicts whatever was there.
+** Outputs are copied both into the table and out of it, with the copy
+** and destructor functions given, since folds may change or free what
+** they are passed. For ASTs those are mpc_ast_copy and mpc_ast_delete.
+**
+** Only successful parses are the same as mpc_parse gives. Remembered
+** failures skip the errors that would have been collected along the way,
+** so when the whole parse fails it is done again without the table, as
+** any failed parse is for its error.
+**
+** The table is emptied after every parse and may be used for one parse
+** at a time only, one per thread. Parsers with apply functions that are
+** not pure, or that depend on more than their input, must not be used
+** with it.
+*/
+
+struct mpc_memo_entry_t;
+
+typedef struct {
+  int slots;
+  mpc_copy_t copy;
+  mpc_dtor_t dtor;
+  struct mpc_memo_entry_t *entries;
+  int used;
+  
+  unsigned long hits;
+  unsigned long misses;
+  unsigned long evictions;
+  unsigned long reparses;
+} mpc_memo_t;
+
+mpc_memo_t *mpc_memo_new(int slots, mpc_copy_t copy, mpc_dtor_t dtor);
+void mpc_memo_delete(mpc_memo_t *m);
+
+int mpc_parse_memo(const char *filename, const char *string, mpc_parser_t *p, mpc_result_t *r, mpc_memo_t *m);
+
+/*
+** Compiled Parsing
+**
+** mpc_compile turns a finished parser, and all it refers to, into a flat
+** program for a parsing machine which the parser keeps. From then on
+** parses of strings with it run that program, giving the same outputs
+** without going through the parsers one by one, and a parse it fails is
+** done again the usual way for its error. Files and pipes, and packrat
+** parses, still go through the parsers.
+**
+** Compiling also works out which characters each parser can start with,
+** so that alternatives and repetitions which cannot start with the next
+** character are skipped without being tried.
+**
+** The machine keeps what matches as places in the input and only copies
+** it out when a function other than mpcf_strfold, mpcf_free or
+** mpcf_str_ast is handed it, so strings folded together are copied once.
+**
+** Returns 0, and leaves the parser as it was, when it reaches parsers that
+** disable backtracking (mpc_predictive), which the machine does not do.
+** The program is dropped when the parser is undefined, defined again or
+** deleted. Redefining any other parser it reaches leaves the program as it
+** was, so compile once a grammar is complete.
+*/
+
+int mpc_compile(mpc_parser_t *p);
 
 /*
 ** Building a Parser
@@ -243,9 +387,17 @@ mpc_val_t *mpcf_maths(int n, mpc_val_t** xs);
 
 /*
 ** Regular Expression Parsers
+**
+** mpc_re builds a regex out of the parsers above and hands it to
+** mpc_regular, which gives it a DFA as well when the regex is one a DFA
+** matches alike: no anchors or counts, and every choice made by the next
+** character. Parses of strings that build no errors then match it in one
+** go, everything else goes through its parsers. mpc_regular takes any
+** parser built that way, characters folded with mpcf_strfold.
 */
 
 mpc_parser_t *mpc_re(const char *re);
+mpc_parser_t *mpc_regular(mpc_parser_t *a);
   
 /*
 ** AST
@@ -266,6 +418,7 @@ mpc_ast_t *mpc_ast_add_child(mpc_ast_t *r, mpc_ast_t *a);
 mpc_ast_t *mpc_ast_add_tag(mpc_ast_t *a, const char *t);
 mpc_ast_t *mpc_ast_tag(mpc_ast_t *a, const char *t);
 mpc_ast_t *mpc_ast_state(mpc_ast_t *a, mpc_state_t s);
+mpc_ast_t *mpc_ast_copy(mpc_ast_t *a);
 
 void mpc_ast_delete(mpc_ast_t *a);
 void mpc_ast_print(mpc_ast_t *a);
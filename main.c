@@ -0,0 +1,376 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if !defined(_WIN32) && !defined(LISPY_NO_EDITLINE)
+#include <editline/readline.h>
+#include <editline/history.h>
+#define LISPY_EDITLINE
+#endif
+
+#include "parsing.h"
+#include "cache.h"
+#include "reader.h"
+#include "serialize.h"
+#include "grammar.h"
+#include "batch.h"
+#include "print.h"
+#include "server.h"
+#include "pipeline.h"
+#include "ctx.h"
+#include "profile.h"
+#include "stats.h"
+
+// Like readline but for input that is not a terminal, the trailing newline
+// is dropped. Returns NULL at the end of the input.
+static char* lispy_next_line(FILE* f)
+{
+    size_t len = 0;
+    size_t slots = 256;
+    char* line = malloc(slots);
+
+    while (fgets(line + len, slots - len, f))
+    {
+        len += strlen(line + len);
+        if (len > 0 && line[len - 1] == '\n')
+        {
+            line[len - 1] = '\0';
+            return line;
+        }
+
+        slots *= 2;
+        line = realloc(line, slots);
+    }
+
+    if (len > 0) { return line; }
+
+    free(line);
+    return NULL;
+}
+
+#ifndef LISPY_EDITLINE
+// Stand-ins for where editline is not around, no line editing or history
+static char* readline(const char* prompt)
+{
+    fputs(prompt, stdout);
+    fflush(stdout);
+    return lispy_next_line(stdin);
+}
+
+static void add_history(const char* line) {}
+#endif
+
+// Reads every line of stdin and writes what it reads as LVB records,
+// without evaluating anything.
+static int lispy_save(mpc_parser_t* Lispy, const char* path, lval_format format)
+{
+    FILE* f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    lval_reader reader;
+    lval_reader_init(&reader, "<stdin>");
+    lvb_writer* w = lvb_writer_new(f);
+    lval_buf out;
+    lval_buf_init(&out, lval_file_sink, stdout);
+    out.format = format;
+    char* input;
+
+    while ((input = lispy_next_line(stdin)) != NULL)
+    {
+        lval* val = lval_reader_read_line(&reader, Lispy, NULL, input, &out);
+        if (val != NULL)
+        {
+            lvb_write(w, val);
+            lval_del(val);
+        }
+        free(input);
+    }
+
+    if (lval_reader_finish(&reader) == LVAL_READER_ERROR) { lval_buf_error(&out, LERR_PARSE, reader.error); }
+    lval_reader_free(&reader);
+    lval_buf_flush(&out);
+    lval_buf_free(&out);
+
+    int ok = lvb_writer_del(w);
+    if (fclose(f) != 0) { ok = 0; }
+    if (!ok) { fprintf(stderr, "%s: write failed\n", path); }
+
+    return ok ? 0 : 1;
+}
+
+// Evaluates every record of an LVB file in order, no parsing involved.
+static int lispy_load(const char* path, const lval_print_limits* limits, lval_format format)
+{
+    lvb_file* f = lvb_open(path);
+    if (f == NULL)
+    {
+        fprintf(stderr, "%s: not a readable LVB version %d file\n", path, LVB_VERSION);
+        return 1;
+    }
+
+    lvb_record rec;
+    int status;
+    lval_buf out;
+    lval_buf_init(&out, lval_file_sink, stdout);
+    out.limits = *limits;
+    out.format = format;
+
+    while ((status = lvb_next(f, &rec)) > 0)
+    {
+        lval* result = lval_eval(lvb_to_lval(lvb_root(&rec)));
+        lval_buf_println(&out, result);
+        lval_del(result);
+    }
+
+    lvb_close(f);
+    lval_buf_flush(&out);
+    lval_buf_free(&out);
+
+    if (status < 0)
+    {
+        fprintf(stderr, "%s: corrupt record\n", path);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Reads a count for one of the limits, which has to be a whole number of
+// zero or more. Returns 0 if it is not.
+static int lispy_parse_limit(const char* s, long* x)
+{
+    char* end;
+    errno = 0;
+    *x = strtol(s, &end, 10);
+
+    return end != s && *end == '\0' && errno == 0 && *x >= 0;
+}
+
+// Switches profiling of the REPL's lines on or off. Switching it off
+// reports on the lines profiled until then.
+static void lispy_profile_switch(int on)
+{
+    lispy_ctx* ctx = lispy_ctx_get();
+
+    if (on && ctx->profile == NULL) { ctx->profile = lispy_profile_new(); }
+
+    if (!on && ctx->profile != NULL)
+    {
+        lispy_profile_report(ctx->profile, stderr);
+        lispy_profile_del(ctx->profile);
+        ctx->profile = NULL;
+    }
+}
+
+// The REPL's own commands. Returns 0 if input is not one of them.
+static int lispy_command(const char* input, lval_cache* cache, lval_print_limits* limits)
+{
+    if (strcmp(input, ":cache") == 0)
+    {
+        lval_cache_report(cache, stdout);
+        return 1;
+    }
+
+    if (strcmp(input, ":profile on") == 0 || strcmp(input, ":profile off") == 0)
+    {
+        lispy_profile_switch(input[10] == 'n');
+        return 1;
+    }
+
+    if (strcmp(input, ":profile") == 0)
+    {
+        lispy_profile* prof = lispy_ctx_get()->profile;
+        if (prof) { lispy_profile_report(prof, stderr); }
+        else { puts("profiling is off, :profile on starts it"); }
+        return 1;
+    }
+
+    if (strcmp(input, ":stats") == 0)
+    {
+        lispy_stats_publish(lispy_ctx_get());
+        lispy_stats_write(stdout);
+        return 1;
+    }
+
+    if (strcmp(input, ":print") == 0)
+    {
+        printf("print-length %ld, print-depth %ld, print-bytes %lu (0 is no limit)\n",
+            limits->length, limits->depth, (unsigned long)limits->bytes);
+        return 1;
+    }
+
+    const char* names[] = { ":print-length ", ":print-depth ", ":print-bytes " };
+    for (int i = 0; i < 3; i++)
+    {
+        size_t n = strlen(names[i]);
+        if (strncmp(input, names[i], n) != 0) { continue; }
+
+        long x;
+        if (!lispy_parse_limit(input + n, &x))
+        {
+            printf("usage: %sN, where N is 0 for no limit or more\n", names[i]);
+        }
+        else if (i == 0) { limits->length = x; }
+        else if (i == 1) { limits->depth = x; }
+        else { limits->bytes = x; }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv) {
+	const char* save_path = NULL;
+	const char* load_path = NULL;
+	const char* batch_path = NULL;
+	const char* serve_path = NULL;
+	int jobs = 0;
+	int pipeline = 0;
+	int pipeline_stats = 0;
+	int profile = 0;
+	const char* stats_path = NULL;
+	
+	// the REPL keeps a byte budget unless told otherwise, nothing else does
+	lval_print_limits limits = { 0, 0, 0 };
+	long print_bytes = -1;
+	long x;
+	lval_format format = LVAL_FORMAT_TEXT;
+	
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) { save_path = argv[++i]; }
+		else if (strcmp(argv[i], "--load") == 0 && i + 1 < argc) { load_path = argv[++i]; }
+		else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) { serve_path = argv[++i]; }
+		else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) { jobs = atoi(argv[++i]); }
+		else if (strcmp(argv[i], "--print-length") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { limits.length = x; i++; }
+		else if (strcmp(argv[i], "--print-depth") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { limits.depth = x; i++; }
+		else if (strcmp(argv[i], "--print-bytes") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { print_bytes = x; i++; }
+		else if (strcmp(argv[i], "--max-steps") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { lispy_budget_limits.steps = x; i++; }
+		else if (strcmp(argv[i], "--max-depth") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { lispy_budget_limits.depth = x; i++; }
+		else if (strcmp(argv[i], "--max-time-ms") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { lispy_budget_limits.ms = x; i++; }
+		else if (strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc && lispy_parse_limit(argv[i + 1], &x)) { lispy_budget_limits.bytes = x; i++; }
+		else if (strcmp(argv[i], "--profile") == 0) { profile = 1; }
+		else if (strcmp(argv[i], "--stats-file") == 0 && i + 1 < argc) { stats_path = argv[++i]; }
+		else if (strcmp(argv[i], "--output=text") == 0) { format = LVAL_FORMAT_TEXT; }
+		else if (strcmp(argv[i], "--output=json") == 0) { format = LVAL_FORMAT_JSON; }
+		else if (strcmp(argv[i], "--pipeline") == 0) { pipeline = 1; }
+		else if (strcmp(argv[i], "--pipeline-stats") == 0) { pipeline = 1; pipeline_stats = 1; }
+		else if ((jobs > 0 || pipeline) && batch_path == NULL && argv[i][0] != '-') { batch_path = argv[i]; }
+		else {
+			fprintf(stderr, "usage: %s [--save FILE | --load FILE | --jobs N [FILE] | --serve PATH]\n"
+				"       [--pipeline | --pipeline-stats] [FILE]\n"
+				"       [--print-length N] [--print-depth N] [--print-bytes N]\n"
+				"       [--max-steps N] [--max-depth N] [--max-time-ms N] [--max-bytes N]\n"
+				"       [--output=text | --output=json] [--profile] [--stats-file PATH]\n", argv[0]);
+			return 1;
+		}
+	}
+	
+	limits.bytes = print_bytes >= 0 ? (size_t)print_bytes : 0;
+	
+	// before any thread is started, they all leave SIGUSR1 to the watcher
+	if (stats_path) { lispy_stats_watch(stats_path); }
+	
+	if (load_path) { return lispy_load(load_path, &limits, format); }
+	if (pipeline) { return lispy_pipeline(batch_path, &limits, format, pipeline_stats); }
+	if (jobs > 0) { return lispy_batch(batch_path, jobs, &limits, format); }
+	
+	lispy_grammar* grammar = lispy_grammar_new();
+	mpc_parser_t* Lispy = grammar->Lispy;
+
+	if (save_path) {
+		int status = lispy_save(Lispy, save_path, format);
+		lispy_grammar_del(grammar);
+		return status;
+	}
+	
+	// every client is served by the same parser, built once up here
+	if (serve_path) {
+		if (print_bytes < 0) { limits.bytes = LVAL_PRINT_REPL_BYTES; }
+		int status = lispy_serve(serve_path, Lispy, &limits, format);
+		lispy_grammar_del(grammar);
+		return status;
+	}
+	
+	puts("Lispy Version 0.0.0.0.1");
+	puts("Press Ctrl+c to exit\n");
+	
+	lval_cache* cache = lval_cache_new(LVAL_CACHE_SLOTS);
+	
+	// picks up forms that are still open at the end of a line so the
+	// following lines extend them rather than reparsing everything
+	lval_reader reader;
+	lval_reader_init(&reader, "<stdin>");
+	char prompt[32];
+	
+	// results and errors are rendered here and go out in one write per line
+	lval_buf out;
+	lval_buf_init(&out, lval_file_sink, stdout);
+	out.limits = limits;
+	out.format = format;
+	if (print_bytes < 0) { out.limits.bytes = LVAL_PRINT_REPL_BYTES; }
+	
+	// every line gets a breakdown on stderr while profiling
+	lispy_profile_switch(profile);
+	lispy_ctx* ctx = lispy_ctx_get();
+	
+	while (1) {
+		lval_reader_prompt(&reader, prompt, sizeof(prompt));
+		char* input = readline(prompt);
+		
+		if (input == NULL) {
+			if (lval_reader_finish(&reader) == LVAL_READER_ERROR) {
+				lval_buf_error(&out, LERR_PARSE, reader.error);
+				lval_buf_flush(&out);
+			}
+			break;
+		}
+		
+		add_history(input);
+		
+		if (!lval_reader_pending(&reader) && lispy_command(input, cache, &out.limits)) {
+			free(input);
+			continue;
+		}
+		
+		lispy_profile* prof = ctx->profile;
+		lval* val = lval_reader_read_line(&reader, Lispy, cache, input, &out);
+		
+		if (val != NULL) {
+			if (prof) { lispy_profile_begin(prof, PROF_EVAL); }
+			lval* result = lval_eval(val);
+			if (prof) {
+				lispy_profile_end(prof);
+				lispy_profile_nodes(prof, ctx->steps);
+				lispy_profile_begin(prof, PROF_PRINT);
+			}
+			
+			lval_buf_println(&out, result);
+			lval_buf_flush(&out);
+			
+			if (prof) {
+				lispy_profile_end(prof);
+				lispy_profile_nodes(prof, lispy_profile_lval_nodes(result));
+			}
+			lval_del(result);
+		}
+		
+		lval_buf_flush(&out);
+		if (prof) { lispy_profile_line(prof, stderr); }
+		lispy_stats_publish(ctx);
+		free(input);
+	}
+	
+	lispy_profile_switch(0);
+	lval_buf_free(&out);
+	lval_reader_free(&reader);
+	lval_cache_del(cache);
+	lispy_grammar_del(grammar);
+    
+	return 0;
+}
@@ -0,0 +1,371 @@
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "numfmt.h"
+
+static const char lval_fmt_digits[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Integers are written two digits at a time from the right, with the pairs
+// looked up in a table instead of dividing by 10 for every digit.
+size_t lval_fmt_long(char* out, long v)
+{
+    char tmp[24];
+    char* p = tmp + sizeof(tmp);
+
+    // negating through unsigned keeps LONG_MIN well defined
+    unsigned long u = v < 0 ? 0UL - (unsigned long)v : (unsigned long)v;
+
+    while (u >= 100)
+    {
+        const char* d = &lval_fmt_digits[(u % 100) * 2];
+        u /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+
+    if (u >= 10)
+    {
+        *--p = lval_fmt_digits[u * 2 + 1];
+        *--p = lval_fmt_digits[u * 2];
+    }
+    else
+    {
+        *--p = (char)('0' + u);
+    }
+
+    if (v < 0) { *--p = '-'; }
+
+    size_t n = tmp + sizeof(tmp) - p;
+    memcpy(out, p, n);
+    return n;
+}
+
+// Doubles go through Grisu2 (Florian Loitsch, "Printing Floating-Point
+// Numbers Quickly and Accurately with Integers", PLDI 2010). It works on
+// 64 bit integers only and always produces digits that read back to the
+// same double. Once in a while they are not the very shortest possible,
+// which does not matter here.
+
+typedef struct lval_fp
+{
+    uint64_t f;
+    int e;
+} lval_fp;
+
+#define LVAL_FP_SIGNIFICAND_SIZE 52
+#define LVAL_FP_EXPONENT_BIAS (0x3FF + LVAL_FP_SIGNIFICAND_SIZE)
+#define LVAL_FP_MIN_EXPONENT (-LVAL_FP_EXPONENT_BIAS)
+#define LVAL_FP_EXPONENT_MASK 0x7FF0000000000000ULL
+#define LVAL_FP_SIGNIFICAND_MASK 0x000FFFFFFFFFFFFFULL
+#define LVAL_FP_HIDDEN_BIT 0x0010000000000000ULL
+
+// 10^k for k = -348, -340, ..., 340 as normalized 64 bit significands and
+// binary exponents, rounded to nearest
+static const uint64_t lval_fp_powers_f[] =
+{
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL,
+};
+
+static const short lval_fp_powers_e[] =
+{
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066,
+};
+
+static const uint32_t lval_fp_pow10[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static lval_fp lval_fp_from_double(double d)
+{
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+
+    int biased_e = (int)((u & LVAL_FP_EXPONENT_MASK) >> LVAL_FP_SIGNIFICAND_SIZE);
+    uint64_t significand = u & LVAL_FP_SIGNIFICAND_MASK;
+
+    lval_fp x;
+    if (biased_e != 0)
+    {
+        x.f = significand + LVAL_FP_HIDDEN_BIT;
+        x.e = biased_e - LVAL_FP_EXPONENT_BIAS;
+    }
+    else
+    {
+        x.f = significand;
+        x.e = LVAL_FP_MIN_EXPONENT + 1;
+    }
+
+    return x;
+}
+
+static lval_fp lval_fp_mul(lval_fp x, lval_fp y)
+{
+    // the upper 64 bits of the 128 bit product, rounded
+    const uint64_t M32 = 0xFFFFFFFFULL;
+    uint64_t a = x.f >> 32, b = x.f & M32;
+    uint64_t c = y.f >> 32, d = y.f & M32;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+    tmp += 1ULL << 31;
+
+    lval_fp r;
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+static lval_fp lval_fp_normalize(lval_fp x)
+{
+    while (!(x.f & (1ULL << 63)))
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+
+    return x;
+}
+
+// The neighbours halfway to the next double up and down, the digits have
+// to land between them to read back to the same value
+static void lval_fp_boundaries(lval_fp v, lval_fp* minus, lval_fp* plus)
+{
+    lval_fp pl;
+    pl.f = (v.f << 1) + 1;
+    pl.e = v.e - 1;
+    while (!(pl.f & (LVAL_FP_HIDDEN_BIT << 1)))
+    {
+        pl.f <<= 1;
+        pl.e--;
+    }
+    pl.f <<= 64 - LVAL_FP_SIGNIFICAND_SIZE - 2;
+    pl.e -= 64 - LVAL_FP_SIGNIFICAND_SIZE - 2;
+
+    // the gap below a power of two is only half as wide
+    lval_fp mi;
+    if (v.f == LVAL_FP_HIDDEN_BIT)
+    {
+        mi.f = (v.f << 2) - 1;
+        mi.e = v.e - 2;
+    }
+    else
+    {
+        mi.f = (v.f << 1) - 1;
+        mi.e = v.e - 1;
+    }
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+
+    *minus = mi;
+    *plus = pl;
+}
+
+static lval_fp lval_fp_cached_power(int e, int* K)
+{
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = (int)dk;
+    if (dk - k > 0.0) { k++; }
+
+    int index = (k >> 3) + 1;
+    *K = -(-348 + index * 8);
+
+    lval_fp c;
+    c.f = lval_fp_powers_f[index];
+    c.e = lval_fp_powers_e[index];
+    return c;
+}
+
+static void lval_fp_round(char* buffer, int len, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        buffer[len - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+static int lval_fp_count_digits(uint32_t n)
+{
+    int d = 1;
+    while (d < 10 && n >= lval_fp_pow10[d]) { d++; }
+    return d;
+}
+
+static int lval_fp_digits(lval_fp W, lval_fp Mp, uint64_t delta, char* buffer, int* K)
+{
+    lval_fp one;
+    one.f = 1ULL << -Mp.e;
+    one.e = Mp.e;
+
+    uint64_t wp_w = Mp.f - W.f;
+    uint32_t p1 = (uint32_t)(Mp.f >> -one.e);
+    uint64_t p2 = Mp.f & (one.f - 1);
+    int kappa = lval_fp_count_digits(p1);
+    int len = 0;
+
+    while (kappa > 0)
+    {
+        uint32_t div = lval_fp_pow10[kappa - 1];
+        uint32_t d = p1 / div;
+        p1 %= div;
+
+        if (d || len) { buffer[len++] = (char)('0' + d); }
+        kappa--;
+
+        uint64_t tmp = ((uint64_t)p1 << -one.e) + p2;
+        if (tmp <= delta)
+        {
+            *K += kappa;
+            lval_fp_round(buffer, len, delta, tmp, (uint64_t)lval_fp_pow10[kappa] << -one.e, wp_w);
+            return len;
+        }
+    }
+
+    while (1)
+    {
+        p2 *= 10;
+        delta *= 10;
+
+        char d = (char)(p2 >> -one.e);
+        if (d || len) { buffer[len++] = (char)('0' + d); }
+        p2 &= one.f - 1;
+        kappa--;
+
+        if (p2 < delta)
+        {
+            *K += kappa;
+            int index = -kappa;
+            lval_fp_round(buffer, len, delta, p2, one.f, wp_w * (index < 10 ? lval_fp_pow10[index] : 0));
+            return len;
+        }
+    }
+}
+
+// Fills buffer with the digits of a finite positive double and returns how
+// many there are, the value is then digits x 10^K
+static int lval_fp_grisu2(double value, char* buffer, int* K)
+{
+    lval_fp v = lval_fp_from_double(value);
+    lval_fp w_m, w_p;
+    lval_fp_boundaries(v, &w_m, &w_p);
+
+    lval_fp c_mk = lval_fp_cached_power(w_p.e, K);
+    lval_fp W = lval_fp_mul(lval_fp_normalize(v), c_mk);
+    lval_fp Wp = lval_fp_mul(w_p, c_mk);
+    lval_fp Wm = lval_fp_mul(w_m, c_mk);
+    Wm.f++;
+    Wp.f--;
+
+    return lval_fp_digits(W, Wp, Wp.f - Wm.f, buffer, K);
+}
+
+size_t lval_fmt_double(char* out, double d)
+{
+    char* p = out;
+
+    if (d != d)
+    {
+        memcpy(p, "nan", 3);
+        return 3;
+    }
+
+    if (signbit(d))
+    {
+        *p++ = '-';
+        d = -d;
+    }
+
+    if (d == 0.0)
+    {
+        memcpy(p, "0.0", 3);
+        return p + 3 - out;
+    }
+
+    if (isinf(d))
+    {
+        memcpy(p, "inf", 3);
+        return p + 3 - out;
+    }
+
+    char digits[20];
+    int K = 0;
+    int len = lval_fp_grisu2(d, digits, &K);
+
+    // where the decimal point goes relative to the digits
+    int point = len + K;
+
+    if (point <= 0)
+    {
+        // 0.000ddd
+        *p++ = '0';
+        *p++ = '.';
+        memset(p, '0', -point);
+        p += -point;
+        memcpy(p, digits, len);
+        p += len;
+    }
+    else if (point < len)
+    {
+        // dd.ddd
+        memcpy(p, digits, point);
+        p += point;
+        *p++ = '.';
+        memcpy(p, digits + point, len - point);
+        p += len - point;
+    }
+    else
+    {
+        // ddd000.0
+        memcpy(p, digits, len);
+        p += len;
+        memset(p, '0', point - len);
+        p += point - len;
+        *p++ = '.';
+        *p++ = '0';
+    }
+
+    return p - out;
+}
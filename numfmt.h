@@ -0,0 +1,22 @@
+#ifndef numfmt_h
+#define numfmt_h
+
+#include <stddef.h>
+
+// Number formatting for the printer. Both functions write straight into
+// the caller's memory, which needs room for LVAL_FMT_MAX bytes, and return
+// how many bytes they wrote. Nothing is NUL terminated.
+
+// enough for the longest double lval_fmt_double writes: a sign, "0." and
+// 340 digits for the smallest subnormals
+#define LVAL_FMT_MAX 352
+
+size_t lval_fmt_long(char*, long);
+
+// Writes the shortest digits that read back to exactly the same double,
+// always positional and always with a fractional part so the text is a
+// valid <flt> for the Lispy grammar: 0.1, 2.0, -1500.0, 0.00025.
+// Infinities and NaN come out as inf, -inf and nan.
+size_t lval_fmt_double(char*, double);
+
+#endif
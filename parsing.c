@@ -1,115 +1,42 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include "lib\mpc.h"
-
-#ifdef _WIN32
 #include <string.h>
-
-static char buffer[2048];
-
-/* Fake readline function */
-char* readline(char* prompt) {
-	fputs(prompt, stdout);
-	fgets(buffer, 2048, stdin);
-	char* cpy = malloc(strlen(buffer) + 1);
-	strcpy(cpy, buffer);
-	cpy[strlen(cpy) - 1] = '\0';
-	return cpy;
-}
-
-/* Fake add history function */
-void add_history(char* unused) {}
-
-#else
-#include <editline/readline.h>
-#include <editline/history.h>
-#endif
+#include <errno.h>
 
 #include "parsing.h"
+#include "ctx.h"
 
-int main(int argc, char** argv) {
-    mpc_parser_t* Flt = mpc_new("flt");
-	mpc_parser_t* Integer = mpc_new("integer");
-	mpc_parser_t* Symbol = mpc_new("symbol");
-    mpc_parser_t* Sexpr = mpc_new("sexpr");
-	mpc_parser_t* Expr = mpc_new("expr");
-	mpc_parser_t* Lispy = mpc_new("lispy");
-	
-	mpca_lang(MPCA_LANG_DEFAULT,
-		"                                                                     \
-        integer     : /-?[0-9]+/ ;                                            \
-        flt 		: /-?[0-9]+([.][0-9]+)/ ;	                              \
-		symbol  	: '+' | '-' | '*' | '/'  | '%' ;			              \
-        sexpr       : '(' <expr>* ')';                                       \
-        expr		: <flt> | <integer> | <symbol> | <sexpr>;                 \
-        lispy       : /^/ <expr>* /$/ ;                                       \
-		",
-		 Flt, Integer, Symbol, Sexpr, Expr, Lispy);
-
-	puts("Lispy Version 0.0.0.0.1");
-	puts("Press Ctrl+c to exit\n");
-	
-	while (1) {
-		char* input = readline("lispy> ");
-		add_history(input);
-		
-		mpc_result_t r;
-        
-        if(mpc_parse("<stdin>", input, Lispy, &r)) {
-            lval* result = lval_eval(lval_read(r.output)); 
-            lval_println(result);
-            lval_del(result);
-            mpc_ast_delete(r.output);
-        } else {
-            mpc_err_print(r.error);
-            mpc_err_delete(r.error);
-        }
-        
-		free(input);
-	}
-	
-    mpc_cleanup(6, Flt, Integer, Symbol, Sexpr, Expr, Lispy);
-    
-	return 0;
-}
-
-void lval_expr_print(lval* val, char open, char close)
+// Evaluates val within the budget, or leaves it as it is once the budget
+// has run out
+static lval* lval_eval_step(lispy_ctx* ctx, lval* val)
 {
-    putchar(open);
-    for (int i=0; i < val->count; i++)
-    {
-        lval_print(val->cell[i]);
-        
-        if (i != val->count-1)
-        {
-            putchar(' ');
-        }
-    }
-    
-    putchar(close);
-}
+  if (!lispy_budget_step(ctx) || val->type != LVAL_SEXPR) { return val; }
+  if (!lispy_budget_enter(ctx)) { return val; }
 
-void lval_print(lval* val)
-{
-    switch(val->type)
-    {
-        case LVAL_INT: printf("%d", val->value.i); break;
-        case LVAL_FLOAT: printf("%f", val->value.d); break;
-        case LVAL_SYM: printf("%s", val->value.sym); break;
-        case LVAL_ERR: printf("Error: %s", val->value.err); break;
-        case LVAL_SEXPR: lval_expr_print(val, '(', ')'); break;
-    }
-}
+  val = eval_sexpr(val);
+  ctx->depth--;
 
-void lval_println(lval* val)
-{
-    lval_print(val);
-    putchar('\n');
+  return val;
 }
 
 lval* lval_eval(lval* val) 
 {
-  if (val->type == LVAL_SEXPR) { return eval_sexpr(val); }
+  lispy_ctx* ctx = lispy_ctx_get();
+  if (ctx->depth > 0) { return lval_eval_step(ctx, val); }
+
+  // called from outside, a new evaluation with a budget of its own. What
+  // is left when the budget runs out is thrown away whole.
+  lispy_budget_begin(ctx);
+  val = lval_eval_step(ctx, val);
+
+  if (ctx->exhausted)
+  {
+    lval_del(val);
+    val = lispy_budget_error(ctx);
+  }
+
+  // only codes lispy knows are counted, whatever made the error
+  if (val->type == LVAL_ERR && val->code > 0 && val->code < LERR_CODES) { ctx->stats.errors[val->code]++; }
 
   return val;
 }
@@ -120,6 +47,7 @@ lval* lval_pop(lval* val, int i)
 
   memmove(&val->cell[i], &val->cell[i+1],
     sizeof(lval*) * (val->count-i-1));
+  lispy_ctx_get()->stats.pop_bytes += sizeof(lval*) * (val->count-i-1);
 
   val->count--;
 
@@ -145,7 +73,7 @@ lval* builtin_op(lval* a, char* op)
     if (a->cell[i]->type != LVAL_INT && a->cell[i]->type != LVAL_FLOAT) 
     {
       lval_del(a);
-      return lval_err("Cannot operate on non-number!");
+      return lval_err(LERR_NOT_NUMBER, "Cannot operate on non-number!");
     }
     
     // if 
@@ -170,17 +98,17 @@ lval* builtin_op(lval* a, char* op)
       }
   }
 
-  while (a->count > 0) 
+  while (a->count > 0 && x->type != LVAL_ERR) 
   {
     lval* y = lval_pop(a, 0);
         
     switch (op_type)
     {
         case LVAL_INT:
-            eval_int_op(x, op, y);
+            x = eval_int_op(x, op, y);
             break;
         case LVAL_FLOAT:
-            eval_float_op(x, op, y);
+            x = eval_float_op(x, op, y);
             break;
         case LVAL_ERR: break;
         case LVAL_SYM: break;
@@ -202,6 +130,9 @@ lval* eval_sexpr(lval* val)
     val->cell[i] = lval_eval(val->cell[i]);
   }
 
+  // out of budget, the caller gives up on all of it
+  if (lispy_ctx_get()->exhausted) { return val; }
+
   for (int i = 0; i < val->count; i++) 
   {
     if (val->cell[i]->type == LVAL_ERR) { return lval_take(val, i); }
@@ -215,7 +146,7 @@ lval* eval_sexpr(lval* val)
   if (f->type != LVAL_SYM) 
   {
     lval_del(f); lval_del(val);
-    return lval_err("S-expression Does not start with symbol!");
+    return lval_err(LERR_NOT_SYMBOL, "S-expression Does not start with symbol!");
   }
 
   lval* result = builtin_op(val, f->value.sym);
@@ -223,58 +154,61 @@ lval* eval_sexpr(lval* val)
   return result;
 }
 
-void eval_int_op(lval* x, char* op, lval* y)
+// Both ops work on x in place and return it, or free it and return an
+// error in its place
+lval* eval_int_op(lval* x, char* op, lval* y)
 {   
     if (strcmp(op, "+") == 0) 
     { 
         x->value.i += y->value.i;
         
-        return;
+        return x;
     }
     
     if (strcmp(op, "-") == 0) 
     { 
         x->value.i -= y->value.i;
         
-        return;
+        return x;
     }
     
     if (strcmp(op, "*") == 0) 
     { 
         x->value.i *= y->value.i;
         
-        return;
+        return x;
     }
     
-    if (strcmp(op, "/") == 0)
+    if (strcmp(op, "/") == 0 || strcmp(op, "%") == 0)
     { 
         if (y->value.i == 0) 
         { 
             lval_del(x);
-            x = lval_err("Division by zero");
-            
-            
+            return lval_err(LERR_DIV_ZERO, "Division by zero");
         }
-        else
+        
+        // LONG_MIN / -1 traps on most machines, it wraps like negation does
+        if (y->value.i == -1)
+        {
+            x->value.i = op[0] == '/' ? (long)(0UL - (unsigned long)x->value.i) : 0;
+        }
+        else if (op[0] == '/')
         {
             x->value.i /= y->value.i;
         }
+        else
+        {
+            x->value.i %= y->value.i;
+        }
         
-        return;
-    }
-    
-    if (strcmp(op, "%") == 0) 
-    { 
-        x->value.i = x->value.i % y->value.i;
-        
-        return;
+        return x;
     }
     
     lval_del(x);
-    x = lval_err("Bad operation");
+    return lval_err(LERR_BAD_OP, "Bad operation");
 }
 
-void eval_float_op(lval* x, char* op, lval* y)
+lval* eval_float_op(lval* x, char* op, lval* y)
 {   
     double temp;
     if (x->type == LVAL_INT)
@@ -295,21 +229,21 @@ void eval_float_op(lval* x, char* op, lval* y)
     { 
         x->value.d += y->value.d;
         
-        return;
+        return x;
     }
     
     if (strcmp(op, "-") == 0) 
     { 
         x->value.d -= y->value.d;
         
-        return;
+        return x;
     }
     
     if (strcmp(op, "*") == 0) 
     { 
         x->value.d *= y->value.d;
         
-        return;
+        return x;
     }
     
     if (strcmp(op, "/") == 0)
@@ -317,26 +251,23 @@ void eval_float_op(lval* x, char* op, lval* y)
         if (y->value.d == 0) 
         { 
             lval_del(x);
-            x = lval_err("Division by zero");
-            
-            
-        }
-        else
-        {
-            x->value.d /= y->value.d;
+            return lval_err(LERR_DIV_ZERO, "Division by zero");
         }
         
-        return;
+        x->value.d /= y->value.d;
+        
+        return x;
     }
         
     lval_del(x);
-    x = lval_err("Bad operation");
+    return lval_err(LERR_BAD_OP, "Bad operation");
 }
 
 lval* lval_int(long x)
 {
-    lval* val = malloc(sizeof(lval));
+    lval* val = lval_alloc();
     val->type = LVAL_INT;
+    lispy_ctx_get()->stats.allocs[LVAL_INT]++;
     val->value.i = x;
     
     return val;
@@ -344,27 +275,52 @@ lval* lval_int(long x)
 
 lval* lval_float(double x)
 {
-    lval* val = malloc(sizeof(lval));
+    lval* val = lval_alloc();
     val->type = LVAL_FLOAT;
+    lispy_ctx_get()->stats.allocs[LVAL_FLOAT]++;
     val->value.d = x;
     
     return val;
 }
 
-lval* lval_err(char* m)
+lval* lval_err(lval_error code, char* m)
 {
-    lval* val = malloc(sizeof(lval));
+    lval* val = lval_alloc();
     val->type = LVAL_ERR;
+    lispy_ctx_get()->stats.allocs[LVAL_ERR]++;
+    val->code = code;
+    lispy_budget_alloc(lispy_ctx_get(), strlen(m) + 1);
     val->value.err = malloc(strlen(m) + 1);
     strcpy(val->value.err, m);
     
     return val;
 }
 
+const char* lval_error_name(lval_error code)
+{
+    switch (code)
+    {
+        case LERR_DIV_ZERO: return "division_by_zero";
+        case LERR_BAD_OP: return "bad_operation";
+        case LERR_BAD_NUM: return "invalid_number";
+        case LERR_NOT_NUMBER: return "not_a_number";
+        case LERR_NOT_SYMBOL: return "not_a_symbol";
+        case LERR_PARSE: return "parse";
+        case LERR_STEPS: return "step_limit";
+        case LERR_DEPTH: return "depth_limit";
+        case LERR_TIME: return "time_limit";
+        case LERR_MEMORY: return "memory_limit";
+    }
+
+    return "unknown";
+}
+
 lval* lval_sym(char* s)
 {
-    lval* val = malloc(sizeof(lval));
+    lval* val = lval_alloc();
     val->type = LVAL_SYM;
+    lispy_ctx_get()->stats.allocs[LVAL_SYM]++;
+    lispy_budget_alloc(lispy_ctx_get(), strlen(s) + 1);
     val->value.sym = malloc(strlen(s) + 1);
     strcpy(val->value.sym, s);
     
@@ -373,14 +329,43 @@ lval* lval_sym(char* s)
 
 lval* lval_sexpr(void)
 {
-    lval* val = malloc(sizeof(lval));
+    lval* val = lval_alloc();
     val->type = LVAL_SEXPR;
+    lispy_ctx_get()->stats.allocs[LVAL_SEXPR]++;
     val->count = 0;
     val->cell = NULL;
     
     return val;
 }
 
+lval* lval_copy(lval* val)
+{
+    switch (val->type)
+    {
+        case LVAL_INT: return lval_int(val->value.i);
+        case LVAL_FLOAT: return lval_float(val->value.d);
+        case LVAL_ERR: return lval_err(val->code, val->value.err);
+        case LVAL_SYM: return lval_sym(val->value.sym);
+        case LVAL_SEXPR: break;
+    }
+
+    // the child count is known up front, so size the cell array once
+    // instead of growing it through lval_add
+    lval* x = lval_sexpr();
+    if (val->count > 0)
+    {
+        lispy_budget_alloc(lispy_ctx_get(), sizeof(lval*) * val->count);
+        x->cell = malloc(sizeof(lval*) * val->count);
+        for (int i = 0; i < val->count; i++)
+        {
+            x->cell[i] = lval_copy(val->cell[i]);
+        }
+        x->count = val->count;
+    }
+
+    return x;
+}
+
 void lval_del(lval* val)
 {
     switch (val->type)
@@ -405,19 +390,23 @@ void lval_del(lval* val)
             break;
     }
     
-    free(val);
+    lispy_ctx_get()->stats.frees[val->type]++;
+    lval_free(val);
 }
 
 lval* lval_read_num(mpc_ast_t* t)
 {
     errno = 0;
     long x = strtol(t->contents, NULL, 10);
-    return errno != ERANGE ? lval_int(x) : lval_err("Invalid number"); 
+    return errno != ERANGE ? lval_int(x) : lval_err(LERR_BAD_NUM, "Invalid number"); 
 }
 
 lval* lval_add(lval* val, lval* x)
 {
+    lispy_ctx* ctx = lispy_ctx_get();
     val->count++;
+    lispy_budget_alloc(ctx, sizeof(lval*));
+    ctx->stats.add_reallocs++;
     val->cell = realloc(val->cell, sizeof(lval*) * val->count);
     val->cell[val->count - 1] = x;
     
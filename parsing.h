@@ -1,4 +1,34 @@
+#ifndef parsing_h
+#define parsing_h
+
+#include <stdio.h>
+#include "lib/mpc.h"
+
+#if defined(_MSC_VER)
+#define LISPY_THREAD_LOCAL __declspec(thread)
+#else
+#define LISPY_THREAD_LOCAL __thread
+#endif
+
 typedef enum { LVAL_INT, LVAL_FLOAT, LVAL_ERR, LVAL_SYM, LVAL_SEXPR } lval_type;
+#define LVAL_TYPES (LVAL_SEXPR + 1)
+
+// What went wrong, carried by every error next to its message. The values
+// are stored in LVB files, new codes go at the end.
+typedef enum
+{
+    LERR_DIV_ZERO = 1,
+    LERR_BAD_OP,
+    LERR_BAD_NUM,
+    LERR_NOT_NUMBER,
+    LERR_NOT_SYMBOL,
+    LERR_PARSE,
+    LERR_STEPS,
+    LERR_DEPTH,
+    LERR_TIME,
+    LERR_MEMORY
+} lval_error;
+#define LERR_CODES (LERR_MEMORY + 1)
 
 typedef union lval_value
 {
@@ -11,29 +41,34 @@ typedef union lval_value
 typedef struct lval
 {
     lval_type type;
+    lval_error code; // only for LVAL_ERR
     lval_value value;
     int count; // number of child lvals
     struct lval** cell;
 } lval;
 
+// the lval allocator, working from the current context's pool (ctx.h)
+lval* lval_alloc(void);
+void lval_free(lval*);
+
 lval* lval_int(long);
 lval* lval_float(double);
 lval* lval_sym(char*);
 lval* lval_sexpr(void);
-lval* lval_err(char*);
+lval* lval_err(lval_error, char*);
+const char* lval_error_name(lval_error);
+lval* lval_copy(lval*);
 void lval_del(lval*);
 
-void lval_expr_print(lval*, char, char);
-void lval_print(lval*);
-void lval_println(lval*);
-
 lval* lval_eval(lval*);
 lval* lval_pop(lval*, int);
 lval* lval_take(lval*, int);
 lval* eval_sexpr(lval*);
-void eval_float_op(lval*, char*, lval*);
-void eval_int_op(lval*, char*, lval*);
+lval* eval_float_op(lval*, char*, lval*);
+lval* eval_int_op(lval*, char*, lval*);
 
 lval* lval_add(lval*, lval*);
 lval* lval_read_num(mpc_ast_t* t);
-lval* lval_read(mpc_ast_t*);
\ No newline at end of file
+lval* lval_read(mpc_ast_t*);
+
+#endif
@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pipeline.h"
+#include "batch.h"
+
+#ifndef _WIN32
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "ctx.h"
+#include "grammar.h"
+#include "reader.h"
+#include "stats.h"
+
+// One block of input travels through every stage. The reader fills in the
+// text, the parser turns it into forms, the evaluator replaces every form
+// with its result and the writer prints and frees them.
+typedef struct lispy_form
+{
+    lval* val;
+
+    // or, when val is NULL, what the parser had to say about the line,
+    // already rendered
+    char* text;
+    size_t len;
+} lispy_form;
+
+typedef struct lispy_block
+{
+    char* text;
+    size_t len;
+
+    int count;
+    int slots;
+    lispy_form* forms;
+} lispy_block;
+
+// A ring has one thread pushing and one popping. Each side only ever
+// writes its own index, and reads the other one to see how far it may
+// go, so the two need nothing but an acquire and a release to agree. The
+// counters are each written by one side only and read once both are done.
+typedef struct lispy_ring
+{
+    lispy_block* slots[LISPY_PIPE_RING];
+
+    // the producer's side
+    atomic_size_t tail;
+    unsigned long pushed;
+    unsigned long push_stalls;
+    double push_wait;
+    size_t depth_max;
+    unsigned long long depth_sum;
+
+    // keeps the consumer's index off the producer's cache line
+    char pad[64];
+
+    // the consumer's side
+    atomic_size_t head;
+    unsigned long pop_stalls;
+    double pop_wait;
+} lispy_ring;
+
+typedef struct lispy_pipe
+{
+    FILE* f;
+    const char* filename;
+    mpc_parser_t* Lispy;
+    lval_print_limits limits;
+    lval_format format;
+
+    // read -> parse -> eval -> write
+    lispy_ring rings[3];
+} lispy_pipe;
+
+static double lispy_pipe_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Waiting starts out spinning, which is cheapest when the other side is
+// about to catch up, then gives the core away and finally sleeps for up to
+// a millisecond at a time so an idle stage costs next to nothing.
+static void lispy_pipe_backoff(int* n)
+{
+    if (*n >= 128)
+    {
+        int shift = *n - 128 < 10 ? *n - 128 : 10;
+        struct timespec ts = { 0, 1000L << shift };
+        nanosleep(&ts, NULL);
+    }
+    else if (*n >= 64)
+    {
+        sched_yield();
+    }
+
+    (*n)++;
+}
+
+static void lispy_ring_init(lispy_ring* r)
+{
+    memset(r, 0, sizeof(lispy_ring));
+    atomic_init(&r->tail, 0);
+    atomic_init(&r->head, 0);
+}
+
+// NULL is pushed last and tells the consumer there is nothing more
+static void lispy_ring_push(lispy_ring* r, lispy_block* b)
+{
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+
+    if (tail - head == LISPY_PIPE_RING)
+    {
+        double start = lispy_pipe_now();
+        int n = 0;
+
+        r->push_stalls++;
+        while (tail - head == LISPY_PIPE_RING)
+        {
+            lispy_pipe_backoff(&n);
+            head = atomic_load_explicit(&r->head, memory_order_acquire);
+        }
+        r->push_wait += lispy_pipe_now() - start;
+    }
+
+    r->slots[tail % LISPY_PIPE_RING] = b;
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+
+    size_t depth = tail + 1 - head;
+    if (depth > r->depth_max) { r->depth_max = depth; }
+    r->depth_sum += depth;
+    r->pushed++;
+}
+
+static lispy_block* lispy_ring_pop(lispy_ring* r)
+{
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+
+    if (head == tail)
+    {
+        double start = lispy_pipe_now();
+        int n = 0;
+
+        r->pop_stalls++;
+        while (head == tail)
+        {
+            lispy_pipe_backoff(&n);
+            tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        }
+        r->pop_wait += lispy_pipe_now() - start;
+    }
+
+    lispy_block* b = r->slots[head % LISPY_PIPE_RING];
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+
+    return b;
+}
+
+static void lispy_block_add(lispy_block* b, lval* val, char* text, size_t len)
+{
+    if (b->count == b->slots)
+    {
+        b->slots = b->slots ? b->slots * 2 : 64;
+        b->forms = realloc(b->forms, sizeof(lispy_form) * b->slots);
+    }
+
+    lispy_form* form = &b->forms[b->count++];
+    form->val = val;
+    form->text = text;
+    form->len = len;
+}
+
+static lispy_block* lispy_block_new(char* text, size_t len)
+{
+    lispy_block* b = calloc(1, sizeof(lispy_block));
+    b->text = text;
+    b->len = len;
+
+    return b;
+}
+
+// Stage one: reads the input and hands it on in blocks that end with a
+// line, whatever part of a line is left over starts the next block.
+static void* lispy_pipe_read(void* arg)
+{
+    lispy_pipe* p = arg;
+    size_t slots = LISPY_PIPE_BLOCK * 2;
+    char* buf = malloc(slots);
+    size_t len = 0;
+    int eof = 0;
+
+    while (!eof)
+    {
+        // always leave room for the terminator
+        if (slots - len < LISPY_PIPE_BLOCK + 1)
+        {
+            slots *= 2;
+            buf = realloc(buf, slots);
+        }
+
+        size_t got = fread(buf + len, 1, LISPY_PIPE_BLOCK, p->f);
+        if (got == 0) { eof = 1; }
+        len += got;
+
+        size_t cut = len;
+        if (!eof)
+        {
+            while (cut > 0 && buf[cut - 1] != '\n') { cut--; }
+            if (cut == 0) { continue; }
+        }
+        if (cut == 0) { break; }
+
+        char* rest = malloc(slots);
+        memcpy(rest, buf + cut, len - cut);
+        buf[cut] = '\0';
+
+        lispy_ring_push(&p->rings[0], lispy_block_new(buf, cut));
+
+        buf = rest;
+        len -= cut;
+    }
+
+    free(buf);
+    lispy_ring_push(&p->rings[0], NULL);
+
+    return NULL;
+}
+
+// Stage two: parses the lines of every block in order, so forms can go on
+// across blocks just like they go on across lines in the REPL. Errors are
+// rendered here, where they happen, and travel on in place of a form.
+static void* lispy_pipe_parse(void* arg)
+{
+    lispy_pipe* p = arg;
+    lispy_ctx ctx;
+    lispy_ctx_init(&ctx);
+    lispy_ctx_set(&ctx);
+
+    lval_reader reader;
+    lval_reader_init(&reader, p->filename);
+    lval_buf errors;
+    lval_buf_init(&errors, NULL, NULL);
+    errors.limits = p->limits;
+    errors.format = p->format;
+
+    lispy_block* b;
+    size_t len;
+
+    while ((b = lispy_ring_pop(&p->rings[0])) != NULL)
+    {
+        char* end = b->text + b->len;
+        char* line = b->text;
+
+        while (line < end)
+        {
+            char* nl = memchr(line, '\n', end - line);
+            if (nl == NULL) { nl = end; }
+            *nl = '\0';
+
+            lval* val = lval_reader_read_line(&reader, p->Lispy, NULL, line, &errors);
+            if (errors.len > 0)
+            {
+                char* text = lval_buf_take(&errors, &len);
+                lispy_block_add(b, NULL, text, len);
+            }
+            if (val != NULL) { lispy_block_add(b, val, NULL, 0); }
+
+            line = nl + 1;
+        }
+
+        free(b->text);
+        b->text = NULL;
+        lispy_ring_push(&p->rings[1], b);
+        lispy_stats_publish(&ctx);
+    }
+
+    // whatever is still open at the end of the input is an error
+    if (lval_reader_finish(&reader) == LVAL_READER_ERROR)
+    {
+        lval_buf_error(&errors, LERR_PARSE, reader.error);
+        b = lispy_block_new(NULL, 0);
+        char* text = lval_buf_take(&errors, &len);
+        lispy_block_add(b, NULL, text, len);
+        lispy_ring_push(&p->rings[1], b);
+    }
+
+    lispy_ring_push(&p->rings[1], NULL);
+
+    lval_buf_free(&errors);
+    lval_reader_free(&reader);
+    lispy_ctx_set(NULL);
+    lispy_ctx_free(&ctx);
+
+    return NULL;
+}
+
+// Stage three: evaluates every form in place
+static void* lispy_pipe_eval(void* arg)
+{
+    lispy_pipe* p = arg;
+    lispy_ctx ctx;
+    lispy_ctx_init(&ctx);
+    lispy_ctx_set(&ctx);
+
+    lispy_block* b;
+    while ((b = lispy_ring_pop(&p->rings[1])) != NULL)
+    {
+        for (int i = 0; i < b->count; i++)
+        {
+            if (b->forms[i].val != NULL) { b->forms[i].val = lval_eval(b->forms[i].val); }
+        }
+
+        lispy_ring_push(&p->rings[2], b);
+        lispy_stats_publish(&ctx);
+    }
+
+    lispy_ring_push(&p->rings[2], NULL);
+
+    lispy_ctx_set(NULL);
+    lispy_ctx_free(&ctx);
+
+    return NULL;
+}
+
+// Stage four, run by the thread that started the others: renders the
+// results and writes them out in the order the blocks arrive, which is the
+// order they were read in. Returns 0 if the output could not be written.
+static int lispy_pipe_write(lispy_pipe* p)
+{
+    lispy_ctx ctx;
+    lispy_ctx_init(&ctx);
+    lispy_ctx* prev = lispy_ctx_set(&ctx);
+
+    lval_buf out;
+    lval_buf_init(&out, lval_file_sink, stdout);
+    out.limits = p->limits;
+    out.format = p->format;
+
+    lispy_block* b;
+    while ((b = lispy_ring_pop(&p->rings[2])) != NULL)
+    {
+        for (int i = 0; i < b->count; i++)
+        {
+            lispy_form* form = &b->forms[i];
+            if (form->val != NULL)
+            {
+                lval_buf_println(&out, form->val);
+                lval_del(form->val);
+            }
+            else
+            {
+                lval_buf_put(&out, form->text, form->len);
+                free(form->text);
+            }
+        }
+
+        free(b->forms);
+        free(b);
+        lispy_stats_publish(&ctx);
+    }
+
+    int ok = lval_buf_flush(&out);
+    lval_buf_free(&out);
+
+    lispy_ctx_set(prev);
+    lispy_ctx_free(&ctx);
+
+    return ok;
+}
+
+static void lispy_pipe_report(lispy_pipe* p, FILE* f)
+{
+    static const char* stages[] = { "read", "parse", "eval", "write" };
+    static const char* rings[] = { "read->parse", "parse->eval", "eval->write" };
+
+    // a stage is starved while it waits on the ring before it and blocked
+    // while it waits on the ring after it
+    fprintf(f, "%-8s %10s %18s %18s\n", "stage", "blocks", "starved", "blocked");
+    for (int i = 0; i < 4; i++)
+    {
+        lispy_ring* in = i > 0 ? &p->rings[i - 1] : NULL;
+        lispy_ring* out = i < 3 ? &p->rings[i] : NULL;
+        char starved[32] = "-";
+        char blocked[32] = "-";
+
+        if (in) { snprintf(starved, sizeof(starved), "%lu (%.1f ms)", in->pop_stalls, in->pop_wait * 1e3); }
+        if (out) { snprintf(blocked, sizeof(blocked), "%lu (%.1f ms)", out->push_stalls, out->push_wait * 1e3); }
+
+        // every ring carries the end marker on top of the blocks
+        unsigned long blocks = (out ? out->pushed : in->pushed) - 1;
+        fprintf(f, "%-8s %10lu %18s %18s\n", stages[i], blocks, starved, blocked);
+    }
+
+    fprintf(f, "\n%-12s %10s %10s %10s\n", "ring", "capacity", "avg depth", "max depth");
+    for (int i = 0; i < 3; i++)
+    {
+        lispy_ring* r = &p->rings[i];
+        double avg = r->pushed ? (double)r->depth_sum / r->pushed : 0;
+        fprintf(f, "%-12s %10d %10.1f %10lu\n", rings[i], LISPY_PIPE_RING, avg, (unsigned long)r->depth_max);
+    }
+}
+
+int lispy_pipeline(const char* path, const lval_print_limits* limits, lval_format format, int stats)
+{
+    FILE* f = path ? fopen(path, "rb") : stdin;
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    lispy_grammar* grammar = lispy_grammar_new();
+
+    lispy_pipe* p = malloc(sizeof(lispy_pipe));
+    p->f = f;
+    p->filename = path ? path : "<stdin>";
+    p->Lispy = grammar->Lispy;
+    p->limits = *limits;
+    p->format = format;
+    for (int i = 0; i < 3; i++) { lispy_ring_init(&p->rings[i]); }
+
+    void* (*stages[])(void*) = { lispy_pipe_read, lispy_pipe_parse, lispy_pipe_eval };
+    pthread_t threads[3];
+    int status = 0;
+
+    // the stages start from the back, so if one of them cannot, ending its
+    // ring stops the ones after it before any input has been read
+    int first = 3;
+    while (first > 0 && pthread_create(&threads[first - 1], NULL, stages[first - 1], p) == 0)
+    {
+        first--;
+    }
+
+    if (first > 0) { lispy_ring_push(&p->rings[first - 1], NULL); }
+    if (!lispy_pipe_write(p)) { status = 1; }
+
+    for (int i = first; i < 3; i++) { pthread_join(threads[i], NULL); }
+
+    if (ferror(f))
+    {
+        perror(p->filename);
+        status = 1;
+    }
+
+    if (stats && first == 0) { lispy_pipe_report(p, stderr); }
+
+    free(p);
+    lispy_grammar_del(grammar);
+    if (path) { fclose(f); }
+
+    // no threads to be had, the batch runner does the same work in series
+    if (first > 0) { return lispy_batch(path, 1, limits, format); }
+
+    return status;
+}
+
+#else
+
+int lispy_pipeline(const char* path, const lval_print_limits* limits, lval_format format, int stats)
+{
+    // no threads here, the batch runner does the same work in series
+    (void)stats;
+    return lispy_batch(path, 1, limits, format);
+}
+
+#endif
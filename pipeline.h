@@ -0,0 +1,33 @@
+#ifndef pipeline_h
+#define pipeline_h
+
+#include "parsing.h"
+#include "print.h"
+
+// Pipeline mode: runs a script through four threads, each doing one stage
+// of what the REPL does for a line and handing its work on to the next:
+//
+//     read  -> cuts the input into blocks of whole lines
+//     parse -> turns every line into a form, or a rendered parse error
+//     eval  -> evaluates the forms
+//     write -> renders the results and writes them out
+//
+// The stages are connected by bounded single producer, single consumer
+// rings that need no locks. A stage that finds the next ring full waits
+// for it to drain, so a slow stage holds back the ones before it rather
+// than letting work pile up in memory. The output is the same as batch
+// mode with one job.
+
+// bytes of input per block, blocks are cut at the end of a line
+#define LISPY_PIPE_BLOCK (16 * 1024)
+
+// blocks each ring holds, must be a power of two
+#define LISPY_PIPE_RING 64
+
+// Runs the script at path, or stdin when path is NULL, printing every
+// result within limits, in the given format. With stats set, a report of
+// how busy each stage and ring was goes to stderr at the end. Returns the
+// exit status for main.
+int lispy_pipeline(const char*, const lval_print_limits*, lval_format, int);
+
+#endif
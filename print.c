@@ -0,0 +1,387 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "print.h"
+#include "numfmt.h"
+
+void lval_buf_init(lval_buf* b, lval_sink sink, void* ctx)
+{
+    b->slots = LVAL_BUF_SIZE;
+    b->data = malloc(b->slots);
+    b->len = 0;
+    b->sink = sink;
+    b->sink_ctx = ctx;
+    b->flushed = 0;
+    b->failed = 0;
+
+    b->limits.length = 0;
+    b->limits.depth = 0;
+    b->limits.bytes = 0;
+    b->format = LVAL_FORMAT_TEXT;
+}
+
+void lval_buf_free(lval_buf* b)
+{
+    free(b->data);
+    b->data = NULL;
+    b->len = 0;
+    b->slots = 0;
+}
+
+int lval_buf_flush(lval_buf* b)
+{
+    if (b->sink != NULL && b->len > 0)
+    {
+        if (!b->sink(b->sink_ctx, b->data, b->len)) { b->failed = 1; }
+        b->flushed += b->len;
+        b->len = 0;
+    }
+
+    return !b->failed;
+}
+
+// Hands the rendered bytes over to the caller, NUL terminated, and leaves
+// the buffer empty but usable.
+char* lval_buf_take(lval_buf* b, size_t* len)
+{
+    lval_buf_putc(b, '\0');
+
+    char* data = realloc(b->data, b->len);
+    if (len) { *len = b->len - 1; }
+
+    b->slots = LVAL_BUF_SIZE;
+    b->data = malloc(b->slots);
+    b->len = 0;
+
+    return data;
+}
+
+static void lval_buf_reserve(lval_buf* b, size_t n)
+{
+    if (b->slots - b->len >= n) { return; }
+
+    // a buffer with a sink passes its bytes on instead of growing past
+    // LVAL_BUF_SINK_MAX, a single bigger piece still gets room of its own
+    if (b->sink != NULL && b->len + n > LVAL_BUF_SINK_MAX)
+    {
+        lval_buf_flush(b);
+        if (b->slots >= n) { return; }
+    }
+
+    while (b->slots - b->len < n) { b->slots *= 2; }
+    b->data = realloc(b->data, b->slots);
+}
+
+void lval_buf_put(lval_buf* b, const char* s, size_t n)
+{
+    lval_buf_reserve(b, n);
+    memcpy(b->data + b->len, s, n);
+    b->len += n;
+}
+
+void lval_buf_puts(lval_buf* b, const char* s)
+{
+    lval_buf_put(b, s, strlen(s));
+}
+
+void lval_buf_putc(lval_buf* b, char c)
+{
+    if (b->len == b->slots) { lval_buf_reserve(b, 1); }
+    b->data[b->len++] = c;
+}
+
+static void lval_buf_print_num(lval_buf* b, lval* val)
+{
+    // numbers are formatted in place, straight into the buffer
+    lval_buf_reserve(b, LVAL_FMT_MAX);
+
+    char* p = b->data + b->len;
+    b->len += val->type == LVAL_INT ? lval_fmt_long(p, val->value.i) : lval_fmt_double(p, val->value.d);
+}
+
+// JSON strings escape quotes, backslashes and control characters, anything
+// else goes through as it is
+static void lval_buf_put_json_string(lval_buf* b, const char* s, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    const unsigned char* end = (const unsigned char*)s + len;
+
+    lval_buf_putc(b, '"');
+    for (const unsigned char* p = (const unsigned char*)s; p < end; p++)
+    {
+        switch (*p)
+        {
+            case '"': lval_buf_put(b, "\\\"", 2); break;
+            case '\\': lval_buf_put(b, "\\\\", 2); break;
+            case '\n': lval_buf_put(b, "\\n", 2); break;
+            case '\r': lval_buf_put(b, "\\r", 2); break;
+            case '\t': lval_buf_put(b, "\\t", 2); break;
+            default:
+                if (*p < 0x20)
+                {
+                    char u[6] = { '\\', 'u', '0', '0', hex[*p >> 4], hex[*p & 15] };
+                    lval_buf_put(b, u, 6);
+                }
+                else
+                {
+                    lval_buf_putc(b, (char)*p);
+                }
+                break;
+        }
+    }
+    lval_buf_putc(b, '"');
+}
+
+static void lval_buf_put_json_error(lval_buf* b, lval_error code, const char* msg, size_t len)
+{
+    lval_buf_put(b, "{\"error\":\"", 10);
+    lval_buf_puts(b, lval_error_name(code));
+    lval_buf_put(b, "\",\"message\":", 12);
+    lval_buf_put_json_string(b, msg, len);
+    lval_buf_putc(b, '}');
+}
+
+// Where printing the current result has to stop, and whether it already
+// has.
+typedef struct lval_print_state
+{
+    size_t end;
+    int cut;
+} lval_print_state;
+
+static void lval_buf_print_val(lval_buf* b, lval* val, long depth, lval_print_state* st);
+
+// What is left out is marked with ... in text and with a "..." string in
+// JSON, which keeps the document valid
+static void lval_buf_put_elided(lval_buf* b)
+{
+    if (b->format == LVAL_FORMAT_JSON) { lval_buf_put(b, "\"...\"", 5); }
+    else { lval_buf_put(b, "...", 3); }
+}
+
+static int lval_buf_over_budget(lval_buf* b, lval_print_state* st)
+{
+    if (st->cut) { return 1; }
+    if (b->limits.bytes == 0 || b->flushed + b->len < st->end) { return 0; }
+
+    lval_buf_put_elided(b);
+    st->cut = 1;
+    return 1;
+}
+
+static void lval_buf_print_expr(lval_buf* b, lval* val, char open, char close, long depth, lval_print_state* st)
+{
+    char sep = b->format == LVAL_FORMAT_JSON ? ',' : ' ';
+
+    lval_buf_putc(b, open);
+
+    if (b->limits.depth > 0 && depth >= b->limits.depth && val->count > 0)
+    {
+        lval_buf_put_elided(b);
+        lval_buf_putc(b, close);
+        return;
+    }
+
+    for (int i = 0; i < val->count; i++)
+    {
+        if (st->cut) { break; }
+
+        if (i > 0)
+        {
+            lval_buf_putc(b, sep);
+        }
+
+        if (b->limits.length > 0 && i >= b->limits.length)
+        {
+            lval_buf_put_elided(b);
+            break;
+        }
+
+        if (lval_buf_over_budget(b, st)) { break; }
+        lval_buf_print_val(b, val->cell[i], depth + 1, st);
+    }
+
+    lval_buf_putc(b, close);
+}
+
+static void lval_buf_print_json(lval_buf* b, lval* val, long depth, lval_print_state* st)
+{
+    switch (val->type)
+    {
+        case LVAL_INT: lval_buf_print_num(b, val); break;
+        case LVAL_FLOAT:
+            // JSON has no way to write these
+            if (isfinite(val->value.d)) { lval_buf_print_num(b, val); }
+            else { lval_buf_put(b, "null", 4); }
+            break;
+        case LVAL_SYM: lval_buf_put_json_string(b, val->value.sym, strlen(val->value.sym)); break;
+        case LVAL_ERR: lval_buf_put_json_error(b, val->code, val->value.err, strlen(val->value.err)); break;
+        case LVAL_SEXPR: lval_buf_print_expr(b, val, '[', ']', depth, st); break;
+    }
+}
+
+static void lval_buf_print_val(lval_buf* b, lval* val, long depth, lval_print_state* st)
+{
+    if (b->format == LVAL_FORMAT_JSON)
+    {
+        lval_buf_print_json(b, val, depth, st);
+        return;
+    }
+
+    switch (val->type)
+    {
+        case LVAL_INT: lval_buf_print_num(b, val); break;
+        case LVAL_FLOAT: lval_buf_print_num(b, val); break;
+        case LVAL_SYM: lval_buf_puts(b, val->value.sym); break;
+        case LVAL_ERR:
+            lval_buf_put(b, "Error: ", 7);
+            lval_buf_puts(b, val->value.err);
+            break;
+        case LVAL_SEXPR: lval_buf_print_expr(b, val, '(', ')', depth, st); break;
+    }
+}
+
+static void lval_print_state_init(lval_buf* b, lval_print_state* st)
+{
+    st->end = b->flushed + b->len + b->limits.bytes;
+    st->cut = 0;
+}
+
+void lval_buf_print(lval_buf* b, lval* val)
+{
+    lval_print_state st;
+    lval_print_state_init(b, &st);
+    lval_buf_print_val(b, val, 0, &st);
+}
+
+void lval_buf_println(lval_buf* b, lval* val)
+{
+    lval_buf_print(b, val);
+    lval_buf_putc(b, '\n');
+}
+
+void lval_buf_error(lval_buf* b, lval_error code, const char* msg)
+{
+    if (b->format != LVAL_FORMAT_JSON)
+    {
+        lval_buf_puts(b, msg);
+        return;
+    }
+
+    // one line per document, the message keeps everything but the newline
+    size_t len = strlen(msg);
+    if (len > 0 && msg[len - 1] == '\n') { len--; }
+
+    lval_buf_put_json_error(b, code, msg, len);
+    lval_buf_putc(b, '\n');
+}
+
+int lval_file_sink(void* ctx, const char* data, size_t len)
+{
+    FILE* f = ctx;
+
+#ifndef _WIN32
+    int fd = fileno(f);
+    if (fd >= 0)
+    {
+        // whatever stdio still holds was written before us
+        if (fflush(f) != 0) { return 0; }
+
+        while (len > 0)
+        {
+            ssize_t n = write(fd, data, len);
+            if (n < 0)
+            {
+                if (errno == EINTR) { continue; }
+                return 0;
+            }
+
+            data += n;
+            len -= n;
+        }
+
+        return 1;
+    }
+#endif
+
+    return fwrite(data, 1, len, f) == len;
+}
+
+char* lval_to_string(lval* val, size_t* len)
+{
+    lval_buf b;
+    lval_buf_init(&b, NULL, NULL);
+    lval_buf_print(&b, val);
+
+    char* s = lval_buf_take(&b, len);
+    lval_buf_free(&b);
+
+    return s;
+}
+
+char* lval_to_json(lval* val, size_t* len)
+{
+    lval_buf b;
+    lval_buf_init(&b, NULL, NULL);
+    b.format = LVAL_FORMAT_JSON;
+    lval_buf_print(&b, val);
+
+    char* s = lval_buf_take(&b, len);
+    lval_buf_free(&b);
+
+    return s;
+}
+
+// The stdio style entry points render the whole value first and then hand
+// it to the stream in one go.
+
+void lval_expr_print_to(lval* val, char open, char close, FILE* f)
+{
+    lval_buf b;
+    lval_buf_init(&b, lval_file_sink, f);
+
+    lval_print_state st;
+    lval_print_state_init(&b, &st);
+    lval_buf_print_expr(&b, val, open, close, 0, &st);
+    lval_buf_flush(&b);
+    lval_buf_free(&b);
+}
+
+void lval_print_to(lval* val, FILE* f)
+{
+    lval_buf b;
+    lval_buf_init(&b, lval_file_sink, f);
+    lval_buf_print(&b, val);
+    lval_buf_flush(&b);
+    lval_buf_free(&b);
+}
+
+void lval_println_to(lval* val, FILE* f)
+{
+    lval_buf b;
+    lval_buf_init(&b, lval_file_sink, f);
+    lval_buf_println(&b, val);
+    lval_buf_flush(&b);
+    lval_buf_free(&b);
+}
+
+void lval_expr_print(lval* val, char open, char close)
+{
+    lval_expr_print_to(val, open, close, stdout);
+}
+
+void lval_print(lval* val)
+{
+    lval_print_to(val, stdout);
+}
+
+void lval_println(lval* val)
+{
+    lval_println_to(val, stdout);
+}
@@ -0,0 +1,95 @@
+#ifndef print_h
+#define print_h
+
+#include <stdio.h>
+#include <stddef.h>
+#include "parsing.h"
+
+// Values are rendered into a growable byte buffer instead of going through
+// stdio one element at a time. A buffer can have a sink, in which case it
+// is handed everything rendered so far whenever it fills up or is flushed,
+// otherwise it just keeps growing and the caller takes the bytes.
+
+// size a buffer starts out with
+#define LVAL_BUF_SIZE 4096
+
+// the most a buffer with a sink holds on to before it passes everything on,
+// anything rendered between two flushes that fits goes out in one write
+#define LVAL_BUF_SINK_MAX (64 * 1024)
+
+// Limits on how much of a value gets printed, 0 means no limit. Lists
+// longer than length show their first length elements and then "...",
+// lists nested deeper than depth show as "(...)", and once bytes have been
+// written for one result the rest of it is left out as "...". Printing
+// stops walking the value as soon as a limit is hit.
+typedef struct lval_print_limits
+{
+    long length;
+    long depth;
+    size_t bytes;
+} lval_print_limits;
+
+// the byte budget the REPL starts out with, enough for anything anyone
+// would read but small enough that printing never stalls the session
+#define LVAL_PRINT_REPL_BYTES (1024 * 1024)
+
+// Text is what the REPL has always shown. JSON writes every result as one
+// compact document on a line of its own: numbers as numbers, symbols as
+// strings, sexprs as arrays and errors as
+//
+//     {"error":"division_by_zero","message":"Division by zero"}
+//
+// Floats that JSON cannot represent, infinities and NaN, become null.
+typedef enum { LVAL_FORMAT_TEXT, LVAL_FORMAT_JSON } lval_format;
+
+// A sink gets the bytes and returns 0 if they could not be written
+typedef int (*lval_sink)(void*, const char*, size_t);
+
+typedef struct lval_buf
+{
+    char* data;
+    size_t len;
+    size_t slots;
+
+    lval_sink sink;
+    void* sink_ctx;
+    size_t flushed; // bytes passed to the sink so far
+    int failed;
+
+    lval_print_limits limits;
+    lval_format format;
+} lval_buf;
+
+void lval_buf_init(lval_buf*, lval_sink, void*);
+void lval_buf_free(lval_buf*);
+int lval_buf_flush(lval_buf*);
+char* lval_buf_take(lval_buf*, size_t*);
+
+void lval_buf_put(lval_buf*, const char*, size_t);
+void lval_buf_puts(lval_buf*, const char*);
+void lval_buf_putc(lval_buf*, char);
+
+void lval_buf_print(lval_buf*, lval*);
+void lval_buf_println(lval_buf*, lval*);
+
+// Reports an error that is not a value, like a parse error. Text shows msg
+// as it is, JSON wraps it in an error document.
+void lval_buf_error(lval_buf*, lval_error, const char*);
+
+void lval_expr_print(lval*, char, char);
+void lval_print(lval*);
+void lval_println(lval*);
+void lval_expr_print_to(lval*, char, char, FILE*);
+void lval_print_to(lval*, FILE*);
+void lval_println_to(lval*, FILE*);
+
+// A sink for stdio streams. Anything the stream still buffers goes out
+// first, then the bytes are passed to the file descriptor in one write.
+int lval_file_sink(void*, const char*, size_t);
+
+// Renders a value and returns the bytes, NUL terminated, for the caller
+// to free. len may be NULL.
+char* lval_to_string(lval*, size_t*);
+char* lval_to_json(lval*, size_t*);
+
+#endif
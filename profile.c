@@ -0,0 +1,208 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "profile.h"
+#include "ctx.h"
+
+void lispy_hdr_init(lispy_hdr* h)
+{
+    memset(h, 0, sizeof(lispy_hdr));
+}
+
+// Values below LISPY_HDR_SUB get a bucket each. Above that every power of
+// two is split into LISPY_HDR_SUB / 2 buckets of equal width.
+static int lispy_hdr_index(long long v)
+{
+    if (v < 0) { v = 0; }
+    if (v < LISPY_HDR_SUB) { return (int)v; }
+
+    int top = LISPY_HDR_SUB_BITS;
+    while (top < 62 && (v >> (top + 1)) != 0) { top++; }
+
+    int shift = top - (LISPY_HDR_SUB_BITS - 1);
+    return LISPY_HDR_SUB + (shift - 1) * (LISPY_HDR_SUB / 2) + (int)(v >> shift) - LISPY_HDR_SUB / 2;
+}
+
+// the largest value that lands in bucket i
+static long long lispy_hdr_highest(int i)
+{
+    if (i < LISPY_HDR_SUB) { return i; }
+
+    int j = i - LISPY_HDR_SUB;
+    int shift = j / (LISPY_HDR_SUB / 2) + 1;
+    long long sub = j % (LISPY_HDR_SUB / 2) + LISPY_HDR_SUB / 2;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+void lispy_hdr_record(lispy_hdr* h, long long v)
+{
+    if (h->count == 0 || v < h->min) { h->min = v; }
+    if (h->count == 0 || v > h->max) { h->max = v; }
+
+    h->count++;
+    h->sum += v;
+    h->buckets[lispy_hdr_index(v)]++;
+}
+
+long long lispy_hdr_percentile(lispy_hdr* h, double q)
+{
+    if (h->count == 0) { return 0; }
+
+    unsigned long want = (unsigned long)(q * h->count + 0.5);
+    if (want < 1) { want = 1; }
+
+    unsigned long seen = 0;
+    for (int i = 0; i < LISPY_HDR_BUCKETS; i++)
+    {
+        seen += h->buckets[i];
+        if (seen >= want)
+        {
+            long long v = lispy_hdr_highest(i);
+            return v < h->max ? v : h->max;
+        }
+    }
+
+    return h->max;
+}
+
+lispy_profile* lispy_profile_new(void)
+{
+    lispy_profile* p = malloc(sizeof(lispy_profile));
+    memset(p, 0, sizeof(lispy_profile));
+
+    for (int i = 0; i < PROF_PHASES; i++) { lispy_hdr_init(&p->phases[i]); }
+    lispy_hdr_init(&p->total);
+
+    return p;
+}
+
+void lispy_profile_del(lispy_profile* p)
+{
+    free(p);
+}
+
+static unsigned long lispy_profile_allocs(void)
+{
+    lispy_stats* s = &lispy_ctx_get()->stats;
+    return s->lval_new + s->lval_reused;
+}
+
+void lispy_profile_begin(lispy_profile* p, lispy_phase phase)
+{
+    p->phase = phase;
+    p->start_allocs = lispy_profile_allocs();
+    p->start = lispy_clock_ns();
+}
+
+void lispy_profile_end(lispy_profile* p)
+{
+    long long now = lispy_clock_ns();
+    lispy_phase phase = p->phase;
+
+    // a phase can run more than once a line, a cache miss reads after the
+    // lookup did
+    p->ran[phase] = 1;
+    p->ns[phase] += now - p->start;
+    p->allocs[phase] += lispy_profile_allocs() - p->start_allocs;
+}
+
+void lispy_profile_nodes(lispy_profile* p, unsigned long nodes)
+{
+    p->nodes[p->phase] += nodes;
+}
+
+static const char* lispy_phase_names[] = { "parse", "read", "eval", "print" };
+
+// Durations get the unit that keeps them short
+static void lispy_profile_time(char* buf, size_t len, double ns)
+{
+    if (ns < 1e3) { snprintf(buf, len, "%.0fns", ns); }
+    else if (ns < 1e6) { snprintf(buf, len, "%.1fus", ns / 1e3); }
+    else if (ns < 1e9) { snprintf(buf, len, "%.1fms", ns / 1e6); }
+    else { snprintf(buf, len, "%.2fs", ns / 1e9); }
+}
+
+void lispy_profile_line(lispy_profile* p, FILE* f)
+{
+    long long total = 0;
+    char t[32];
+
+    for (int i = 0; i < PROF_PHASES; i++)
+    {
+        if (!p->ran[i]) { continue; }
+
+        lispy_hdr_record(&p->phases[i], p->ns[i]);
+        total += p->ns[i];
+
+        if (f)
+        {
+            lispy_profile_time(t, sizeof(t), p->ns[i]);
+            fprintf(f, "%s %s %lua %lun | ", lispy_phase_names[i], t, p->allocs[i], p->nodes[i]);
+        }
+    }
+
+    lispy_hdr_record(&p->total, total);
+    p->lines++;
+
+    if (f)
+    {
+        lispy_profile_time(t, sizeof(t), total);
+        fprintf(f, "total %s\n", t);
+    }
+
+    memset(p->ran, 0, sizeof(p->ran));
+    memset(p->ns, 0, sizeof(p->ns));
+    memset(p->allocs, 0, sizeof(p->allocs));
+    memset(p->nodes, 0, sizeof(p->nodes));
+}
+
+static void lispy_profile_row(FILE* f, const char* name, lispy_hdr* h)
+{
+    static const double qs[] = { 0.5, 0.9, 0.99, 0.999 };
+    char t[32];
+
+    fprintf(f, "%-6s %8lu", name, h->count);
+    if (h->count == 0)
+    {
+        fputc('\n', f);
+        return;
+    }
+
+    lispy_profile_time(t, sizeof(t), h->sum / h->count);
+    fprintf(f, " %9s", t);
+    for (int i = 0; i < 4; i++)
+    {
+        lispy_profile_time(t, sizeof(t), lispy_hdr_percentile(h, qs[i]));
+        fprintf(f, " %9s", t);
+    }
+    lispy_profile_time(t, sizeof(t), h->max);
+    fprintf(f, " %9s\n", t);
+}
+
+void lispy_profile_report(lispy_profile* p, FILE* f)
+{
+    fprintf(f, "%lu lines profiled (a = lvals allocated, n = nodes)\n", p->lines);
+    fprintf(f, "%-6s %8s %9s %9s %9s %9s %9s %9s\n", "phase", "count", "mean", "p50", "p90", "p99", "p99.9", "max");
+
+    for (int i = 0; i < PROF_PHASES; i++) { lispy_profile_row(f, lispy_phase_names[i], &p->phases[i]); }
+    lispy_profile_row(f, "line", &p->total);
+}
+
+unsigned long lispy_profile_ast_nodes(mpc_ast_t* t)
+{
+    unsigned long n = 1;
+    for (int i = 0; i < t->children_num; i++) { n += lispy_profile_ast_nodes(t->children[i]); }
+
+    return n;
+}
+
+unsigned long lispy_profile_lval_nodes(lval* val)
+{
+    unsigned long n = 1;
+    if (val->type != LVAL_SEXPR) { return n; }
+
+    for (int i = 0; i < val->count; i++) { n += lispy_profile_lval_nodes(val->cell[i]); }
+
+    return n;
+}
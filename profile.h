@@ -0,0 +1,81 @@
+#ifndef profile_h
+#define profile_h
+
+#include <stdio.h>
+#include "parsing.h"
+
+// Where the time of a REPL line goes. Every line is split into the phases
+// below and each is timed with a monotonic clock, along with the lvals it
+// allocated and the nodes it went through:
+//
+//     parse  mpc_parse, or the reader for lines that go on a form, nodes
+//            are AST nodes
+//     read   lval_read or a copy out of the cache, nodes are lvals built
+//     eval   lval_eval, nodes are evaluation steps
+//     print  rendering the result, nodes are lvals printed
+//
+// A profile belongs to one thread and is switched on by making it the
+// profile of that thread's context, the hooks cost one test when it is not.
+
+typedef enum { PROF_PARSE, PROF_READ, PROF_EVAL, PROF_PRINT, PROF_PHASES } lispy_phase;
+
+// Latencies are kept in HDR histograms: buckets are exact below
+// LISPY_HDR_SUB and grow with the value above it, so every recorded value
+// is known to within 1 part in LISPY_HDR_SUB / 2 whatever its size
+#define LISPY_HDR_SUB_BITS 7
+#define LISPY_HDR_SUB (1 << LISPY_HDR_SUB_BITS)
+#define LISPY_HDR_BUCKETS ((64 - LISPY_HDR_SUB_BITS + 1) * (LISPY_HDR_SUB / 2) + LISPY_HDR_SUB / 2)
+
+typedef struct lispy_hdr
+{
+    unsigned long count;
+    long long min;
+    long long max;
+    double sum;
+    unsigned long buckets[LISPY_HDR_BUCKETS];
+} lispy_hdr;
+
+void lispy_hdr_init(lispy_hdr*);
+void lispy_hdr_record(lispy_hdr*, long long);
+
+// the value below which the given fraction of what was recorded lies
+long long lispy_hdr_percentile(lispy_hdr*, double);
+
+typedef struct lispy_profile
+{
+    // the line under way
+    int ran[PROF_PHASES];
+    long long ns[PROF_PHASES];
+    unsigned long allocs[PROF_PHASES];
+    unsigned long nodes[PROF_PHASES];
+
+    // the phase under way and where it started
+    lispy_phase phase;
+    long long start;
+    unsigned long start_allocs;
+
+    unsigned long lines;
+    lispy_hdr phases[PROF_PHASES];
+    lispy_hdr total;
+} lispy_profile;
+
+lispy_profile* lispy_profile_new(void);
+void lispy_profile_del(lispy_profile*);
+
+void lispy_profile_begin(lispy_profile*, lispy_phase);
+void lispy_profile_end(lispy_profile*);
+
+// Counts nodes for the phase that just ended, after the clock has stopped
+void lispy_profile_nodes(lispy_profile*, unsigned long);
+
+// A line is done: its phases go into the histograms and, if f is not NULL,
+// a breakdown of the line is written to f
+void lispy_profile_line(lispy_profile*, FILE*);
+
+// Percentiles of every phase and of whole lines
+void lispy_profile_report(lispy_profile*, FILE*);
+
+unsigned long lispy_profile_ast_nodes(mpc_ast_t*);
+unsigned long lispy_profile_lval_nodes(lval*);
+
+#endif
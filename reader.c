@@ -0,0 +1,407 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "reader.h"
+#include "ctx.h"
+#include "profile.h"
+
+// The tokens are the same ones the Lispy grammar in main accepts:
+//
+//     flt     : /-?[0-9]+([.][0-9]+)/
+//     integer : /-?[0-9]+/
+//     symbol  : '+' | '-' | '*' | '/' | '%'
+//
+// tried in that order, so "-" followed by a digit starts a number, "1-2" is
+// two numbers and "1." is the number 1 followed by a stray '.'.
+//
+// Tokens are recognised one character at a time by a small state machine so
+// that a token cut in half between two calls to lval_reader_feed can simply
+// pick up where it left off.
+
+void lval_reader_init(lval_reader* r, const char* filename)
+{
+    r->filename = filename;
+
+    r->depth = 0;
+    r->stack_slots = 0;
+    r->stack = NULL;
+
+    r->tok_state = TOK_NONE;
+    r->tok_len = 0;
+    r->tok_slots = 0;
+    r->tok = NULL;
+
+    r->row = 0;
+    r->col = 0;
+
+    r->error = NULL;
+}
+
+static void lval_reader_drop(lval_reader* r)
+{
+    // the lists above the bottom one are not yet linked into their parents
+    if (r->stack_slots > 0 && r->stack[0] != NULL)
+    {
+        for (int i = 0; i <= r->depth; i++)
+        {
+            lval_del(r->stack[i]);
+            r->stack[i] = NULL;
+        }
+    }
+
+    r->depth = 0;
+    r->tok_state = TOK_NONE;
+    r->tok_len = 0;
+}
+
+void lval_reader_reset(lval_reader* r)
+{
+    lval_reader_drop(r);
+
+    free(r->error);
+    r->error = NULL;
+
+    r->row = 0;
+    r->col = 0;
+}
+
+void lval_reader_free(lval_reader* r)
+{
+    lval_reader_reset(r);
+
+    free(r->stack);
+    free(r->tok);
+}
+
+int lval_reader_pending(lval_reader* r)
+{
+    return r->error == NULL && r->depth > 0;
+}
+
+void lval_reader_prompt(lval_reader* r, char* buf, size_t size)
+{
+    // one '(' per list still open, e.g. "lispy((> " inside two lists
+    if (r->depth <= 8)
+    {
+        snprintf(buf, size, "lispy%.*s> ", r->depth, "((((((((");
+    }
+    else
+    {
+        snprintf(buf, size, "lispy(*%d> ", r->depth);
+    }
+}
+
+static void lval_reader_error(lval_reader* r, const char* what)
+{
+    size_t size = strlen(r->filename) + strlen(what) + 64;
+    r->error = malloc(size);
+    snprintf(r->error, size, "%s:%ld:%ld: error: %s\n",
+        r->filename, r->row + 1, r->col + 1, what);
+    lispy_ctx_get()->stats.errors[LERR_PARSE]++;
+
+    lval_reader_drop(r);
+}
+
+static void lval_reader_fail(lval_reader* r, char c)
+{
+    char what[32];
+    if (c == '\0') { snprintf(what, sizeof(what), "unexpected end of input"); }
+    else { snprintf(what, sizeof(what), "unexpected '%c'", c); }
+
+    lval_reader_error(r, what);
+}
+
+static void lval_reader_emit(lval_reader* r, lval* x)
+{
+    lval_add(r->stack[r->depth], x);
+}
+
+static void lval_reader_tok_push(lval_reader* r, char c)
+{
+    if (r->tok_len + 2 > r->tok_slots)
+    {
+        r->tok_slots = r->tok_slots ? r->tok_slots * 2 : 32;
+        r->tok = realloc(r->tok, r->tok_slots);
+    }
+
+    r->tok[r->tok_len++] = c;
+}
+
+static void lval_reader_tok_emit(lval_reader* r)
+{
+    switch (r->tok_state)
+    {
+        case TOK_NONE: return;
+        case TOK_MINUS: lval_reader_emit(r, lval_sym("-")); break;
+
+        // a dangling '.' is not part of the number, the caller deals with it
+        case TOK_DOT: r->tok_len--; // fallthrough
+        case TOK_INT:
+        {
+            r->tok[r->tok_len] = '\0';
+            errno = 0;
+            long x = strtol(r->tok, NULL, 10);
+            lval_reader_emit(r, errno != ERANGE ? lval_int(x) : lval_err(LERR_BAD_NUM, "Invalid number"));
+            break;
+        }
+
+        case TOK_FRAC:
+            r->tok[r->tok_len] = '\0';
+            lval_reader_emit(r, lval_float(atof(r->tok)));
+            break;
+    }
+
+    r->tok_state = TOK_NONE;
+    r->tok_len = 0;
+}
+
+static int lval_reader_open(lval_reader* r)
+{
+    if (r->depth >= LVAL_READER_DEPTH_MAX) { return 0; }
+
+    r->depth++;
+    if (r->depth >= r->stack_slots)
+    {
+        r->stack_slots = r->stack_slots * 2;
+        r->stack = realloc(r->stack, sizeof(lval*) * r->stack_slots);
+    }
+
+    r->stack[r->depth] = lval_sexpr();
+    return 1;
+}
+
+static int lval_reader_close(lval_reader* r)
+{
+    if (r->depth == 0) { return 0; }
+
+    lval* x = r->stack[r->depth];
+    r->stack[r->depth] = NULL;
+    r->depth--;
+    lval_reader_emit(r, x);
+    return 1;
+}
+
+lval_reader_status lval_reader_feed(lval_reader* r, const char* text, size_t len)
+{
+    if (r->error) { return LVAL_READER_ERROR; }
+
+    if (r->stack_slots == 0)
+    {
+        r->stack_slots = 8;
+        r->stack = calloc(r->stack_slots, sizeof(lval*));
+    }
+
+    if (r->stack[0] == NULL) { r->stack[0] = lval_sexpr(); }
+
+    size_t i = 0;
+    while (i < len)
+    {
+        char c = text[i];
+        int digit = c >= '0' && c <= '9';
+
+        // finish off or extend the token we are in the middle of, either
+        // consuming c or leaving it to be looked at again as a fresh token
+        if (r->tok_state != TOK_NONE)
+        {
+            lval_token_state next = r->tok_state;
+
+            switch (r->tok_state)
+            {
+                case TOK_MINUS: next = digit ? TOK_INT : TOK_NONE; break;
+                case TOK_INT: next = digit ? TOK_INT : (c == '.' ? TOK_DOT : TOK_NONE); break;
+                case TOK_DOT: next = digit ? TOK_FRAC : TOK_NONE; break;
+                case TOK_FRAC: next = digit ? TOK_FRAC : TOK_NONE; break;
+                case TOK_NONE: break;
+            }
+
+            if (next != TOK_NONE)
+            {
+                lval_reader_tok_push(r, c);
+                r->tok_state = next;
+                r->col++;
+                i++;
+                continue;
+            }
+
+            int dot = r->tok_state == TOK_DOT;
+            lval_reader_tok_emit(r);
+
+            if (dot)
+            {
+                r->col--;
+                lval_reader_fail(r, '.');
+                return LVAL_READER_ERROR;
+            }
+        }
+
+        if (digit || c == '-')
+        {
+            r->tok_state = digit ? TOK_INT : TOK_MINUS;
+            lval_reader_tok_push(r, c);
+        }
+        else if (c == '(')
+        {
+            if (!lval_reader_open(r))
+            {
+                char what[64];
+                snprintf(what, sizeof(what), "lists nested deeper than %d", LVAL_READER_DEPTH_MAX);
+                lval_reader_error(r, what);
+                return LVAL_READER_ERROR;
+            }
+        }
+        else if (c == ')')
+        {
+            if (!lval_reader_close(r))
+            {
+                lval_reader_fail(r, c);
+                return LVAL_READER_ERROR;
+            }
+        }
+        else if (c == '+' || c == '*' || c == '/' || c == '%')
+        {
+            char s[2] = { c, '\0' };
+            lval_reader_emit(r, lval_sym(s));
+        }
+        else if (!strchr(" \f\n\r\t\v", c))
+        {
+            lval_reader_fail(r, c);
+            return LVAL_READER_ERROR;
+        }
+
+        if (c == '\n') { r->row++; r->col = 0; }
+        else { r->col++; }
+        i++;
+    }
+
+    return LVAL_READER_MORE;
+}
+
+lval_reader_status lval_reader_feed_line(lval_reader* r, const char* line)
+{
+    // the end of the line ends any token, a form is complete once every
+    // list opened so far has been closed again
+    lval_reader_status s = lval_reader_feed(r, line, strlen(line));
+    if (s == LVAL_READER_MORE) { s = lval_reader_feed(r, "\n", 1); }
+    if (s == LVAL_READER_MORE && r->depth == 0) { s = LVAL_READER_DONE; }
+
+    return s;
+}
+
+lval* lval_reader_take(lval_reader* r)
+{
+    lval* x = r->stack[0];
+    r->stack[0] = NULL;
+    return x;
+}
+
+lval_reader_status lval_reader_finish(lval_reader* r)
+{
+    // input ran out, anything still open can never be completed
+    if (r->error) { return LVAL_READER_ERROR; }
+    if (r->depth == 0) { return LVAL_READER_DONE; }
+
+    lval_reader_fail(r, '\0');
+    return LVAL_READER_ERROR;
+}
+
+// Whether input opens more lists at once than the reader takes
+static int lval_reader_too_deep(const char* input)
+{
+    long depth = 0;
+
+    for (const char* p = input; *p; p++)
+    {
+        if (*p == '(' && ++depth > LVAL_READER_DEPTH_MAX) { return 1; }
+        if (*p == ')' && depth > 0) { depth--; }
+    }
+
+    return 0;
+}
+
+lval* lval_reader_read_line(lval_reader* r, mpc_parser_t* Lispy, lval_cache* cache, const char* input, lval_buf* out)
+{
+    lval* val = NULL;
+    lispy_profile* prof = lispy_ctx_get()->profile;
+
+    // lines nested too deeply never get to mpc, whose ASTs would be just
+    // as deep, the reader turns them down where they go too deep
+    if (lval_reader_pending(r) || lval_reader_too_deep(input))
+    {
+        if (prof) { lispy_profile_begin(prof, PROF_PARSE); }
+        lval_reader_status status = lval_reader_feed_line(r, input);
+        if (prof) { lispy_profile_end(prof); }
+
+        switch (status)
+        {
+            case LVAL_READER_MORE: break;
+            case LVAL_READER_DONE:
+                val = lval_reader_take(r);
+                lval_reader_reset(r);
+                lispy_ctx_get()->stats.forms++;
+                break;
+            case LVAL_READER_ERROR:
+                lval_buf_error(out, LERR_PARSE, r->error);
+                lval_reader_reset(r);
+                break;
+        }
+
+        return val;
+    }
+
+    if (cache)
+    {
+        if (prof) { lispy_profile_begin(prof, PROF_READ); }
+        val = lval_cache_get(cache, input);
+        if (prof) { lispy_profile_end(prof); }
+        if (prof && val) { lispy_profile_nodes(prof, lispy_profile_lval_nodes(val)); }
+    }
+
+    if (val != NULL)
+    {
+        lispy_ctx_get()->stats.forms++;
+        return val;
+    }
+
+    mpc_result_t res;
+    lispy_ctx* ctx = lispy_ctx_get();
+
+    if (prof) { lispy_profile_begin(prof, PROF_PARSE); }
+    int ok = mpc_parse_with_ctx(lispy_ctx_parser(ctx), r->filename, input, Lispy, &res, &ctx->stats.mpc);
+    if (prof) { lispy_profile_end(prof); }
+    if (prof && ok) { lispy_profile_nodes(prof, lispy_profile_ast_nodes(res.output)); }
+
+    if (ok)
+    {
+        if (prof) { lispy_profile_begin(prof, PROF_READ); }
+        val = lval_read(res.output);
+        if (prof)
+        {
+            lispy_profile_end(prof);
+            lispy_profile_nodes(prof, lispy_profile_lval_nodes(val));
+        }
+
+        mpc_ast_delete(res.output);
+        if (cache) { lval_cache_put(cache, input, val); }
+        lispy_ctx_get()->stats.forms++;
+    }
+    else if (res.error->state.pos == (long)strlen(input) &&
+             lval_reader_feed_line(r, input) == LVAL_READER_MORE)
+    {
+        // ran out of line with lists still open, carry on reading
+        mpc_err_delete(res.error);
+    }
+    else
+    {
+        // the reader has counted the error already if it failed on the line too
+        if (r->error == NULL) { lispy_ctx_get()->stats.errors[LERR_PARSE]++; }
+        lval_reader_reset(r);
+        char* msg = mpc_err_string(res.error);
+        lval_buf_error(out, LERR_PARSE, msg);
+        free(msg);
+        mpc_err_delete(res.error);
+    }
+
+    return val;
+}
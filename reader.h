@@ -0,0 +1,64 @@
+#ifndef reader_h
+#define reader_h
+
+#include <stddef.h>
+#include "parsing.h"
+#include "cache.h"
+#include "print.h"
+
+// Incremental reader for Lispy forms that span several lines.
+//
+// Text is fed in as it arrives and the reader keeps everything it needs to
+// carry on from where it stopped: the lists that are still open, the token
+// it was in the middle of, and the position for error messages. Earlier
+// text is never looked at again.
+
+typedef enum { LVAL_READER_MORE, LVAL_READER_DONE, LVAL_READER_ERROR } lval_reader_status;
+
+// Lists nested deeper than this are a read error. Reading, printing and
+// freeing values recurse once per level, and a server shares its stack
+// with every client.
+#define LVAL_READER_DEPTH_MAX 10000
+
+typedef enum { TOK_NONE, TOK_MINUS, TOK_INT, TOK_DOT, TOK_FRAC } lval_token_state;
+
+typedef struct lval_reader
+{
+    const char* filename;
+
+    // stack[0] is the implicit list around a whole input, like the <lispy>
+    // rule; every open paren pushes one more list
+    int depth;
+    int stack_slots;
+    lval** stack;
+
+    lval_token_state tok_state;
+    size_t tok_len;
+    size_t tok_slots;
+    char* tok;
+
+    long row;
+    long col;
+
+    char* error;
+} lval_reader;
+
+void lval_reader_init(lval_reader*, const char*);
+void lval_reader_reset(lval_reader*);
+void lval_reader_free(lval_reader*);
+
+lval_reader_status lval_reader_feed(lval_reader*, const char*, size_t);
+lval_reader_status lval_reader_feed_line(lval_reader*, const char*);
+lval_reader_status lval_reader_finish(lval_reader*);
+lval* lval_reader_take(lval_reader*);
+
+// Turns one line of input into an lval, going through the cache and the mpc
+// parser for complete lines and through the reader while a form spans more
+// than one line. Returns NULL when there is nothing to evaluate yet or the
+// line did not parse, in which case the error has been written to out.
+lval* lval_reader_read_line(lval_reader*, mpc_parser_t*, lval_cache*, const char*, lval_buf*);
+
+int lval_reader_pending(lval_reader*);
+void lval_reader_prompt(lval_reader*, char*, size_t);
+
+#endif
@@ -0,0 +1,653 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#ifdef _WIN32
+#include <stdio.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "serialize.h"
+
+enum { LVB_TAG_INT = 1, LVB_TAG_FLOAT = 2, LVB_TAG_ERR = 3, LVB_TAG_SYM = 4, LVB_TAG_SEXPR = 5 };
+
+#define LVB_HEADER_SIZE 8
+
+static const unsigned char lvb_magic[4] = { 'L', 'V', 'B', '\0' };
+
+/*
+** Writing
+*/
+
+static void lvb_put(lvb_writer* w, const void* p, size_t n)
+{
+    if (fwrite(p, 1, n, w->f) != n) { w->failed = 1; }
+}
+
+static void lvb_put_varint(lvb_writer* w, unsigned long long x)
+{
+    unsigned char b[10];
+    int n = 0;
+
+    while (x >= 0x80)
+    {
+        b[n++] = (unsigned char)(x | 0x80);
+        x >>= 7;
+    }
+    b[n++] = (unsigned char)x;
+
+    lvb_put(w, b, n);
+}
+
+static void lvb_put_u32(lvb_writer* w, unsigned long x)
+{
+    unsigned char b[4] = { x & 0xff, (x >> 8) & 0xff, (x >> 16) & 0xff, (x >> 24) & 0xff };
+    lvb_put(w, b, 4);
+}
+
+static size_t lvb_varint_len(unsigned long long x)
+{
+    size_t n = 1;
+    while (x >= 0x80) { x >>= 7; n++; }
+    return n;
+}
+
+static unsigned long long lvb_zigzag(long x)
+{
+    long long v = x;
+    return ((unsigned long long)v << 1) ^ (unsigned long long)(v >> 63);
+}
+
+lvb_writer* lvb_writer_new(FILE* f)
+{
+    lvb_writer* w = calloc(1, sizeof(lvb_writer));
+    w->f = f;
+
+    unsigned char header[LVB_HEADER_SIZE] = { 0 };
+    memcpy(header, lvb_magic, 4);
+    header[4] = LVB_VERSION;
+    lvb_put(w, header, sizeof(header));
+
+    return w;
+}
+
+int lvb_writer_del(lvb_writer* w)
+{
+    int ok = !w->failed && fflush(w->f) == 0;
+
+    free(w->syms);
+    free(w->syms_table);
+    free(w->sizes);
+    free(w);
+
+    return ok;
+}
+
+static unsigned long lvb_hash(const char* s)
+{
+    unsigned long h = 2166136261UL;
+    while (*s) { h ^= (unsigned char)*s++; h *= 16777619UL; }
+    return h;
+}
+
+static void lvb_intern_grow(lvb_writer* w)
+{
+    // open addressing, kept at most half full
+    w->syms_table_slots = w->syms_table_slots ? w->syms_table_slots * 2 : 16;
+    w->syms_table = realloc(w->syms_table, sizeof(int) * w->syms_table_slots);
+
+    for (int i = 0; i < w->syms_table_slots; i++) { w->syms_table[i] = -1; }
+
+    for (int i = 0; i < w->syms_num; i++)
+    {
+        unsigned long j = lvb_hash(w->syms[i]) & (w->syms_table_slots - 1);
+        while (w->syms_table[j] != -1) { j = (j + 1) & (w->syms_table_slots - 1); }
+        w->syms_table[j] = i;
+    }
+}
+
+static int lvb_intern(lvb_writer* w, const char* s)
+{
+    if ((w->syms_num + 1) * 2 > w->syms_table_slots) { lvb_intern_grow(w); }
+
+    unsigned long j = lvb_hash(s) & (w->syms_table_slots - 1);
+    while (w->syms_table[j] != -1)
+    {
+        if (strcmp(w->syms[w->syms_table[j]], s) == 0) { return w->syms_table[j]; }
+        j = (j + 1) & (w->syms_table_slots - 1);
+    }
+
+    if (w->syms_num == w->syms_slots)
+    {
+        w->syms_slots = w->syms_slots ? w->syms_slots * 2 : 16;
+        w->syms = realloc(w->syms, sizeof(char*) * w->syms_slots);
+    }
+
+    w->syms[w->syms_num] = s;
+    w->syms_table[j] = w->syms_num;
+    return w->syms_num++;
+}
+
+// First pass: intern the symbols and work out how big every sexpr's
+// children are, in the same order the second pass will write them out.
+static size_t lvb_measure(lvb_writer* w, lval* val)
+{
+    switch (val->type)
+    {
+        case LVAL_INT: return 1 + lvb_varint_len(lvb_zigzag(val->value.i));
+        case LVAL_FLOAT: return 1 + 8;
+        case LVAL_SYM: return 1 + lvb_varint_len(lvb_intern(w, val->value.sym));
+        case LVAL_ERR:
+        {
+            size_t len = strlen(val->value.err);
+            return 1 + lvb_varint_len(val->code) + lvb_varint_len(len) + len;
+        }
+        case LVAL_SEXPR: break;
+    }
+
+    if (w->sizes_num == w->sizes_slots)
+    {
+        w->sizes_slots = w->sizes_slots ? w->sizes_slots * 2 : 64;
+        w->sizes = realloc(w->sizes, sizeof(size_t) * w->sizes_slots);
+    }
+
+    int k = w->sizes_num++;
+    size_t children = 0;
+    for (int i = 0; i < val->count; i++)
+    {
+        children += lvb_measure(w, val->cell[i]);
+    }
+    w->sizes[k] = children;
+
+    return 1 + lvb_varint_len(val->count) + lvb_varint_len(children) + children;
+}
+
+static void lvb_emit(lvb_writer* w, lval* val, int* k)
+{
+    unsigned char tag;
+
+    switch (val->type)
+    {
+        case LVAL_INT:
+            tag = LVB_TAG_INT;
+            lvb_put(w, &tag, 1);
+            lvb_put_varint(w, lvb_zigzag(val->value.i));
+            break;
+
+        case LVAL_FLOAT:
+        {
+            unsigned long long bits;
+            unsigned char b[8];
+            memcpy(&bits, &val->value.d, 8);
+            for (int i = 0; i < 8; i++) { b[i] = (unsigned char)(bits >> (8 * i)); }
+
+            tag = LVB_TAG_FLOAT;
+            lvb_put(w, &tag, 1);
+            lvb_put(w, b, 8);
+            break;
+        }
+
+        case LVAL_ERR:
+        {
+            size_t len = strlen(val->value.err);
+            tag = LVB_TAG_ERR;
+            lvb_put(w, &tag, 1);
+            lvb_put_varint(w, val->code);
+            lvb_put_varint(w, len);
+            lvb_put(w, val->value.err, len);
+            break;
+        }
+
+        case LVAL_SYM:
+            // interning the same symbol again just finds it
+            tag = LVB_TAG_SYM;
+            lvb_put(w, &tag, 1);
+            lvb_put_varint(w, lvb_intern(w, val->value.sym));
+            break;
+
+        case LVAL_SEXPR:
+            tag = LVB_TAG_SEXPR;
+            lvb_put(w, &tag, 1);
+            lvb_put_varint(w, val->count);
+            lvb_put_varint(w, w->sizes[(*k)++]);
+            for (int i = 0; i < val->count; i++)
+            {
+                lvb_emit(w, val->cell[i], k);
+            }
+            break;
+    }
+}
+
+int lvb_write(lvb_writer* w, lval* val)
+{
+    w->syms_num = 0;
+    w->sizes_num = 0;
+    for (int i = 0; i < w->syms_table_slots; i++) { w->syms_table[i] = -1; }
+
+    size_t node = lvb_measure(w, val);
+
+    size_t blob = 0;
+    for (int i = 0; i < w->syms_num; i++)
+    {
+        size_t len = strlen(w->syms[i]);
+        blob += lvb_varint_len(len) + len;
+    }
+
+    size_t symtab = lvb_varint_len(w->syms_num) + 4 * w->syms_num + lvb_varint_len(blob) + blob;
+
+    lvb_put_varint(w, symtab + node);
+
+    lvb_put_varint(w, w->syms_num);
+    size_t offset = 0;
+    for (int i = 0; i < w->syms_num; i++)
+    {
+        size_t len = strlen(w->syms[i]);
+        lvb_put_u32(w, offset);
+        offset += lvb_varint_len(len) + len;
+    }
+
+    lvb_put_varint(w, blob);
+    for (int i = 0; i < w->syms_num; i++)
+    {
+        size_t len = strlen(w->syms[i]);
+        lvb_put_varint(w, len);
+        lvb_put(w, w->syms[i], len);
+    }
+
+    int k = 0;
+    lvb_emit(w, val, &k);
+
+    return !w->failed;
+}
+
+/*
+** Reading
+*/
+
+lvb_file* lvb_open(const char* path)
+{
+    lvb_file* f = calloc(1, sizeof(lvb_file));
+
+#ifdef _WIN32
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) { free(f); return NULL; }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    unsigned char* data = malloc(size > 0 ? size : 1);
+    if (size < 0 || fread(data, 1, size, fp) != (size_t)size)
+    {
+        free(data);
+        fclose(fp);
+        free(f);
+        return NULL;
+    }
+    fclose(fp);
+
+    f->data = data;
+    f->size = size;
+    f->mapped = 0;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) { free(f); return NULL; }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < LVB_HEADER_SIZE)
+    {
+        close(fd);
+        free(f);
+        return NULL;
+    }
+
+    void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) { free(f); return NULL; }
+
+    f->data = data;
+    f->size = st.st_size;
+    f->mapped = 1;
+#endif
+
+    if (f->size < LVB_HEADER_SIZE ||
+        memcmp(f->data, lvb_magic, 4) != 0 ||
+        f->data[4] != LVB_VERSION)
+    {
+        lvb_close(f);
+        return NULL;
+    }
+
+    f->pos = LVB_HEADER_SIZE;
+    return f;
+}
+
+void lvb_close(lvb_file* f)
+{
+#ifndef _WIN32
+    if (f->mapped)
+    {
+        munmap((void*)f->data, f->size);
+        free(f);
+        return;
+    }
+#endif
+
+    free((void*)f->data);
+    free(f);
+}
+
+static int lvb_get_varint(const unsigned char** p, const unsigned char* end, unsigned long long* x)
+{
+    *x = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (*p >= end) { return 0; }
+
+        unsigned char b = *(*p)++;
+        *x |= (unsigned long long)(b & 0x7f) << shift;
+        if (!(b & 0x80)) { return 1; }
+    }
+
+    return 0;
+}
+
+// Walks the tree of a record once, without recursing, to make sure every
+// node and every symbol reference lies inside the record, and that every
+// error has a code lispy knows.
+static int lvb_check_tree(const lvb_record* rec, const unsigned char* p, const unsigned char* end)
+{
+    int depth = 0;
+    int slots = 16;
+    unsigned long long* left = malloc(sizeof(unsigned long long) * slots);
+    const unsigned char** ends = malloc(sizeof(unsigned char*) * slots);
+    int ok = 0;
+
+    left[0] = 1;
+    ends[0] = end;
+
+    while (depth >= 0)
+    {
+        unsigned long long x, size;
+
+        if (left[depth] == 0)
+        {
+            if (p != ends[depth]) { goto done; }
+            depth--;
+            continue;
+        }
+
+        left[depth]--;
+        if (p >= ends[depth]) { goto done; }
+
+        switch (*p++)
+        {
+            case LVB_TAG_INT:
+                if (!lvb_get_varint(&p, ends[depth], &x)) { goto done; }
+                break;
+
+            case LVB_TAG_FLOAT:
+                if (ends[depth] - p < 8) { goto done; }
+                p += 8;
+                break;
+
+            case LVB_TAG_ERR:
+                if (!lvb_get_varint(&p, ends[depth], &x)) { goto done; }
+                // codes index the error counts, see lval_eval
+                if (x < 1 || x >= LERR_CODES) { goto done; }
+                if (!lvb_get_varint(&p, ends[depth], &x)) { goto done; }
+                if (x > (unsigned long long)(ends[depth] - p)) { goto done; }
+                p += x;
+                break;
+
+            case LVB_TAG_SYM:
+                if (!lvb_get_varint(&p, ends[depth], &x)) { goto done; }
+                if (x >= (unsigned long long)rec->syms_num) { goto done; }
+                break;
+
+            case LVB_TAG_SEXPR:
+                if (!lvb_get_varint(&p, ends[depth], &x)) { goto done; }
+                if (!lvb_get_varint(&p, ends[depth], &size)) { goto done; }
+                if (size > (unsigned long long)(ends[depth] - p)) { goto done; }
+                // every node takes at least a byte
+                if (x > size || x > INT_MAX) { goto done; }
+
+                if (++depth == slots)
+                {
+                    slots *= 2;
+                    left = realloc(left, sizeof(unsigned long long) * slots);
+                    ends = realloc(ends, sizeof(unsigned char*) * slots);
+                }
+                left[depth] = x;
+                ends[depth] = p + size;
+                break;
+
+            default: goto done;
+        }
+    }
+
+    ok = 1;
+
+done:
+    free(left);
+    free(ends);
+    return ok;
+}
+
+static unsigned long lvb_u32(const unsigned char* p)
+{
+    return (unsigned long)p[0] | ((unsigned long)p[1] << 8) |
+           ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+int lvb_next(lvb_file* f, lvb_record* rec)
+{
+    if (f->pos == f->size) { return 0; }
+
+    const unsigned char* p = f->data + f->pos;
+    const unsigned char* end = f->data + f->size;
+    unsigned long long size, x;
+
+    if (!lvb_get_varint(&p, end, &size)) { return -1; }
+    if (size > (unsigned long long)(end - p)) { return -1; }
+    end = p + size;
+
+    if (!lvb_get_varint(&p, end, &x)) { return -1; }
+    if (x > (unsigned long long)(end - p) / 4) { return -1; }
+    rec->syms_num = (long)x;
+    rec->offsets = p;
+    p += 4 * x;
+
+    unsigned long long blob;
+    if (!lvb_get_varint(&p, end, &blob)) { return -1; }
+    if (blob > (unsigned long long)(end - p)) { return -1; }
+    rec->blob = p;
+    p += blob;
+
+    for (long i = 0; i < rec->syms_num; i++)
+    {
+        unsigned long off = lvb_u32(rec->offsets + 4 * i);
+        if (off >= blob) { return -1; }
+
+        const unsigned char* s = rec->blob + off;
+        if (!lvb_get_varint(&s, rec->blob + blob, &x)) { return -1; }
+        if (x > (unsigned long long)(rec->blob + blob - s)) { return -1; }
+    }
+
+    rec->root = p;
+    if (!lvb_check_tree(rec, p, end)) { return -1; }
+
+    f->pos = end - f->data;
+    return 1;
+}
+
+/*
+** Walking
+*/
+
+static unsigned long long lvb_varint(const unsigned char** p)
+{
+    unsigned long long x = 0;
+    int shift = 0;
+    unsigned char b;
+
+    do
+    {
+        b = *(*p)++;
+        x |= (unsigned long long)(b & 0x7f) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    return x;
+}
+
+lvb_node lvb_root(const lvb_record* rec)
+{
+    lvb_node n = { rec, rec->root };
+    return n;
+}
+
+lval_type lvb_type(lvb_node n)
+{
+    switch (*n.p)
+    {
+        case LVB_TAG_INT: return LVAL_INT;
+        case LVB_TAG_FLOAT: return LVAL_FLOAT;
+        case LVB_TAG_ERR: return LVAL_ERR;
+        case LVB_TAG_SYM: return LVAL_SYM;
+        default: return LVAL_SEXPR;
+    }
+}
+
+long lvb_int(lvb_node n)
+{
+    const unsigned char* p = n.p + 1;
+    unsigned long long z = lvb_varint(&p);
+    return (long)(long long)((z >> 1) ^ (~(z & 1) + 1));
+}
+
+double lvb_float(lvb_node n)
+{
+    unsigned long long bits = 0;
+    double d;
+    for (int i = 0; i < 8; i++) { bits |= (unsigned long long)n.p[1 + i] << (8 * i); }
+    memcpy(&d, &bits, 8);
+    return d;
+}
+
+const char* lvb_str(lvb_node n, size_t* len)
+{
+    const unsigned char* p = n.p + 1;
+
+    if (*n.p == LVB_TAG_SYM)
+    {
+        unsigned long long i = lvb_varint(&p);
+        p = n.rec->blob + lvb_u32(n.rec->offsets + 4 * i);
+    }
+    else
+    {
+        // step over the error code
+        lvb_varint(&p);
+    }
+
+    *len = (size_t)lvb_varint(&p);
+    return (const char*)p;
+}
+
+lval_error lvb_err_code(lvb_node n)
+{
+    const unsigned char* p = n.p + 1;
+    return (lval_error)lvb_varint(&p);
+}
+
+int lvb_count(lvb_node n)
+{
+    const unsigned char* p = n.p + 1;
+    return (int)lvb_varint(&p);
+}
+
+lvb_node lvb_child(lvb_node n)
+{
+    const unsigned char* p = n.p + 1;
+    lvb_varint(&p);
+    lvb_varint(&p);
+
+    lvb_node c = { n.rec, p };
+    return c;
+}
+
+lvb_node lvb_sibling(lvb_node n)
+{
+    const unsigned char* p = n.p + 1;
+
+    switch (*n.p)
+    {
+        case LVB_TAG_INT: lvb_varint(&p); break;
+        case LVB_TAG_FLOAT: p += 8; break;
+        case LVB_TAG_ERR: lvb_varint(&p); p += lvb_varint(&p); break;
+        case LVB_TAG_SYM: lvb_varint(&p); break;
+        case LVB_TAG_SEXPR:
+            lvb_varint(&p);
+            p += lvb_varint(&p);
+            break;
+    }
+
+    lvb_node s = { n.rec, p };
+    return s;
+}
+
+static char* lvb_strdup(lvb_node n)
+{
+    size_t len;
+    const char* s = lvb_str(n, &len);
+    char* x = malloc(len + 1);
+    memcpy(x, s, len);
+    x[len] = '\0';
+    return x;
+}
+
+lval* lvb_to_lval(lvb_node n)
+{
+    lval* x;
+    char* s;
+
+    switch (lvb_type(n))
+    {
+        case LVAL_INT: return lval_int(lvb_int(n));
+        case LVAL_FLOAT: return lval_float(lvb_float(n));
+
+        case LVAL_ERR:
+            s = lvb_strdup(n);
+            x = lval_err(lvb_err_code(n), s);
+            free(s);
+            return x;
+
+        case LVAL_SYM:
+            s = lvb_strdup(n);
+            x = lval_sym(s);
+            free(s);
+            return x;
+
+        case LVAL_SEXPR: break;
+    }
+
+    x = lval_sexpr();
+    int count = lvb_count(n);
+    if (count > 0)
+    {
+        x->cell = malloc(sizeof(lval*) * count);
+        lvb_node c = lvb_child(n);
+        for (int i = 0; i < count; i++)
+        {
+            x->cell[i] = lvb_to_lval(c);
+            c = lvb_sibling(c);
+        }
+        x->count = count;
+    }
+
+    return x;
+}
@@ -0,0 +1,92 @@
+#ifndef serialize_h
+#define serialize_h
+
+#include <stdio.h>
+#include <stddef.h>
+#include "parsing.h"
+
+// LVB, a compact binary format for lval trees.
+//
+// A file is a short header followed by any number of records, one per
+// value. Each record carries its own symbol table so records can be written
+// one at a time and read back in any order:
+//
+//     header  : "LVB" 0x00, version, 3 reserved bytes
+//     record  : varint size, symtab, node
+//     symtab  : varint nsyms, nsyms x u32 offset, varint blob size, blob
+//     blob    : per symbol a varint length and the bytes of the name
+//     node    : 0x01 zigzag varint                  (int)
+//             | 0x02 8 bytes little endian IEEE 754 (float)
+//             | 0x03 varint code, varint length, bytes  (error)
+//             | 0x04 varint symbol index            (symbol)
+//             | 0x05 varint count, varint size, count x node  (sexpr)
+//
+// Sexprs store the size of their children so a reader can step over a whole
+// subtree without looking inside it.
+
+#define LVB_VERSION 2
+
+typedef struct lvb_writer
+{
+    FILE* f;
+    int failed;
+
+    // scratch space reused between records
+    int syms_num;
+    int syms_slots;
+    const char** syms;
+    int* syms_table;
+    int syms_table_slots;
+
+    int sizes_num;
+    int sizes_slots;
+    size_t* sizes;
+} lvb_writer;
+
+lvb_writer* lvb_writer_new(FILE*);
+int lvb_write(lvb_writer*, lval*);
+int lvb_writer_del(lvb_writer*);
+
+// Reading maps the file and walks records in place. lvb_next checks a whole
+// record before handing it out, after that nodes can be walked without any
+// further bounds checks.
+
+typedef struct lvb_file
+{
+    const unsigned char* data;
+    size_t size;
+    size_t pos;
+    int mapped;
+} lvb_file;
+
+typedef struct lvb_record
+{
+    long syms_num;
+    const unsigned char* offsets;
+    const unsigned char* blob;
+    const unsigned char* root;
+} lvb_record;
+
+typedef struct lvb_node
+{
+    const lvb_record* rec;
+    const unsigned char* p;
+} lvb_node;
+
+lvb_file* lvb_open(const char*);
+void lvb_close(lvb_file*);
+int lvb_next(lvb_file*, lvb_record*);
+
+lvb_node lvb_root(const lvb_record*);
+lval_type lvb_type(lvb_node);
+long lvb_int(lvb_node);
+double lvb_float(lvb_node);
+const char* lvb_str(lvb_node, size_t*);
+lval_error lvb_err_code(lvb_node);
+int lvb_count(lvb_node);
+lvb_node lvb_child(lvb_node);
+lvb_node lvb_sibling(lvb_node);
+
+lval* lvb_to_lval(lvb_node);
+
+#endif
@@ -0,0 +1,432 @@
+// accept4 is a GNU extension
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "server.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "batch.h"
+#include "cache.h"
+#include "reader.h"
+
+// Everything runs on one thread. Sockets never block: a client is read
+// from when epoll says it has bytes, every complete request is evaluated
+// straight away and the responses queue up in the client's out buffer
+// until the socket takes them. A client whose responses pile up is not
+// read from again until they have gone out, so a client that sends but
+// never reads only ever holds up itself.
+
+typedef struct lispy_client
+{
+    int fd;
+    int eof;
+    unsigned events; // what epoll is watching for
+
+    char* in;
+    size_t in_len;
+    size_t in_slots;
+
+    lval_reader reader;
+    lval_buf out;
+    size_t sent;
+
+    struct lispy_client* prev;
+    struct lispy_client* next;
+} lispy_client;
+
+typedef struct lispy_server
+{
+    int epfd;
+    int listener;
+
+    mpc_parser_t* Lispy;
+    lval_cache* cache;
+    lval_print_limits limits;
+    lval_format format;
+
+    lispy_client* clients;
+} lispy_server;
+
+static volatile sig_atomic_t lispy_serve_stop = 0;
+
+static void lispy_serve_signal(int sig)
+{
+    (void)sig;
+    lispy_serve_stop = 1;
+}
+
+static void lispy_client_close(lispy_server* s, lispy_client* c)
+{
+    epoll_ctl(s->epfd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+
+    if (c->prev) { c->prev->next = c->next; }
+    else { s->clients = c->next; }
+    if (c->next) { c->next->prev = c->prev; }
+
+    lval_reader_free(&c->reader);
+    lval_buf_free(&c->out);
+    free(c->in);
+    free(c);
+}
+
+static void lispy_client_new(lispy_server* s, int fd)
+{
+    lispy_client* c = malloc(sizeof(lispy_client));
+    c->fd = fd;
+    c->eof = 0;
+    c->events = EPOLLIN;
+
+    c->in_slots = 4096;
+    c->in = malloc(c->in_slots);
+    c->in_len = 0;
+
+    lval_reader_init(&c->reader, "<client>");
+    lval_buf_init(&c->out, NULL, NULL);
+    c->out.limits = s->limits;
+    c->out.format = s->format;
+    c->sent = 0;
+
+    struct epoll_event ev;
+    ev.events = c->events;
+    ev.data.ptr = c;
+    if (epoll_ctl(s->epfd, EPOLL_CTL_ADD, fd, &ev) != 0)
+    {
+        perror("epoll_ctl");
+        close(fd);
+        lval_reader_free(&c->reader);
+        lval_buf_free(&c->out);
+        free(c->in);
+        free(c);
+        return;
+    }
+
+    c->prev = NULL;
+    c->next = s->clients;
+    if (s->clients) { s->clients->prev = c; }
+    s->clients = c;
+}
+
+static void lispy_server_accept(lispy_server* s)
+{
+    while (1)
+    {
+        int fd = accept4(s->listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd >= 0)
+        {
+            lispy_client_new(s, fd);
+            continue;
+        }
+
+        if (errno == EINTR || errno == ECONNABORTED) { continue; }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) { perror("accept"); }
+        return;
+    }
+}
+
+static unsigned long lispy_frame_len(const char* p)
+{
+    const unsigned char* u = (const unsigned char*)p;
+    return ((unsigned long)u[0] << 24) | ((unsigned long)u[1] << 16) | ((unsigned long)u[2] << 8) | u[3];
+}
+
+// Evaluates the complete requests at the start of the in buffer for as long
+// as there is room for their responses. Returns 0 if the client broke the
+// protocol or there is no memory for what it sent.
+static int lispy_client_eval(lispy_server* s, lispy_client* c)
+{
+    size_t pos = 0;
+
+    while (c->in_len - pos >= 4 && c->out.len - c->sent < LISPY_SERVE_OUT_MAX)
+    {
+        unsigned long n = lispy_frame_len(c->in + pos);
+        if (n > LISPY_SERVE_FRAME_MAX) { return 0; }
+        if (c->in_len - pos - 4 < n) { break; }
+
+        char* text = c->in + pos + 4;
+
+        // the response length is filled in once it is known
+        size_t start = c->out.len;
+        lval_buf_put(&c->out, "\0\0\0\0", 4);
+
+        // the runner cuts lines in place and needs the byte after the
+        // request, which may already belong to the next one
+        char after = text[n];
+        lispy_batch_run(s->Lispy, &c->reader, s->cache, text, n, &c->out);
+        text[n] = after;
+
+        size_t len = c->out.len - start - 4;
+        unsigned char* h = (unsigned char*)c->out.data + start;
+        h[0] = (unsigned char)(len >> 24);
+        h[1] = (unsigned char)(len >> 16);
+        h[2] = (unsigned char)(len >> 8);
+        h[3] = (unsigned char)len;
+
+        pos += 4 + n;
+    }
+
+    memmove(c->in, c->in + pos, c->in_len - pos);
+    c->in_len -= pos;
+
+    // a request that has only partly arrived gets room for all of it, plus
+    // the byte the runner writes after it. Its header may not have been
+    // looked at yet, the loop above stops early when the output backs up.
+    if (c->in_len >= 4)
+    {
+        unsigned long n = lispy_frame_len(c->in);
+        if (n > LISPY_SERVE_FRAME_MAX) { return 0; }
+
+        size_t slots = c->in_slots;
+        while (slots < 4 + n + 1) { slots *= 2; }
+        if (slots != c->in_slots)
+        {
+            char* in = realloc(c->in, slots);
+            if (in == NULL) { return 0; }
+            c->in = in;
+            c->in_slots = slots;
+        }
+    }
+
+    return 1;
+}
+
+// Passes as much of the pending output to the socket as it takes. Returns 0
+// if the client has gone.
+static int lispy_client_write(lispy_client* c)
+{
+    while (c->sent < c->out.len)
+    {
+        ssize_t n = send(c->fd, c->out.data + c->sent, c->out.len - c->sent, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (errno == EINTR) { continue; }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+
+        c->sent += n;
+    }
+
+    c->out.len = 0;
+    c->sent = 0;
+    return 1;
+}
+
+// Reads once, so one busy client cannot starve the others, then evaluates
+// and writes what it can.
+static int lispy_client_read(lispy_client* c)
+{
+    // the last byte stays free for the runner to write to
+    if (c->in_len + 1 >= c->in_slots)
+    {
+        char* in = realloc(c->in, c->in_slots * 2);
+        if (in == NULL) { return 0; }
+        c->in = in;
+        c->in_slots *= 2;
+    }
+
+    ssize_t n = recv(c->fd, c->in + c->in_len, c->in_slots - c->in_len - 1, 0);
+    if (n > 0) { c->in_len += n; }
+    else if (n == 0) { c->eof = 1; }
+    else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) { return 0; }
+
+    return 1;
+}
+
+// Works through whatever a client is ready for and tells epoll what to
+// watch for next, or closes the client once it is done.
+static void lispy_client_ready(lispy_server* s, lispy_client* c, unsigned events)
+{
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+    {
+        if (!lispy_client_read(c))
+        {
+            lispy_client_close(s, c);
+            return;
+        }
+    }
+
+    // evaluating stops while the output is backed up, so keep going for as
+    // long as writing makes room
+    size_t pending;
+    do
+    {
+        if (!lispy_client_eval(s, c) || !lispy_client_write(c))
+        {
+            lispy_client_close(s, c);
+            return;
+        }
+
+        pending = c->out.len - c->sent;
+    } while (pending == 0 && c->in_len >= 4 && c->in_len >= 4 + lispy_frame_len(c->in));
+
+    // a request cut short by the end of the connection is dropped
+    if (c->eof && pending == 0)
+    {
+        lispy_client_close(s, c);
+        return;
+    }
+
+    unsigned want = 0;
+    if (!c->eof && pending < LISPY_SERVE_OUT_MAX) { want |= EPOLLIN; }
+    if (pending > 0) { want |= EPOLLOUT; }
+
+    if (want != c->events)
+    {
+        struct epoll_event ev;
+        ev.events = want;
+        ev.data.ptr = c;
+        epoll_ctl(s->epfd, EPOLL_CTL_MOD, c->fd, &ev);
+        c->events = want;
+    }
+}
+
+// Binds to path, taking it over if it is a socket that was left behind by
+// a server that is no longer running.
+static int lispy_server_listen(const char* path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "%s: socket path too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("socket");
+        return -1;
+    }
+
+    int bound = bind(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+    if (!bound && errno == EADDRINUSE)
+    {
+        // nobody answering means nobody is listening
+        int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        int stale = probe >= 0 && connect(probe, (struct sockaddr*)&addr, sizeof(addr)) != 0 && errno == ECONNREFUSED;
+        if (probe >= 0) { close(probe); }
+
+        if (!stale)
+        {
+            fprintf(stderr, "%s: already in use\n", path);
+            close(fd);
+            return -1;
+        }
+
+        unlink(path);
+        bound = bind(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+    }
+
+    if (!bound)
+    {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+
+    if (listen(fd, SOMAXCONN) != 0)
+    {
+        perror(path);
+        close(fd);
+        unlink(path);
+        return -1;
+    }
+
+    return fd;
+}
+
+int lispy_serve(const char* path, mpc_parser_t* Lispy, const lval_print_limits* limits, lval_format format)
+{
+    lispy_server s;
+    s.Lispy = Lispy;
+    s.limits = *limits;
+    s.format = format;
+    s.clients = NULL;
+
+    s.listener = lispy_server_listen(path);
+    if (s.listener < 0) { return 1; }
+
+    s.epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (s.epfd < 0)
+    {
+        perror("epoll_create1");
+        close(s.listener);
+        unlink(path);
+        return 1;
+    }
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    epoll_ctl(s.epfd, EPOLL_CTL_ADD, s.listener, &ev);
+
+    // no SA_RESTART, so epoll_wait comes back when it is time to stop
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = lispy_serve_signal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    s.cache = lval_cache_new(LVAL_CACHE_SLOTS);
+    fprintf(stderr, "listening on %s\n", path);
+
+    struct epoll_event events[LISPY_SERVE_EVENTS];
+    int status = 0;
+
+    while (!lispy_serve_stop)
+    {
+        int n = epoll_wait(s.epfd, events, LISPY_SERVE_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR) { continue; }
+            perror("epoll_wait");
+            status = 1;
+            break;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            if (events[i].data.ptr == NULL) { lispy_server_accept(&s); }
+            else { lispy_client_ready(&s, events[i].data.ptr, events[i].events); }
+        }
+    }
+
+    while (s.clients) { lispy_client_close(&s, s.clients); }
+
+    lval_cache_del(s.cache);
+    close(s.epfd);
+    close(s.listener);
+    unlink(path);
+
+    return status;
+}
+
+#else
+
+int lispy_serve(const char* path, mpc_parser_t* Lispy, const lval_print_limits* limits, lval_format format)
+{
+    (void)Lispy;
+    (void)limits;
+    (void)format;
+
+    fprintf(stderr, "%s: server mode needs epoll, which this system does not have\n", path);
+    return 1;
+}
+
+#endif
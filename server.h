@@ -0,0 +1,32 @@
+#ifndef server_h
+#define server_h
+
+#include "parsing.h"
+#include "print.h"
+
+// Server mode: evaluates requests from any number of local clients on a
+// Unix domain socket, all from one thread and one prebuilt parser.
+//
+// Requests and responses are frames, a 4 byte length in network byte order
+// followed by that many bytes. A request holds Lispy source, one or more
+// lines of it, and is answered by exactly one response holding what the
+// REPL would have printed for it: one result per line, or the errors.
+// Responses come back in the order the requests were sent. Every request
+// stands on its own, a form left open at the end of one is an error.
+
+// longest request a client may send, anything longer closes the connection
+#define LISPY_SERVE_FRAME_MAX (1024 * 1024)
+
+// how many events one call to epoll_wait returns at most
+#define LISPY_SERVE_EVENTS 64
+
+// a client with this much output the socket has not taken yet is not read
+// from until it drains
+#define LISPY_SERVE_OUT_MAX (256 * 1024)
+
+// Listens on path until interrupted, evaluating every request with Lispy
+// and printing the results within limits, in the given format. Returns the
+// exit status for main.
+int lispy_serve(const char*, mpc_parser_t*, const lval_print_limits*, lval_format);
+
+#endif
@@ -0,0 +1,220 @@
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include "stats.h"
+
+// Every context that has published gets a slot, the slots of contexts
+// that are still around are kept on a list and those of contexts that are
+// gone are folded into the retired totals.
+typedef struct lispy_stats_slot
+{
+    lispy_stats stats;
+    struct lispy_stats_slot* next;
+} lispy_stats_slot;
+
+static lispy_stats_slot* lispy_stats_slots = NULL;
+static lispy_stats lispy_stats_retired;
+static const char* lispy_stats_path = NULL;
+
+#ifndef _WIN32
+static pthread_mutex_t lispy_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#define LISPY_STATS_LOCK() pthread_mutex_lock(&lispy_stats_lock)
+#define LISPY_STATS_UNLOCK() pthread_mutex_unlock(&lispy_stats_lock)
+#else
+// no threads to guard against
+#define LISPY_STATS_LOCK()
+#define LISPY_STATS_UNLOCK()
+#endif
+
+static void lispy_stats_add(lispy_stats* to, const lispy_stats* from)
+{
+    to->lval_new += from->lval_new;
+    to->lval_reused += from->lval_reused;
+    to->lval_freed += from->lval_freed;
+    to->forms += from->forms;
+
+    for (int i = 0; i < LVAL_TYPES; i++)
+    {
+        to->allocs[i] += from->allocs[i];
+        to->frees[i] += from->frees[i];
+    }
+
+    to->pop_bytes += from->pop_bytes;
+    to->add_reallocs += from->add_reallocs;
+    to->mpc.parses += from->mpc.parses;
+    to->mpc.backtracks += from->mpc.backtracks;
+    to->mpc.reparses += from->mpc.reparses;
+
+    for (int i = 0; i < LERR_CODES; i++) { to->errors[i] += from->errors[i]; }
+}
+
+void lispy_stats_publish(lispy_ctx* ctx)
+{
+    LISPY_STATS_LOCK();
+
+    if (ctx->slot == NULL)
+    {
+        ctx->slot = malloc(sizeof(lispy_stats_slot));
+        ctx->slot->next = lispy_stats_slots;
+        lispy_stats_slots = ctx->slot;
+    }
+    ctx->slot->stats = ctx->stats;
+
+    LISPY_STATS_UNLOCK();
+}
+
+void lispy_stats_retire(lispy_ctx* ctx)
+{
+    LISPY_STATS_LOCK();
+
+    lispy_stats_add(&lispy_stats_retired, &ctx->stats);
+    memset(&ctx->stats, 0, sizeof(lispy_stats));
+
+    if (ctx->slot != NULL)
+    {
+        lispy_stats_slot** p = &lispy_stats_slots;
+        while (*p != ctx->slot) { p = &(*p)->next; }
+        *p = ctx->slot->next;
+
+        free(ctx->slot);
+        ctx->slot = NULL;
+    }
+
+    LISPY_STATS_UNLOCK();
+}
+
+void lispy_stats_total(lispy_stats* total)
+{
+    LISPY_STATS_LOCK();
+
+    *total = lispy_stats_retired;
+    for (lispy_stats_slot* s = lispy_stats_slots; s != NULL; s = s->next)
+    {
+        lispy_stats_add(total, &s->stats);
+    }
+
+    LISPY_STATS_UNLOCK();
+}
+
+static void lispy_stats_header(FILE* f, const char* name, const char* help)
+{
+    fprintf(f, "# HELP %s %s\n# TYPE %s counter\n", name, help, name);
+}
+
+void lispy_stats_write(FILE* f)
+{
+    static const char* types[LVAL_TYPES] = { "int", "float", "err", "sym", "sexpr" };
+
+    lispy_stats s;
+    lispy_stats_total(&s);
+
+    lispy_stats_header(f, "lispy_lval_allocs_total", "Lvals built, by type.");
+    for (int i = 0; i < LVAL_TYPES; i++) { fprintf(f, "lispy_lval_allocs_total{type=\"%s\"} %lu\n", types[i], s.allocs[i]); }
+
+    lispy_stats_header(f, "lispy_lval_frees_total", "Lvals deleted, by type.");
+    for (int i = 0; i < LVAL_TYPES; i++) { fprintf(f, "lispy_lval_frees_total{type=\"%s\"} %lu\n", types[i], s.frees[i]); }
+
+    lispy_stats_header(f, "lispy_lval_pool_total", "Where lval memory came from and went to.");
+    fprintf(f, "lispy_lval_pool_total{op=\"malloc\"} %lu\n", s.lval_new);
+    fprintf(f, "lispy_lval_pool_total{op=\"reuse\"} %lu\n", s.lval_reused);
+    fprintf(f, "lispy_lval_pool_total{op=\"free\"} %lu\n", s.lval_freed);
+
+    lispy_stats_header(f, "lispy_pop_memmove_bytes_total", "Bytes moved by lval_pop.");
+    fprintf(f, "lispy_pop_memmove_bytes_total %lu\n", s.pop_bytes);
+
+    lispy_stats_header(f, "lispy_add_reallocs_total", "Cell arrays grown by lval_add.");
+    fprintf(f, "lispy_add_reallocs_total %lu\n", s.add_reallocs);
+
+    lispy_stats_header(f, "lispy_forms_read_total", "Forms read and handed to the evaluator.");
+    fprintf(f, "lispy_forms_read_total %lu\n", s.forms);
+
+    lispy_stats_header(f, "lispy_mpc_parses_total", "Calls to mpc_parse.");
+    fprintf(f, "lispy_mpc_parses_total %lu\n", s.mpc.parses);
+
+    lispy_stats_header(f, "lispy_mpc_backtracks_total", "Times mpc rewound its input.");
+    fprintf(f, "lispy_mpc_backtracks_total %lu\n", s.mpc.backtracks);
+
+    lispy_stats_header(f, "lispy_mpc_reparses_total", "Failed parses done again for their error.");
+    fprintf(f, "lispy_mpc_reparses_total %lu\n", s.mpc.reparses);
+
+    lispy_stats_header(f, "lispy_errors_total", "Parse errors and evaluations that ended in an error, by kind.");
+    for (int i = 1; i < LERR_CODES; i++)
+    {
+        fprintf(f, "lispy_errors_total{kind=\"%s\"} %lu\n", lval_error_name(i), s.errors[i]);
+    }
+}
+
+int lispy_stats_dump(const char* path)
+{
+    size_t len = strlen(path) + 8;
+    char* tmp = malloc(len);
+    snprintf(tmp, len, "%s.tmp", path);
+
+    FILE* f = fopen(tmp, "w");
+    if (f == NULL)
+    {
+        perror(tmp);
+        free(tmp);
+        return 0;
+    }
+
+    lispy_stats_write(f);
+    int ok = !ferror(f);
+    if (fclose(f) != 0) { ok = 0; }
+    if (ok && rename(tmp, path) != 0) { ok = 0; }
+
+    if (!ok)
+    {
+        perror(path);
+        remove(tmp);
+    }
+
+    free(tmp);
+    return ok;
+}
+
+// the thread that exits is the one whose context has not been published
+static void lispy_stats_exit(void)
+{
+    lispy_stats_publish(lispy_ctx_get());
+    lispy_stats_dump(lispy_stats_path);
+}
+
+#ifndef _WIN32
+
+// Waits for SIGUSR1 on a thread of its own, which makes writing the file
+// ordinary code rather than something a signal handler would have to do
+static void* lispy_stats_watcher(void* arg)
+{
+    sigset_t* set = arg;
+    int sig;
+
+    while (sigwait(set, &sig) == 0) { lispy_stats_dump(lispy_stats_path); }
+
+    return NULL;
+}
+
+#endif
+
+void lispy_stats_watch(const char* path)
+{
+    lispy_stats_path = path;
+    atexit(lispy_stats_exit);
+
+#ifndef _WIN32
+    // every thread started from here on inherits the mask, so the signal
+    // only ever goes to the watcher
+    static sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, lispy_stats_watcher, &set) == 0) { pthread_detach(thread); }
+#endif
+}
@@ -0,0 +1,30 @@
+#ifndef stats_h
+#define stats_h
+
+#include <stdio.h>
+#include "ctx.h"
+
+// Runtime statistics for the whole process, summed over every context.
+//
+// Counting stays on the thread that owns a context and needs no locking.
+// A thread publishes a copy of its counters every so often, at the end of
+// a line, a chunk or a block, and the totals are taken from those copies
+// and from the contexts that are gone. Totals are therefore at most one
+// unit of work behind what the threads have done.
+
+void lispy_stats_publish(lispy_ctx*);
+void lispy_stats_retire(lispy_ctx*);
+void lispy_stats_total(lispy_stats*);
+
+// Writes the totals in the Prometheus text format
+void lispy_stats_write(FILE*);
+
+// Writes the totals to path, replacing it in one go so a scraper never
+// reads half a file. Returns 0 if that failed.
+int lispy_stats_dump(const char*);
+
+// Dumps to path whenever the process gets SIGUSR1, and once more on exit.
+// Has to be called before any other thread is started.
+void lispy_stats_watch(const char*);
+
+#endif
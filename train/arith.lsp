@@ -0,0 +1,600 @@
++ (- 78 (+ 376 -46))
+% (% -87 (- 469 589 678 604) (+ 155 675 500 640)) (+ (* 106 828) (* 329 46))
+% (- (* 349 14 -35 721) 544) 839
+- 438 (/ 183 (+ 213 764) (/ 858 -77 134) (% 596 790 -94)) (* (% 511 939) (- 986 563 129) (* 61 895) (% 873 238))
+* (% (* 664 959 407) 371 (+ 20 -36) (+ 894 170 868 868)) (- 767 10) (+ 123 818) 847
+- 100
++ (- 721 (- 699 831 896))
+- 24 (+ (% 940 280 39 381) 404)
+% (/ (% 318 543 710) 836 48 104)
++ (- (- 797 519 983) 513 (+ 119 218)) 602
+- (* 466 167) (* (% -81 205 656 203) 646) (+ 110 732 (- 262 -50))
+- (/ (- 121 -21 355) 616 366 716) 471 998
+* 265
+% 607 (* (% 289 793) 303 576) (+ (% 568 505 292) 256 (* -100 330 559) (/ 869 247 481 586))
++ (- 873 (+ 298 686 399)) 118
+/ 960 (% (+ 851 549 806) (% 813 872 406))
+* (* 456 65 212) (+ 751 697 (% 679 620 698 758)) (% (/ 894 588) (/ 857 993 706 -45) 845 570) 676
+* -61 (+ -18 (- 212 869) (% 424 243)) (+ (+ 538 668 306 397) 147) (% 658 -75)
+/ 841 (/ (* 890 449 402 77) 851) (/ 272 (* 465 958 75) 392) (/ (+ 398 655 987) 577 527)
+* 144 (- 974 (+ 639 -72))
+% 498 (- (/ 482 802) 417 (/ 720 9) 522)
++ 362 (/ (* 525 23 103 325) (* 391 53 736 862) 479)
+/ (* (- 360 444 46) 491 522 (* 796 -19 560 -48))
++ (% (* 258 805 271 792) (/ 736 114) (* 490 720 -25) (* 727 -98 846)) 640
+% (+ 489 148) 390 (* 360 (+ 215 497 459) 867 685) 179
++ (/ (% 479 902 814) (* 672 559 389) (- 868 680 211)) (+ (% 801 835 195) 216) 442
+* (* (/ 899 -27 380) (* 788 105) -41 500) 400 (% (- 683 393) (% 420 -81) (/ 223 607 512) (/ 518 687 118 635)) (* (/ 0 917 486) (- 348 413 180 -20))
+* 169 750 649 (* 886 (* 135 54 362 713))
+% 441 (/ (* 660 378 571 353) (/ 736 -8 523 137) 177) 758
+% (+ (* 344 383) (+ 634 465 150 831) -57) 157
+% 324 (- (% 196 413) (+ 169 387 -68 7) 132)
++ 123 (- 967 -37 722 808) 203 565
+/ (% 340 747 751) (* 212 (/ 74 97) (* 575 741)) 766
++ (* (- 359 617) (* 363 -47)) (* 532 (* 193 720)) -38
++ 222 73
++ 67 894
+% 949 480 (% (* 12 517) (- 145 781 678) (- 625 -14 841 541)) (% (/ -58 251 842) (* 116 720) (/ 353 244 133))
+% (* (- 424 213) (+ 911 819) (% 561 547 39 520)) (% 845 (+ 57 84 938))
+/ (+ (% 874 26 603 72) (- 796 973) (- 479 592 7)) (* 691 207) 189 (* (/ 73 671) (* 978 767) (+ 338 895 181) 107)
+% (% (- 239 -11) 386)
+/ (/ (* 297 802 477) (% 231 183 6 660)) (+ (+ 228 951 795) 823 (+ 928 690 667) 102) (* 867 (- -90 -62 206 980))
+/ (- 836 923 (+ 395 496 622 753))
+- (* (% 939 699 -11 664) 38)
+* (+ (* 593 258) (/ 273 29 837 312) -15 715) (% 291 -3 (* 653 719 691))
+* (/ (% 769 269 557) 505 772) 815
++ (/ (+ 731 227) (- 797 37 650 -34) (/ 57 984 543)) (- 960 436) (/ (* 905 177 825 811) (* 32 494 222 256))
+* 184 639
+% (% (+ 880 738) (+ 51 959)) 272 (- (+ 522 560) (- 962 61 462) 992)
++ (% 591 (% -42 442)) (% (+ 493 518 731) 22 851)
+- (* 607 (- 117 855 820) 494 (% 227 540 226)) (% (* 705 393 622) 863 120) 649
+/ 298 691 (% (% 163 706 594 648) (- 924 -21 582 963) (% 552 512 938 990))
+/ (+ 753 (+ 366 883 678 396) 125) 757 740
+% (+ 565 (/ 254 991 625 441) (- 511 509) (- 549 460 677 708)) (- 61 425 (- 455 456)) 390 987
+- 867 -90
+% 874 (- 83 (- -24 258 260 -26) (/ 492 -82 119))
+* (% (- 294 577 839 281) 504 (- 730 955) 95) 562 (+ 446 (* -77 636 27 853) 929)
+* (* (- 831 665) 864 (- 67 981))
+* (+ (% 206 965) 901)
++ (/ (/ 846 531 710 -94) (% 605 23)) (+ 177 (/ 683 673 172) (* 1000 160)) (- (* 768 370 608) 131) -68
+- 814 (+ (/ 344 15 492) 553)
+% 967 24 (% (/ 605 680 552 736) 869 195 (+ 753 174 422 61))
+/ 290 -20 (- (% 581 -69) 140 (/ 318 390) (* 635 636 918))
+/ (/ (* 353 -67 755) 371 922)
+% 904 (* 276 (% 973 52 -1 744)) 39
+- 23
+% (+ (/ 462 487) 781) (- (% 978 625) 664) (/ 514 (+ -36 676 874 -81) (+ 578 95 -13) 873) 474
+% -68
+- (/ 696 (% 186 60 608)) 55
+* (* (/ 668 678 504) (+ 678 215)) (* 531 109 819) (% 90 (* 747 73 397) (- 184 449 29 465)) 57
+* (/ (/ -87 580) (/ 781 178 311) (- 496 905 396) 704) 309 (% (% 845 329) 41)
+/ 417 (/ 881 (% 756 636 999 74) 627) 718 (* 354 (% 352 701 924 -50) (* 75 190 602))
+/ (* 826 135 123) (- 227 846 277 710)
++ -91 (- (+ 999 567 133 902) (* 703 612 837 509) (% 541 525))
++ 695 685
+/ (% (- 491 544 9 -81) (- 935 737 751) (/ -37 351 462) 836) (/ (% 651 -15) (/ 770 406 -34 613) (+ 140 385 618) (% 185 323 618 244))
+* 953 (+ (/ 159 171) 406) (/ 748 90 655)
+/ 90 (/ (* 714 779) (/ 480 167 893) (+ 841 223) 776) 170 (* (* 412 238) 379)
+/ (+ (- 811 603 764 878) 109)
++ 683 (- (- -83 236) 210 (% 344 105 152 686) 186) 408
+% (+ (- 286 505 390 130) 45 (+ 170 761 253) (+ -72 -19)) (/ 750 998 (- 61 316 218) (/ 35 795 388 76)) (+ (+ 259 181 235) (* 430 159 450 141) (+ 457 438 57))
+/ (+ (- 110 136 942) -75 684) (- (/ 752 555) 663) 7 -6
+/ (* -84 522 (- 910 300 402))
+- (+ (+ 670 529 985) (/ 191 90 374))
+% (* (+ 173 707 27 167) 545 (/ 568 456 315 123)) 854 633 (- 145 523 (% 571 408))
+* (* (- 826 411) 186 355) 662 (+ (+ 304 808) (+ 844 787 708) (/ 624 283 813 -30) (% 921 881)) 181
+/ (% (% 635 892) 558) 553
+% 475 984
+* (+ (* 14 349 695 255) 634) (+ (% 285 908 259 84) -60 (+ 312 597 562) 190)
++ (* (/ 518 222 794 897) (- 630 259 503 -97) (% -34 551 352) (+ 59 554 81)) (* 38 -98 759) (/ (* 881 361 50 -32) 114 668)
+- (+ (% 783 237 789) 320 (/ 443 509 1 905))
+- 503
+% 249 (+ (* 442 693 681) 439 450) (- (+ 747 365 692 757) (/ 875 708 -29 958) (% 819 242) (- 60 791)) 202
+% 37 567 (% (+ 970 130 203 105) (% 996 741) 868)
++ 722 578
+- (* 520 101 (- 807 557))
+* (+ 733 (% 955 34 937)) 973 (+ 18 638) (* (% 153 395 813) 616 429)
++ 338 (- 951 -82 (- -83 525 463 671) (/ 518 713 -85)) (* (% 121 588 565) (* 511 959 16 727) (- 918 431 728 -28) (% 355 874))
+* (% 429 (% 587 355)) 528 661
+* (+ 45 (- 681 746 208 310) 837) 269 (/ (- -91 328 245) (- 80 788 726) -91)
++ (+ (% -92 409) 539 526) 510
+* (% 174 635 (- 359 168 -56) (- -24 423)) (% (+ -60 137 678 417) (- -81 106)) (* (- 114 141 117) (% 971 633) (* 916 884) 82) (% (+ 107 373 506 2) -20 (* 137 -7 183 249) 449)
++ (- 456 (/ 241 20 226)) 888 (/ (* 167 899 742 29) 974)
+% (* (% 409 688) 11 935 (/ 906 577)) (+ 725 (+ 817 920 143) (+ -27 -100) (% 941 834 644 356))
+/ (% (* 99 354 627 497) (* 236 738 301 704) 290 (+ 152 822 932)) 986 (% (/ 262 255 162 559) (/ 408 602 827) (- 949 542 345))
+- (* 264 (* 621 754 993 765) (% 197 15) 229) (* (* -34 826) 359)
+% 489 (+ 540 (+ 315 807) (* 302 296 263 52)) 952 471
+% 422 217 4
+% (% 550 (- 934 999 615 336) (* 986 -82 608) 399) (* (+ 479 958 667) (% 507 294 68) (- 34 336 768 321)) (/ (+ -52 579 50 415) (% 734 728) 142 (% -7 48))
+* 77
+* -37 (% 504 (- 664 -78 189)) 707 (+ 604 949 417)
+- 11
+% (+ (* 897 631) 104 296) 526 (- (* 541 353 793) 579 (/ 525 122 67) (- 56 -62 -37 729)) (- (% 204 357 495 926) (/ 389 239 187))
+/ 199 (/ 374 -13 (% 831 -19 563))
++ (* (- 648 59 670) (- 606 887 -87 184) 953 (- 641 142)) (/ (/ 331 741 -12 229) 200 268) (/ (+ 480 343 865 249) 192 (- 441 601 40 689) 970)
+% (% -21 (% 90 166 -98 783)) (* (/ 887 680) 100) 376 (+ (% -89 -86 141) (/ 546 118 419 997) 464)
+/ 888 890
+* (/ 143 (/ 105 720 6 -90) (- 791 438 63) (/ 967 17 258)) (/ 961 945) (- 389 (- 718 709) -69 (+ 612 466))
+- (/ 936 502 951 (% 806 890 595 839)) (% (* 351 370) (/ -81 439 90))
+/ 875 451 289
+/ 443 411
+% 60 (/ -14 (* 462 946 354 162) 879 (+ 257 146 842 -83)) 106
+* (* (- 602 921 758) (* 472 168 368)) (* (/ 206 -81) 958) (* -3 22 97)
+/ 427 619 (% (% 482 945) (/ 486 196))
+- 728 (+ 548 (* 455 643 966 747)) 156
+- (+ 30 (/ 713 70 218 698)) 481 978
+- 566
+/ (% (- 835 790 993 611) (- 649 218) 179) -83 (/ 499 (+ 743 795 234 698) (- 390 456 989)) (/ (- 832 457) (/ 211 995))
++ (* -84 910 920) (/ (* 199 703) 293 (* 149 409 807) 307)
+/ (- 561 966 511)
+- (- -70 145) -14 (/ (* 923 593) (+ 215 119) 611 (/ 673 175 -20 796))
+% (/ (% 859 228 217) 651) (% (+ 389 29 693 918) (- 739 126 36 165) 119) (+ (/ 424 352 45 327) (+ 24 751 19))
+% (+ 963 988 409) (- (/ 633 774 241 722) (- 807 545 564 744) (/ 392 338 420 826) -30) (% (* 354 544) 465)
+% 219 411
+- (+ 58 (/ 95 515) 681 584) 753 (+ (% 683 973) 206)
+* 704 (% (- 707 588 0) (* 789 167) (/ 709 301 973 46) 83)
++ 556 524 805 (/ (- 219 75) 202)
+* 524
+/ 333 429 (% (+ 978 248 311) (% -83 455 637) (+ 691 679 103) (/ 281 837 -56 984)) 221
++ (* 926 427 (+ 361 704 79 966) (% 754 212 539 574)) 183 (- 972 (/ 223 991))
++ -40 (/ 460 169 446)
+% (- 876 860 (* 906 235) -70) (/ (- 799 903) (/ -15 679))
+* (% (+ 835 -14 403 710) (+ 0 800 523 485) (/ 11 191 825) 268) (% -49 313) (+ 235 (+ 820 74) (/ 947 227 679 249)) (% (- 5 533) (/ 140 315 418) 921 (+ 387 874 804 -87))
+- (% 614 511) 123 482
+% (% (+ 676 775 32) 462 329) (% 983 (/ 488 548 624 916))
+% (- 296 141 (- 747 616 334 312) (* 937 -88)) 711 (% (- 881 -28 886) 999) (/ (+ 546 -62 579 624) -37 994)
+- 531 (* 917 (* 519 519 666) (- -49 924) 890) (% (- 957 171) 693 (% -10 78)) 111
+% 329 466 (/ 460 952 552 480)
+% 593 (+ 3 773)
+/ (% (/ 580 992 853 90) (/ 853 358) 428 (/ 576 565)) (+ (* 249 613 160) (/ 567 45 991 746))
+- (/ 782 (/ 383 59 896 848) 811) 42
+% (% 25 -100 (- 698 815 548))
+* (/ (* 945 161) (+ 8 635 477) (- 707 683 791) (- 687 637 215)) 157 -68
+- (- 833 (% 830 821 362)) 920 (- (/ -32 889 131 63) 472 (+ 81 59 539 603) (+ 860 578 503)) 522
+% 246 (* (* 935 469 475) 128 (% 814 259 383 980) (* 215 745)) (- 331 (* 137 850) 990 698)
+/ -76 682 (% (+ 784 458 446 422) (/ 395 299 268) -83 (+ 112 619 480))
+* 16 (- (+ 166 278) (- 55 466 562) 467 (/ 23 442 42))
+/ (- (- 347 117 430 49) 813 -99 (/ 575 -93 904)) (/ (+ 687 887 996 635) 13 (+ 596 841 493) (- 686 512 118 635))
+/ (/ -49 (% 29 530) (/ 14 -13) 971)
+/ (- -61 (% 167 2)) (+ (% 117 351) 590 (/ 181 336 255))
+* 750
+- (/ (+ 670 -68) (+ 82 481)) 874 (- (% 257 -23 923) (+ 516 -91 293 985))
++ (% 326 205 (/ -12 645 790) 828) 1000 893
+% 810
+% 567 366 309
+/ 11 (- (/ 179 297) (* -35 22))
+* 756 504
+% (% (% 968 343) (/ 776 405 789)) (% (+ -18 932 987) 100)
+/ -75 (/ 85 231) (% (/ 730 658 -98) (+ 581 507 452) (% 324 65 587 12) (* 648 -17)) 37
+% 132 (% 361 931 (* 607 926) (+ 991 825 34))
+- 266 123 203 (- (+ 170 760 -57) 375 (% 602 568 985 811) (% 527 432))
+- -4 240 (- (- 214 139) 159 320 (+ 604 818 232 148)) (/ (/ 939 505 493) (% 805 130 -18 139) 351)
+/ 299 (- 812 (+ 904 947 639 775) 482) 812
+% 751
+/ 768 (/ (% 521 975) (+ 81 459 846 180)) 492
+% 522 (/ 437 867) 489 401
++ (/ (* 793 874 144 -65) (- 554 177 8 759))
+* 57
+% (- (- 547 516 642 620) (+ 663 743)) 109
+- (- (% 133 56 168 882) 184 (% 600 523 142 191) (* 60 128)) 783
++ 951 (/ (+ -79 153) (- 278 -41 468 612))
+* (% (+ -72 292) (- 102 932 872 279)) 270
+* 734 153 (% (* -17 911 480 538) (/ 495 776)) 874
+* 115 74
++ 108 (- 310 (/ 769 470))
+% (/ (% 947 831 413) (- -40 8 920 266) 212) 56 (% (- 904 603 -64) (+ 143 544 806) (+ 520 236))
+/ 898 (% (% 862 220 701 673) (* -43 162 614) (% 598 776) 619) 380 (% (+ 247 567 765) (/ 861 548 699))
+* (+ (* 595 513 792) 54 (% -3 723) (% 94 459 987 329))
+* (* (/ 309 414 828 269) (% 336 857) 788 (+ 847 208 514 740))
+* (/ (- 383 132 -44) 850 (/ -25 458 429))
+* (+ (+ 71 510) (/ 84 187 924) (% 975 84 150 541) 698) (- 338 (/ 14 667 131) 404)
+* 531 -29
++ 643 (+ (/ 704 423 382) 228 (* -31 64 906 745) (* 105 434 620 569))
+/ (- -94 542 (+ 166 740) (* 173 570 306))
++ 672 (% 368 (/ 245 778)) (- (- 976 829 912 316) 445) 166
+/ (* (/ 198 436) 408 838 562) (/ 766 (* 20 380) (* -7 933 519 659) -16)
+% 594 (- 190 161)
+/ (/ (* 440 792 546 906) (- 801 204 275 432) 137) (/ 893 (+ 153 317 269 941)) (% (% 269 57) 93 (+ 149 117 214) 882)
+/ (+ (% 164 -1 479) 44 (% 422 716 326)) 483 (- 535 (% 96 949))
+- 449 (/ (* 772 951 849 217) (% 71 795 878 161)) (* (* 56 951 770 851) (% 67 -67 847)) 704
++ 542
+% (/ (* 60 431) (+ -89 -73 877) (/ 896 638 708 79) 129) (- 395 290) 203 (+ 811 (/ 396 702))
++ 784 (/ (% 718 899 24) (/ 30 754 139 610) 230 604) 594
+% 699 (* (- 76 164 220 106) (/ -4 634 631) (- 30 133 147 896)) 627 (% (% 3 796 127 108) (+ 141 640 498 936) (+ 585 151))
+- (+ (/ 250 662 749) 210) (% (- 738 957 640) (/ 959 73) 236) -25 (- 964 (/ 523 542 -84) (% 727 320 805 728) (* 585 158))
+% 539 (- 429 765) (+ 939 155 -90 (- 992 378 482 186))
+/ 294 (* 743 166 (/ 977 962))
+/ (/ (/ 233 160 837 951) (+ 869 221 656 143) (/ 493 213)) 666 192
+- 480 901 38 (/ (% 672 171 933) (/ 566 738 709 -7) (/ 81 -50 532 153))
+% 8
+% (% 268 (* 809 992)) (/ -53 -51 (* 134 244 274) 528)
+/ 271 698
++ 428 147 384
+/ (* 34 (/ -62 107 157 733)) 924 664 (- (/ -98 492 242 887) 678)
+* (% 43 151 (% 331 551 601)) (/ 599 572 -96)
+% 255 901 (% (+ 811 622 670 633) -83) 295
+/ 475
+* 520 (- (* 328 711) 924)
+/ (% (% 162 160) 366 (* -53 991) (% 774 6 561)) 461
++ (% (- 760 547) 67) (+ 52 (- 28 98) -51 (* 869 597 583)) (- (% 814 75 -32) 33) (+ 784 6 96)
+% -79 (/ (% -47 572) (+ 38 296) (- 627 810 181 23)) 950 (* (% 532 496) 196 11)
+/ 312 (* (/ 587 757 114 -14) (+ 371 336 578 669)) -87
+* 135
+- 637 305 436
+- (- 436 (+ 127 330 391 662)) (% (+ 167 292) (* 400 287 502) (* 473 940) (/ 863 32)) 942
+* (- (% 913 721 -26 315) (- 770 221 666) 72) 371 (/ (/ 737 918 683) 443 (* 927 60) (- 637 310)) 412
+* 182 (% 609 (/ -76 949 205) (- 329 956)) (% (/ 541 778 755) -39 162)
+* (* 726 (% -53 -35 214) (* 700 318 30 285))
+/ 523
++ -35 (% 690 973 961)
++ 700 998
+/ (/ 785 (/ 535 929)) (/ 812 405 (% -20 489 834)) 509 258
+/ 784 (- (/ 390 223 497 36) (- 148 56 933) (* 417 -9 49) (/ 717 712 413))
++ 892 (+ (/ 471 249) (% 154 700) -78 (- 343 990 -3))
+% 7
+% 313
+- (- -71 29) 243 (+ (* 288 709 147) 562 547)
++ 470 (* 517 (/ 251 94)) (/ (- 551 887 -64) (% 376 -73 154) 398 (+ 507 669)) 808
+* -19 (/ (+ 578 321) (- 355 681 275 -88) 294 318)
+- 318
+- 236
+- 520 312
+* 715 765 (/ (/ 775 514) (- 426 526 668 884)) 861
+- (+ (* 751 664 530) (% -21 154)) 297
+/ (* (* 689 405 -30 640) (+ 202 832 201 230) 687 64) (- 518 (% 530 82 605 450) (/ 244 -97 755 490)) (- 305 (% 335 20))
+- 737 123
+- 466
++ 893 (+ -86 (+ -86 965)) (* (* 659 602 390 716) 629 (+ 722 184))
++ (* (- 873 284 559) -7 (* 892 66 875 105) (* 193 933 919 517))
+% 136 (% 83 -41) 685 (- 152 (% 85 581 32 672) (/ 794 357 495 82) 285)
++ 678 (+ 694 (* 158 354 -82) (/ 507 923 201)) (- (+ 928 152 879 341) (/ 582 331) (- 266 702 226 703) 613)
+/ 478 (- (/ 10 522) (- 888 196 300 -82) 108 (- 774 244 96)) 7 593
+% (/ 900 253) (/ (+ 682 811 145) 943 882 270) 788 566
++ 706 (% (% 154 324 140 268) 543 322 (+ -29 155 644 251))
+/ 963
+* 540 (* (- -9 285 340 342) (* 764 422) 234 420) (- 451 (- 947 759 547 788) 406 125) (/ 583 (- 100 355))
+/ (+ (* 902 614 477 102) (- 697 988 724))
+/ 218 (- (* 658 410) (/ 798 859 464 966) (- 78 732 84))
++ (+ (+ 909 -79 768 179) (% 990 730 289 -86))
+/ 981 (+ 972 (- 173 4) 664 (* 141 889 336 706)) 955
++ (/ 572 616) (- 907 214 -86) 363 (* 998 (+ 799 624 -89) 306)
++ 762 (+ (/ 143 914 160 718) (/ 120 158))
+- (- (* -84 492 69) (- 947 475 439 406)) (/ (+ 271 204 170 460) (- 308 4 975)) 373
+- 774 (* 618 (- 272 6 558)) 106
+/ 584 -73
+% 640 (% (- 686 117 146 290) 102 602 313)
+% 417 (% (/ 793 758 931 241) (- 24 289 714) (% 238 943 699 456))
+- -82 (% (% 351 449 250) 497 468)
+- (+ (- 611 655 440 736) (* -79 349 472) 1000 (% 682 427)) (% 564 709 788 91) (/ (- 269 -57) 707)
+% 402 (/ (- -76 673 125 -11) 448)
+- (+ (* 185 809 529 216) 447)
+% 507
++ -51 623 (- 130 (+ 477 583) 73 (% 986 271)) (- (% 112 922 443) (+ 204 200) 879 (+ 470 561 272 622))
+* 747 (* (- 918 908 371) 763) (- 316 (+ 173 22 639) (- 762 359 182) 193) 769
+* (% (% 648 401) 752)
+- (- (* 590 -73 219) 255 (+ 830 428 927) 221) 673
+- 703 58
+/ 679 768 59 587
++ 33 533
+- (+ -9 (/ 90 -83)) (* (* 165 99 931) 207 876)
+% 848
++ (- (- 927 971 599 168) 782)
++ 53 (% (+ 533 78) (/ 505 473 623) 843 424) (/ (+ 644 721 164 949) (* 746 438 -13) (+ -84 115 224 49) 91) 995
+/ 712
+/ 601 (/ (/ -22 862) -36)
+% 780 (- 766 71) 67 759
+% (* (+ 508 615 886) (- 696 306 196 548)) 202
+/ 732 822 (- 99 284 240 (- 291 -71 645))
++ (% (/ 621 772 587) 777) 233 (/ (/ 103 112 -67 742) 104 (% 493 333 831 134))
+- (* 710 358 (* 749 -92 749 -47)) 962 (% 780 294 (/ 778 699)) (- (% 103 158) (% 432 225 317) -77)
+% 61 (+ (/ 633 354 996 674) (+ 194 111 151) 269 640)
+- 747 56 542 (/ 265 (% 602 891))
+% 149
+- (% (- 344 183 159) 88 502 (/ 719 412 475))
+/ (% 899 456 (% 779 622))
+* 947
+* 986 268 (/ 661 150) 573
+- (* (/ 979 469 53) (/ 550 305 911 462)) 250 (% -64 (% 482 724) 980) 42
+/ (/ 608 541 (+ 830 148 110) -79)
+- (/ 655 (% 7 -12))
++ (+ 677 182 (+ 203 746))
+/ (- (/ 888 440 69) 396 (- 912 -74 858 284) (* 980 541))
+* (% (- 826 951 719) 236) (% 119 (- 283 875) (/ 72 334 928) 803) 683 (/ 465 (/ 2 127 8 445))
+- (* (/ 350 449 250) (* 489 93 876 388))
+- (- -74 (/ 440 249 -81)) (/ 867 495 (% 200 104 587 618) (* 646 622 583 891)) -58
+- (- (- 782 82 673 460) (% 979 614 700) (* 965 151 831)) (* 201 (- 233 490 503 -17) 152) 781 2
+* 928 (% (* 302 65) 626)
+- 100 (* 560 (- 412 308 75 844) (/ 978 541 632) (/ 740 -46 762)) 519 (% 500 157 960 (+ 119 99))
+* (+ (% 319 914 216 536) (+ 311 -100 147)) (- 935 149) 276 (% (/ 785 -56 392 310) (* 909 463 119) (/ 836 697))
++ 810 185 (/ 925 (% 975 28) 594)
+/ 520 (+ (/ 938 976 563 612) (/ 225 117) (/ 384 256 686) (/ 412 49))
+/ (+ 673 309) 485 788
+% 97 -90
+* (+ 981 (- 925 182 798 670) (% 959 141)) (+ (+ 493 414) 223 (+ 960 924 16 127) (* 592 310 21 575)) (+ (% -28 44 65 880) (* -28 361 783 366)) 301
+% (+ (/ 780 182 141) (* 794 387 -80) 998 (+ 16 159 478 616)) (- 150 (+ 321 631 351) 651) (* 553 (% 741 895) 180 (% 331 190)) 801
+/ 453
+* 22 914 809 277
+/ (+ (+ 588 437 343 598) (% 16 694 488) (% 962 680 387) 461)
++ (* (+ 450 -75 557 266) -82 (* 346 62 543)) (/ 431 (- 200 1))
+- (- (/ 366 430 -67 623) (+ 123 808 58 567) (/ 479 568) (* 667 502 228))
+* -48
++ (% (% 340 -34 207 60) (- 756 148 980 867) (% 299 500 573) 641) 136
+- (/ 56 (/ 757 156 401 734) (- 487 141 762 203)) (- (+ 439 862) (- -51 49)) 694 (* 500 589)
+% (+ (* 821 792 877) (- 943 -85 657 828))
+/ 472 (+ 960 (% 773 686 265 -15)) (- (% 611 142 896 246) 117 (* 941 -44))
+% (% (+ -48 477 773) (% 504 145) 438 470)
++ (- 586 950 (+ -22 967 -28 -84) 350) (* 917 81 (- 904 327)) (+ (% 380 891 268) (- 903 703 885) 488)
+/ 137 132 162 (/ (- 939 737) 435 (/ 770 11 348))
+* 241
+% (+ (- -57 84 582 29) (% 306 997) 494 (* 409 -27 978)) 893
++ 406 673
+/ (* 750 210) 701
+- (/ (* 104 865 779) 470 (% -65 706 121 -50) 657) (+ 71 903 (+ 869 376) 743) 208
++ (% (* 900 541 382 889) (+ 58 -73) 240) 132 249
+% 756 791 (* 239 318 (* 866 576 177 870) 207) (+ (- 839 25 220 362) 294 772)
+% 421 (- (+ 265 109 969 684) 467) (% (- 374 87) (% 873 562) 180 (/ 569 140 705))
+/ (* (* 338 468 795 903) (* 791 264 648 608) (- 291 266 -79 639)) (+ 655 (% -32 880) 418 -38) (/ (/ 112 -41) (- 169 144 27 468) (- -66 548 246 650) (/ 25 927 446)) 464
+% (/ (+ 618 854 76) (/ 85 76)) -59
+- 66
+- (- (- 487 187 747) 308 800 644) 820 (- (% 331 788 491) 931)
+% 428 136 (- 662 (% 114 -84) 589)
++ (* (- 834 790) (/ 664 888)) (* (- 772 720 235 515) (% 185 582))
++ 608
+/ 202 529 316 215
+% 104 (/ 670 (- 551 173) 479 (/ 46 -45 264 655)) -97
+% (- (+ 90 268) 692) (/ 267 117) (+ (+ -75 163 686 -77) (/ 520 137 822) (/ 995 128 768 685)) (+ 428 831)
+/ (+ (/ 656 591 -52) (- -65 509 128))
+* (/ 158 (/ 607 399 972))
+% -22 107 61 518
+/ 426 (+ (- 520 399 0 868) 462 (- -7 271 458)) 748 (* (* -63 352) 843 (% 874 -75 554))
+* 921 698 60 (% 984 545 (/ 241 783))
+/ (* (- 169 152 347) 492 721 (* 471 643))
++ (% 850 221 (- 990 850 101)) 756 359
+- (/ 866 (* 697 295))
+- 258 (- -37 401 (/ 844 127)) (* 43 732) (/ 432 (% 993 798) (+ -19 947 801))
+/ 128
+- 397 (- 51 (/ 601 810) 428) (% (- 352 642 528 224) (* 503 163 498))
+/ (+ (- 645 958 248 219) (% 674 893 975)) (/ 601 207 144) (* (+ 973 314 -33 102) (% 995 62) (+ 407 274 401))
+- 444 (+ 30 (- 325 877 999 4) 302 (/ 104 340)) (* 128 (/ 834 415 454 261) 481 (* 409 930 801)) 273
+/ 863
+/ 523 601
+% 374 555
+% 330 (- 251 (% 957 753 451 438) (* 583 545 771)) (/ (/ 624 186) (* 314 424)) 559
+/ 308 (% 52 882 (% -6 698 897) 668) 601 482
++ 564 (/ (% 80 571 433) (* 39 542 639 813)) (- 641 430) -53
+- (/ (+ 949 795 932 569) (/ 37 88 130) (% 859 290))
++ (/ (- 272 595 785 722) (+ -62 560 430 568) (- 212 203 271 992)) (+ (+ 371 313 768) (- -45 800)) -48 327
+/ 321
+/ 957
++ (+ (* 750 85 636 941) -86 104) 33
+/ 698 (+ (* 409 -82) 862 (+ 500 749 758 962)) (- (+ 317 664) (* -48 863 195 -5) (% 223 614 88 35))
++ (/ -99 426 648 (+ 301 954 192)) 94 (* 278 (* 846 964 446) (- 197 -30 688) (- -31 387)) 884
+/ 730 (- (% 472 953 590) (- 898 834 601) (* 773 158)) 127
++ 826 69 (% 946 354)
++ (* (- 975 991 371 987) 239 (% 211 768) (* 720 968)) (/ 514 538 36)
++ 228 (- (/ 409 44 465) 210 464) (+ 110 (% 797 155 830) 599 (+ 423 855 244)) (/ 642 912 (/ 115 473 464))
+* 630 894 788
+* (/ (% 683 120 101) (+ 763 -19) 843 (% 784 -48))
+- 102 -42
+/ 621 (- 838 (* 559 613) (- 583 366 526)) 731
+* (/ 618 640) (- 535 (% 264 55 85) (/ 596 712 688)) 501 (+ (/ 217 460) 348 342)
+- 889
+/ (% 718 (/ 645 439 646 380)) 175 405 (% 939 (% 366 358 8))
+/ (/ (- 17 876) (- 33 465)) (+ (/ 173 340 534 523) 940 (- 544 8 633 45) (% 298 267 -40)) (/ 726 (/ 871 603 537) 416 (- 364 67 92)) (+ 664 983 527 667)
++ 272 (* (- 262 263 811 -21) (+ 120 269 242))
++ 590 (% (+ 592 189 905 727) 883 (% 86 556)) (% (% 311 177 305) 727 -52 (* 696 488 12 -15)) 255
+* (+ 7 (/ 265 -9 102 280) (* 914 -69))
++ 494 577 (/ -9 428) (/ (* 458 -80) 469 (- -79 709 819) 44)
++ 36
+- 715 435 313
++ -27 (+ 277 38) 797 (/ (% 551 -71) (* 617 15 213) (% 298 798) 403)
+% (- (+ 739 -65) (- 658 112 -88 19) (% -28 51) 875) (/ (/ 386 412 831) (- 637 487 257) (/ 653 784 194)) 364
+/ (* (/ 826 695 591) 985) 291
+% (% (% 528 189 826) 744 220) (% 322 459 (% 305 548))
+/ (- 986 (+ 33 -83 8 84) 315) (- (* 814 258 107 227) (- 990 739) 861)
+* (- 680 (/ 642 272) 907) (% (+ 176 706 127) (- 70 913 755 647) (- 965 -52 241 389))
+* -18 838 (* -79 (+ 862 -27 453) (* 769 600 609) (% 446 821))
++ (+ (+ 664 385) (+ 598 44)) 843 (* 184 66 87 377)
+- (/ (- 914 281 25) 62 194)
+% (+ 366 507) (% 606 (% 415 230) 604 (+ 780 813 80 640))
+% (* 658 (/ 289 249 622) 564)
+/ (/ 689 185 (/ 648 253 276 -67)) 590 224 468
+- (/ 898 (+ 37 876 189) 343) 530
+- (% (% 598 162) 29 404) 378 (* (/ 578 160 368) (% 410 862) (* 686 558 905 444) 295)
+* 870 570
+* (* (* 309 285 146 24) (- 478 670 -78 318) 763) 202 221 (* (/ 828 163 -66) 877)
+* -48 (* -30 (* -20 14 170 39) 234)
+- (* 42 (% 710 83) (/ 434 15))
+% 361
+/ 212
+- 710 908 749
+% 327
+- 653 (- 476 695 424) 433 824
++ (% 693 (- 511 338) (* 370 416 -52)) 270 (- (/ 700 238 883 484) (- -100 2) (* 681 226)) 290
+/ -55 145 319
++ (/ 380 (% 453 882 213 714))
+/ 853
+/ (% (* 881 447 456 285) -97) (+ (/ 900 -4 81 834) (% 660 198) 733 857)
+* 912 (/ (+ 181 634 823 236) (* 197 226 185 321) (/ 129 -15)) (% 237 (* 664 708 704))
+- (+ (/ 285 933) (/ 527 731)) 97 (- 324 46)
++ (+ (/ 514 667) 879 (% -36 619)) 685 (+ (% 904 678 898) (+ 88 92 590) -30)
+* (/ (+ -43 810) 462) (/ (+ 958 825 233) 773 57 -89) 261
+/ 910
+- (+ -52 780) 654 (+ (* 764 78 632) (% 181 231) 302) 664
+% (- 375 700 -76 986) 180 883
+- (/ 45 944 878) (+ 746 (* 732 784) 708 665)
+/ (- (/ 943 222 967 53) 35 (- 468 851 599 996) (* 690 181 86)) (* (+ 455 951 563) (% 527 586) (/ 768 285 185) (* 640 557)) 965 496
+- (* (/ 891 840 199) 154) (% 421 (/ 467 761 4 902) (/ 144 151 11))
++ 449
+- (/ 22 467)
+* 446 (* 548 (- -65 86 452)) (+ 395 (- 472 389)) (/ (/ 105 736 806) 678 320 (/ 973 -58 694))
+/ 673 346
+* 495 (/ (+ 399 32 -56 606) 793 (/ 613 650) (* 348 959 300)) (/ 225 2 422)
+/ 470 (- 36 6)
+% 766 (- (- 37 451 266 847) (* 992 403 566 457))
+% (+ 219 (- 471 831 125 231) (+ 178 843))
+% (/ (/ 964 729 972 241) (/ 323 652) (+ 683 665 897 -68) 201) 186 (* 365 (* 852 319 751) (- 107 8)) 787
++ 877 881 535
+% 452 967
+* 842
+* 958 (/ 936 673 447) 302
++ -10 298 210 331
++ 888
++ (- (+ 601 662 428 577) (* 965 402 -55 457) 921 (/ 515 427)) 357
+- (- (% 718 578 396) 35) (+ 748 (+ 142 896 907) (/ 780 486 237 569))
+% (+ 207 (/ 211 -96)) (+ 631 (+ 534 -21)) (+ (- 904 496) (% 482 846)) (* (% 358 -35) 233)
+/ 501 (/ (- 331 204 -25) 141 158) 581 (% (/ 519 329 -31) 606)
++ 416
+/ (/ (* 569 764 276) 413 585 391) (/ (- -82 602 663) 926 934)
+* (% (- -20 494 834) 734 (+ 754 372 356) -21) (% 369 820 -3) (* (% 527 4 337) (% 380 696 572) -71 (+ 882 165 428)) 426
+/ (- 491 40 148 (+ 453 132)) (* (% 885 469 629) (* 287 412))
++ (- 995 619)
++ (/ (/ 890 37) (- 912 837 655 -15)) 627 662
+* (+ (+ 966 138) (/ 597 -34 549) 771) 12 (- 213 52 (* 514 -47) (* 181 105)) 441
+* (- 374 63 (% 508 509 726 -17) 90) (* -92 860 (/ 225 407 244 112) (+ 159 943 735)) 459
+% (- 695 605) 742
+% 155 (* (+ 291 162) (% 409 -18) -5 (/ 466 -95)) (+ 322 152 (* 962 808 198) 397)
+/ (/ 224 22) (% 488 772 (/ 830 359 464 699)) 797 (+ (/ 943 196) 969)
+* 535
+/ 119
+- 985 (/ 570 (% -98 283 527) (/ 456 723 630) 301) (* (* 990 366 -67) (+ 373 -11 744 48))
++ (- -26 737 821 (+ 143 412 999)) (- (* -87 902 343 577) 369) (* 630 (% 99 -57 294 221)) 267
+- 25 (- 318 513 (/ 225 -85) 258)
+/ 49
+- 240 987 (% (/ 991 341) (/ 811 432) (+ 669 852) (% 159 370)) (% (/ 176 268 374 392) (% 51 71 1000 434))
+* (+ (- 351 83) (% 64 559 465) (* -77 -51)) (+ 66 101)
+/ -48 (* 932 (* 202 876 969) (+ 491 -14)) 938
+/ -95 (- 640 (* 673 382 451 558) 535) (% (% 862 325 842 -66) (% 24 -4) (/ 154 983 435)) (* 920 (- 284 31 396 34) 504 (% 529 224 759 167))
+* 415 699 698 665
+* 655
+* -53 (/ 495 (% -54 123 925 464) 853)
+% (* 496 327)
+* (* 708 (- 831 153) (% 87 305) (- 362 732 57)) (% (* 925 974 -79) (- -40 585) (+ 972 400 583 918) 145)
+/ (- 174 (+ 152 487 498) 877)
+* (/ 341 (% 824 591))
+/ 502
+- (+ (* 709 -6) (+ 773 -64) (- 316 714)) (+ 48 104) (- (* 942 793) (/ 769 192 974 494) (+ -90 816)) (* 982 378 (% 109 824 -64 -3))
+% (% 272 (/ 239 761 669) (* 834 969 996 686) (% 110 924)) (% (- 121 356) 780 12 868) 836
+/ (- 367 (- 640 965 -65) (* 734 141) (% -39 201 634 200))
+/ 674 343 772
++ (% (+ 446 205 536) (* -40 236 358 952) 697) 692
+% 585 (+ (/ 471 49 558 735) (% 807 194))
++ -66 (/ (/ 819 725) (/ 180 88 907 871) (+ 36 439)) 992
+* (- (+ 543 250) 721)
++ (+ 236 (+ 677 764 951 550) 606) 816 507 245
+% 502 (+ 384 (* 994 190) (/ 282 230 906 998)) (+ 759 906 (% 772 374 397) (% 552 593))
+- (+ (% 777 143 25 916) 200 (+ 670 72 250)) 571 (+ (* 816 442) 49 (- 184 714)) (% (% 780 491 -67 159) (+ 370 787 413))
+% (* 948 (+ 610 939 -27 803) 381 (/ 301 282 825)) 30 (/ (/ 793 215 165) 911 (+ 973 281 386 451))
++ (/ (* -22 155 260 601) (* 972 707 622) (% 405 172 451)) (- (% 236 571) 889) 696
+- 355 657
++ (% (/ 902 691 564) 898) (* 145 (% 131 891 307 583) (* 645 529))
++ 571 255 759
+/ 549
++ (* (+ 78 624 684) (+ 868 169 -87 165))
+- 577 (/ 937 805 183) (* 472 (* 644 549 489 163) 143 (/ -88 -13 528))
+* (- (- 137 549 -89 884) 771) (- 964 (/ 904 354 803) (* -87 955 243 489) 976)
+- (+ 158 -86 (% -84 964) 227) 606
++ (/ (/ 616 557) 444 (/ -34 84) (/ 393 703 272)) (+ (+ 306 344 281) (+ 217 338 250) (/ 54 383 194) 644)
+- 446 848
+/ 406 (% 920 (+ 798 257) 578)
+- (/ 569 962 101 11) (- (* 853 936 797 331) (* 278 995 24 -18)) 518 67
+% 233 (% 242 (% -51 307 947 302)) (% (+ 923 135) 209 (+ 842 185))
++ (+ 165 (+ -35 602))
+% (- (- 294 590) 266 (* 477 84 708 187) (+ 175 487 -65 296)) (* (+ -98 339 607 916) (+ 142 290) 568) (/ (- 431 219) 10 231) (% 25 74 -55)
+/ 987 (+ 224 (+ 484 20) 730)
+/ 531 (* (* 253 414 117) 845 21) (% 744 (+ 84 767 -74)) (* 121 (+ 941 827 10) (- -3 489 986))
+* 258 -65 (- (% 772 419 318 -89) 310 (- 795 794 61)) 392
+- 444 536 (% (+ 894 154) (+ 437 39)) (% (* 410 34 252 927) 917 (/ 909 33 799 749) 499)
++ (+ 0 (% 256 794 955)) (% (+ -70 440 782 185) 955 (% 741 224)) (+ (* 71 950) (% 129 810 1000) (% 940 44 717) (* 146 629 377 801)) (* (% -48 -5) 91 (- 74 725))
++ (% (% 767 933 703) (/ 447 626 141 81) (/ -10 408))
+- 359 119 (/ (/ -8 763) (* 409 779 827 210) 592 628) (- 156 354 927 792)
+- 979 770 82
+* 408
+* (- 873 (+ 409 421 946) -56 (* 914 155 778)) 295
+* 723 (/ (+ 429 -15 -95 845) (- 806 958) (+ 278 671) (% 409 710 801)) 539
++ 542 (+ 269 878) (- (+ 871 26 708) 741 (- 432 14) -50)
+% (* (* 670 461) (% 918 569 436 536) 903 (* 822 531 352 937)) (+ 656 680 (- 492 712 610)) 771
+- 270 (/ (/ 536 547 699 61) 104 930)
+* (+ 957 (/ 161 62 633 -73) (* 736 236 770) 237) 368 (/ 690 (% 617 245) 952) 376
+% (* 779 484 (* 303 57 296 816)) 906 (% (+ 715 397 240) (+ 677 49) (* 24 37 692 -15) 298)
++ (- (% 369 370) (+ 112 711) 953) (/ (* 636 775 988) 640 (/ 822 119 556 152)) 928 (* (% 980 217 24 544) (- 820 419 -26) (% 680 258 317 363) (- 111 130 923 221))
+% (% (% 243 -9 -70 259) (+ 690 677) 940 (% 884 149 71 287)) 491
++ (* (+ -3 465 183 533) 547 (+ -66 727)) (+ (* 676 52 -6) 698 -74)
+/ 84 (- 563 450 (/ -70 298)) 502
+% 729 -69
+% (% (% 893 48) 778 58 (/ 384 78)) 634
+/ 61 (+ 49 (* 141 835 84) (- 278 97 196) 724)
+- 877 820 441 (* (+ 501 -8 935 189) 917 (% 1 717))
+- 840 470 (/ (% 473 82 958 436) (- 759 664))
++ 20 -98 (/ (+ 65 -11 365) (/ 178 -33)) (/ 890 77 (% 570 364 188) (% 336 744 426))
+* (/ 954 (/ 69 44) 214 725) 859 (- 395 761 (/ 791 779 348) (* 930 521 551)) (/ (* -3 8 809) (+ 587 645 226) -81 (% 564 910 533))
++ (+ (/ 94 -61 504 811) (+ 244 731 659 545))
+* (+ (- 631 21 755) (+ 590 274))
+* 595 908 291
+- (+ (% -43 34 704 342) (+ 142 613) 339) 482 92 (* (- 398 597 640 -32) -74 (/ 20 692 877 394) (% 156 346 491))
+* (+ 221 229) (+ (/ 701 116 421) 282) (% (- 95 -35) (/ 400 747 397 138) 350 (% 585 834))
+* 281 767 372 (- (- 189 624) (+ 848 158 811) 231)
+- 244
++ 974 (% (+ 93 129 333 580) (+ 540 849 863 92) 3 (* 342 668))
+% (% (% 536 96 182) 232 337) (% (- 218 81) 470)
+- (% 637 (- 159 -74 325 467) (- 167 919) 111) -16
+- 733
+* 17 372 (/ (/ 1000 45 231 83) 51 (/ 225 987 -41 465)) 232
+- (- 14 654)
+/ (+ 213 706 487) (* (/ 302 286 753) 671 245) 140 423
+- (* (* 107 951 -20) (/ 100 734 391 73) (% 351 593 174 476) (- 646 360 314)) (+ 649 (% 665 446 856) (/ 450 828 449 587) (* 867 454)) 929 782
+- 484 -84 (% (* 192 660) (/ 272 390 465) 143)
+* 485 442
+% 750 (* (- 827 350 837 -63) 149 (% 190 62 814))
++ 472 (- (% 920 918 235) (+ 599 202 810 170) (/ 285 -94 26 -5)) (* (% 652 963) (+ 211 264))
+- 299
++ 152 (- (+ -29 305 608) 700 281) (/ 621 (- 208 806)) 969
+% 870 (- 774 -29 (+ 840 283))
+/ (+ (- -72 219 625) (% 274 909) (/ 993 724 564 437) 343) (- (% 498 215) 215) (- (* 274 591 0) (- 880 401 134 456)) 464
++ 369 (* (* 46 689) 941)
+* 869 (/ 875 48) (+ 448 600 87) (/ (% 917 278 -99) (+ 224 45 916) 83 313)
+% (/ 829 971 (+ 890 279) -43) (* (% 760 325 532 87) (/ -37 585 155) 41 614)
+/ 834 (* 187 710 791) (* 533 (+ 689 773 -31) -53 351) (+ (* 281 803 633 678) 659 (+ 125 229) (- 60 493 586))
+% 790 436 (* 49 (* 400 396 429 823) 452 (* 250 -3)) (% 347 (% 969 452 222 -84) (% 254 880 880))
+* (% 745 170 (- -13 786)) (/ 11 (- 118 135 845 705)) (% (- 865 781 61) (% 434 511) 712 356)
+% 275 177 534
+/ 120 823 (/ (/ -34 542 188 474) 2 83 (/ 31 285 518))
+- 650 (- (% 592 589 226) 213) (- 721 (+ -80 349))
+- 151 (/ 796 (- 611 545 16) 331) 254
+- (- 169 838) -67 234
+- 799 (/ (% 108 875 914) 116 (% 2 365)) (/ (/ 935 31 548 602) 477)
+* (/ (/ 56 104 76 144) (% 609 751)) (% (+ 892 -27 361) (* 415 264))
+% (+ 908 (* 830 -57) 195) 556 (* (/ -97 300) 518 -63 922)
+% 240 673 (* (* 817 272) 328)
+- 826 (/ (- -65 717 71) -44 (% 209 139 740 210)) (* (/ 848 215) (- 268 672 430 -45) (% 319 356 -18) 359)
+- (+ (+ 662 947) (+ 214 754 722 -83))
++ (* (/ 173 -99 695) 919 400 (% 694 477 717))
+* (- 188 (/ 295 525))
++ 989
+- 946
+% 814
+- (% 97 (% -60 784 -58 244) (+ 302 589) 97) 568 (* (- 627 231 250 27) 785) 793
+- 323 (% (- 734 70) (+ 724 831 788 122) 217 (- 212 940))
+- (/ (+ -60 887 94 765) (* 970 445 53 856) (/ 930 621) (/ 405 512 918 -66)) (- 717 (- 92 817 938 232) 458 (+ 179 -54 873)) 766
+% 711 (% (% 919 620 482) 942) 932
+* 838
+% 998 (+ -43 241 (% 569 142 -36)) 839
++ 25 454 (* (- 289 -16) 385 (/ 117 751 384)) 815
+* 606
+/ 628 (+ 434 (- 502 6 882) (+ 866 -29 317 151)) 505 169
+% 602
+/ (* 190 (- 604 793)) (- (- 270 -84) 503 921) 521 (* (% 97 374 540) 180 346)
++ (% 161 (+ 867 193)) (/ 997 (- 557 557 250 525) 186)
+* 571
+/ (/ 983 (+ 89 830 865)) 339 797
+% 844 840 316
++ -38 345 40
+- (% (/ 936 258) (% 256 873) 790 541) 526
+/ (- (/ 948 119 879 471) (/ 806 232) (/ 535 711 426 780)) 7 (% (+ 596 -66) (- 235 74 738 494) (- 467 953 509 837) (/ 659 904))
+* (- (% 46 847) (% 51 512 284 825) (/ 983 437) (+ 322 227 701)) (+ -40 789) (+ (% 63 589 -54) (% 241 811 -4 202))
+% (% 83 (* -58 851 -76 552)) -60 (+ (% 990 871) 545) 773
++ (* (% 480 177 844 42) (% 723 800 614) (% 328 23 583) (/ 497 404))
++ (/ (% 136 494) -13) (% (- 224 763 674) 410) 673
+* 744 845 (* (* 513 443 664 -24) -98 -84 327)
+/ (% 454 (% 549 -56 -9 723)) -93
+% 469 (% (* 385 573 829) 828 770)
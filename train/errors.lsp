@@ -0,0 +1,500 @@
+- 999
+/ 475 0
+- 112 937 (+ 526 289 402 81)
++ 99999999999999999999 253
+* (* 70 679 215 496) (/ 937 216 80.91)
+(479 2 3)
+/ 111 493 432
++ 4.51 (* 594 79) (- 893 172 972 430) 687
++ 1 (/ 237 0) 2
+(+ 1 2 200
+(+ (11))
+- 189 (+ 32.11 71.87)
+- 696 980
+(+ 1 2 285
+* 146..5
++ 1 2) 152
++ 1 2) 486
+- 973
+* (- 12.67 251 54.41 -28) (* 140 113) 5.59 (- 49 285 95 604)
+- (/ -87 789) (- 536 209 683 -95)
+(+ 1 2 279
+(127 2 3)
+(495 2 3)
+(105 2 3)
+(+ (361))
++ (+ 1.40 905 34.22) (/ 958 156 549)
+- 213 (+ 9 440 88.11)
+% 2.5 447
+* (+ 662 23.75 263) (/ 127 928 747)
+(335 2 3)
+- -10 (- 974 14.64 912)
++ 1 x 443
+/ (/ 14 259 40) 50.2
+* (* 685 460) 68.10 1.41
+/ (+ 741 99.85)
++ 1 (/ 458 0) 2
+(+ (389))
+/ 203 0
++ 0.71 (- 297 501 281 209) 579 382
+% 2.5 45
+- (- 505 319 467) 777
+% 2.5 336
++ 1 2) 130
++ 857
+* 620 773 21.86 (+ 776 367 9.17)
++ 1 (/ 155 0) 2
++ 1 (/ 244 0) 2
+(+ 1 2 61
++ (/ 81 887)
+- (+ 989 850) (/ 643 579 913 376) (* 594 49.27) (- 435 139)
+% 2.5 437
+* 477..5
+* 429..5
+- 305 (* 320 815 -82 229) 19.75
++ 99999999999999999999 61
+/ 70.0 (- 50.94 382 34 29)
+/ 408 0
+% 132 0
++ 677
+(+ (118))
+(+ (182))
+/ (- 173 892 5.50 77.82) (* 40.70 150 892 173)
++ 1 2) 309
+/ 332 0
++ (* 765 11.20 -39 929) (+ 531 85.0 613 747) 669
+* 318..5
+* (* 39.21 834 650) 77.0
++ 1 x 476
++ 1 2) 325
+(+ 1 2 476
++ 1 x 118
+(+ 1 2 434
+- (* 2 349) (/ 1 0)
+- 37.51 (/ 105 755 53.90) 376
++ (* 773 724 938 59.74) (* 487 831 210)
+- 29
+* (/ 975 801 26.61) (+ 96.12 15.65 8) 565 (+ 763 796 789 614)
+(165 2 3)
++ 1 x 11
+* 75.24 813
+- (* 2 222) (/ 1 0)
+- 87.90 (- 110 814 -32) (+ 730 896)
++ 99999999999999999999 181
+- (* 2 67) (/ 1 0)
++ 402 330 (* 762 33.87)
+- (* 396 222) (/ 518 146 370) 53.97 (* 708 -69 352 488)
+% 2.5 132
++ 1 (/ 141 0) 2
++ (- 337 883 163 851) (+ 59.6 943 30.67) 298
++ 99999999999999999999 370
++ 1 x 246
+* 96.14 (/ 261 733 664 83.45) (- 81.28 114 35.57) (/ 957 600 259)
++ 1 (/ 364 0) 2
++ 99999999999999999999 139
+* 105..5
++ 99999999999999999999 252
+* 46..5
+- 199 (- 103 605) (- 708 -91 155)
+(+ 1 2 382
+(34 2 3)
+/ 10 0
+% 2.5 356
+(+ 1 2 176
+(+ 1 2 386
+% 409 0
+(+ (368))
++ 1 (/ 427 0) 2
++ 1 (/ 48 0) 2
+/ 731 (/ 72 623 691) 221
+(+ (190))
++ 1 (/ 164 0) 2
+/ (* 927 164 853 -80)
+* 415..5
++ 1 2) 480
+- (* 95.55 358)
++ 1 x 141
+- (- 745 850 262) (* 40 520 842 425) 621 98.4
+/ 435 0
++ (+ 366 25.44 752)
++ 1 x 33
+- (* 2 116) (/ 1 0)
+- -82
+% 2.5 454
+/ 190 48.19
+(+ (296))
+/ 895 83.11 117
+% 2.5 213
++ 1 (/ 274 0) 2
+(403 2 3)
++ (+ 80.64 978 33.97) 208
+% 157 0
+* 831 836 157 598
+(+ 1 2 263
+* 338..5
+* 45..5
+% 2.5 107
+/ 32 503 (* 40.66 328) 70.26
++ 1 x 460
+/ 449 0
+(+ 1 2 306
+(391 2 3)
+/ 294 0
++ 1 x 362
+* (- 70.57 93) 611
++ 1 x 58
+(+ 1 2 155
++ (/ 114 74.3 -75 526)
++ 1 x 31
++ (- 99 893 385 354) 80 756 805
++ 1 x 354
+(454 2 3)
++ -7 951 (/ 569 668 86.72) 76.31
+% 2.5 242
+* 79 762 (- 706 315)
++ (- 610 375 326) (/ 444 297 755 -18) 25.63 28.41
+* 461..5
++ 1 2) 6
++ 1 (/ 439 0) 2
+/ 60 0
+- (* 60.25 -89 6.14 769) -75
++ (* 795 695) 515 (* 601 995)
+/ 762 (- 1000 723)
+(+ (295))
+* 49.92 (+ 1000 615 244 765) (/ 557 744 409) (- 416 809 664)
+- (* 2 218) (/ 1 0)
++ 1 2) 232
++ (* 355 907) (/ 52.48 98 477) (- 27 759) (+ 928 -29 352)
++ 1 (/ 474 0) 2
+/ 365 0
+* 318..5
+% 49 0
+% 2.5 414
+- (* 194 612 194 98.77)
+(+ (448))
+* 398..5
++ 99999999999999999999 407
+/ 414 0
+(76 2 3)
++ 99999999999999999999 421
++ 99999999999999999999 223
+(+ 1 2 333
+% 2.5 373
++ 99999999999999999999 66
+* (/ 844 382 -58 627) -89 (/ 676 -61 492) 28.21
+/ 379 (+ 35 644 53) (/ 149 345) 495
+- (* 6 -38) (* 63.23 92 762 298) (+ 21.15 44.11 961 95.29) (+ 435 842 268 887)
++ (- 846 353 85.98) (+ 354 325 143) (- 632 744 757 656) 43.95
+/ 192 0
+* 172..5
++ 99999999999999999999 233
++ 1 (/ 447 0) 2
++ 1 2) 108
++ 1 2) 313
+(303 2 3)
+* 34..5
++ 1 (/ 453 0) 2
+* 299..5
++ 1 (/ 407 0) 2
+- 28.10 -29 71
++ 99999999999999999999 337
+- (* -26 939 94.36 158)
+(+ 1 2 41
++ 99999999999999999999 468
++ 99999999999999999999 341
+% 467 0
+- (* 2 458) (/ 1 0)
++ (* 273 39.93 656) (* 77.10 593 656) (- 720 31.18)
+(+ (283))
+- (* 2 471) (/ 1 0)
+* 60.8
+% 2.5 230
+% 2.5 486
+(+ (241))
+/ (+ 893 618 -82 358) (/ 731 61.39 679)
+/ 750 823
+(61 2 3)
+* 917 (/ 751 -93 26.77 54.15)
+% 2.5 54
+(+ (129))
++ 99999999999999999999 139
++ 1 2) 96
+- (- 11 101 15 -58)
++ 99999999999999999999 463
+- (* 2 269) (/ 1 0)
+- 146 487 (+ -95 748 881) 441
+* (/ 12 77) 404 (* 289 964 471 74.38) (* 903 16 646)
+* 471..5
+/ (/ 849 642) (* 106 71.49 597) (/ 19 81.76)
++ 6.35 (+ 48.67 88) (- 895 796 683 24.92) 83
+- 670
+/ 425 0
+- (* 87.20 48.32) 126
+% 284 0
+(+ (478))
+% 2.5 221
+* 13..5
+% 277 0
+- (* 2 437) (/ 1 0)
+/ 195 0
+- (- 327 317 -83)
+- (+ 1 601)
+- (* 589 564 -7) 998 629
+(+ (159))
+(+ (150))
+(398 2 3)
++ (/ 617 51 795 64.39)
+% 386 0
+* (* 207 165)
+% 380 0
++ 331
+/ 494 (* 821 199 223) 32
+(+ (164))
++ 1 2) 378
++ 1 2) 349
+/ (* 324 745) (* 10.5 37 17.98) (/ 886 996 829 132)
++ 1 (/ 441 0) 2
+* (+ 552 996 -32) (- 133 3) (- 797 371 553) (+ 77.63 82.63 941)
+- (* 2 162) (/ 1 0)
+/ 292 0
+% 2.5 302
++ -83 56.76 (+ 245 1.25) (- 85.48 64.96)
++ 545 (/ -72 763 -28) (+ 37.44 96) (/ 162 150 767 19.91)
++ (* 382 -55) (/ 120 44.3 88.42) 369
++ 1 (/ 168 0) 2
+(490 2 3)
++ 801 (/ 46.82 146) (* 329 299 9 12.25) (/ 198 563 69.24)
+(+ 1 2 228
++ 918 (* 419 348) 619
+* 55.77 29.71
++ 18 714 (* 465 959)
+- (* 118 -69) 155 404
++ 1 x 261
++ 962
++ 1 x 246
+(+ 1 2 372
+(+ (237))
+(272 2 3)
+* (- 389 -64 273 155) (* 808 168 338 151) 20.92
+* -49
+- (* 2 476) (/ 1 0)
+(+ (472))
++ (- 8 424 876 913) -77
+* 12..5
+/ 344 (* 527 26 488 -17)
++ 99999999999999999999 437
+(275 2 3)
+/ (* 4.84 200 74.15 46) (/ 923 807 240 5.0)
+* (/ 773 848 680 868) 558 174
+- (/ 622 734) (* 579 66.17 673) (+ 865 80.68 31)
+(+ (118))
++ 1 (/ 96 0) 2
+% 363 0
+(390 2 3)
++ 51.98 (/ 511 877 882 775)
+/ 174 (- 848 385 -16) (* 194 56) (/ 992 680)
+/ 246 (+ 532 20.15 125) (+ -41 535 967) 395
+- 825 (/ 99.91 896 67.1 477)
+/ 431
+- 332 924 (+ 19 273 -23 381)
++ (- 148 294 523) 231 62.78 20.53
+- (* 2 414) (/ 1 0)
++ 567 (- 67.87 447 711)
++ 1 (/ 287 0) 2
++ 99999999999999999999 299
+/ (/ 45.33 98.12 85.26) (- 155 15.73) (- 27.37 84.29 27.4 -96) (- 127 220)
++ 99999999999999999999 462
+- (* 2 180) (/ 1 0)
+% 2.5 73
++ 1 2) 231
+* 906
+* 20.44 (* 30.43 -12 481)
+* 896
++ 99999999999999999999 221
++ 1 x 464
++ (- 47 344 -44) (* 955 19.8 2.63 173) (- 74.40 306 669) 437
+* (- 530 996 55.33)
+* 348..5
+% 2.5 96
+/ 135 0
++ 1 (/ 240 0) 2
+* 236
+% 349 0
+(+ 1 2 56
++ 1 2) 69
+* 14.94 (* 556 676 307)
++ 1 x 264
+/ 801
+/ (+ 954 599 52.69 51.99) 537
+- 323 (/ 505 -45 872)
+* 213..5
+* (/ 109 -36 223) 73.2 55.92 (+ 826 959)
+* 460..5
+* -89
+* 154..5
++ 1 x 80
++ 1 x 385
+* (- 51.5 777 725)
+- (- 468 107 809 429) (* 412 90) 855 653
+- 843
++ 99999999999999999999 441
++ 1 x 193
++ 1 (/ 453 0) 2
+* (* 394 219 777) 127
++ 99999999999999999999 109
+* 617 90.82
++ 99999999999999999999 214
+% 2.5 280
++ 1 2) 256
+- 410
+(+ 1 2 44
+/ (+ -24 49 66.47 430) 849 498
++ 1 x 314
+- (* 2 317) (/ 1 0)
+- (/ 676 49.63) (+ 712 752) 381
++ -51
+* 736 212
++ 1 x 278
++ 1 x 5
+% 365 0
++ (- 2.46 38.80 301) (* 324 86) (/ 108 15.29) 626
+* 489..5
++ 1 x 308
+/ (+ 986 263 862)
++ 1 2) 14
++ (/ -77 45.77)
++ 1 2) 51
+(290 2 3)
+(+ (414))
++ 1 (/ 63 0) 2
+* (- 483 -73 476 392)
+/ 47.7 (- 128 78.82 35) (* 333 90 792 727)
+- (/ -84 422 669 47.80) 18
++ 1 x 21
+- (* 2 257) (/ 1 0)
+* (/ 66.35 499 258) 3.80
+% 2.5 484
++ 1 2) 98
+% 88 0
+% 449 0
+/ 261 (+ 835 19.10 16.60 209) 18.54
+- (* 2 292) (/ 1 0)
++ 99999999999999999999 401
+* 61..5
+(+ (144))
++ 1 x 148
+/ -70 749 590 66.68
+% 158 0
++ (- 644 806 10.79) (* -4 26.25 13 931)
+* 618 (- 805 893 38.16 897)
++ 1 x 34
++ 99999999999999999999 65
+* 200..5
+* 692 (+ 69.10 42.92 128) 52
+* 36.21 (/ 76.21 42.8 777) 822
++ 360 (* 56.41 187 404) (* 82.4 63 15.34 4.49)
++ 1 2) 17
+% 167 0
+* (- 618 -23 541 399) (+ -62 45.52 677) (/ 332 347 37.77) 960
+- 1.1 856 915
++ 1 2) 204
+/ 219 0
+% 185 0
+% 214 0
+/ (- 567 78.65 33 619) 97.80
+(+ (374))
+- 678
+(+ 1 2 179
+/ 703 (* 725 10.91 66.82)
+- 57 36.30 (/ 300 15.73)
++ 99999999999999999999 201
+/ 460 0
+/ 73.76
++ (/ -41 10.50 28.86) 367 402 631
+/ 443 0
+% 36 0
++ 1 2) 244
++ (+ 891 382 966 184) (* 61.95 82.64 364 451) 621 (/ 57.36 309)
+(411 2 3)
++ 83.87 (* 96 831 920 856) 126
+/ 496 0
+* (+ 486 547 -89 191) (/ 383 865)
++ 653 772
+% 253 0
+% 2.5 253
+% 384 0
+- (* 2 51) (/ 1 0)
+(+ 1 2 44
+* 539 28.70
++ (* 645 793 66) 856 (+ 786 -98 31.1 606) 646
+- 888 (* 46 666 -29 691)
++ (/ 802 285)
++ (- 138 740 213) (- 56 248) 338 (/ 639 894 704)
++ (/ 91 73.65) (- 262 964) (- 968 322) 266
+- -35 (- 489 793 765)
++ 1 2) 473
+- (/ 434 109) (* 506 336 240 340) (- 25 299 -58) 676
+/ 188 0
+(44 2 3)
+* (- 412 242) (/ 41.53 -37 58.37 625) 79.81
+* (+ 65.97 343 187 246) (/ 523 177) 398 247
+% 465 0
+/ 177 0
+- (* 717 15 67.98)
+* (- 45 42.74 791 835)
+/ 222 0
+(448 2 3)
+% 260 0
++ 1 x 108
++ 1 (/ 411 0) 2
++ 1 x 253
+- (+ 870 804 840) 851
+(+ 1 2 342
++ 1 (/ 49 0) 2
+% 2.5 98
+(+ (128))
+- 793
+* 432..5
++ 1 x 454
+- (* 2 437) (/ 1 0)
++ (* 412 473 444 192) (- 779 701 118) (/ 13.50 667) (/ 414 -10 326)
+% 397 0
++ 1 (/ 361 0) 2
+/ (- -7 491)
++ 99999999999999999999 398
+/ -56 (* 657 263 416 10) 97.26 243
+- (* 2 105) (/ 1 0)
+/ 279 0
++ 1 x 143
+- (/ 464 444 253) 397 73.92
++ 99999999999999999999 61
+* 352 40 987 (- 868 71.2 608 734)
+% 2.5 282
++ (+ 786 126 934 520) 312
+(36 2 3)
+* 364..5
+/ 308 0
+(145 2 3)
+- (* 2 59) (/ 1 0)
+/ 490 0
+(+ (57))
++ 1 x 260
++ 1 2) 434
+(+ 1 2 52
+/ 398 0
++ 1 (/ 2 0) 2
++ 1 (/ 245 0) 2
+% 2.5 123
++ 99999999999999999999 125
++ 1 (/ 291 0) 2
+- (* 2 380) (/ 1 0)
+(+ 1 2 60
+% 81 0
+/ 164 (* 995 338) (* 418 736 71) 1.5
+- (/ 13 737 841 27.96)
+/ 43.73
+% 2.5 80
++ 1 2) 470
+/ (+ -8 572) (- 767 500 92) (- 957 264 830)
+* (/ 212 595 398)
+% 139 0
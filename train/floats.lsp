@@ -0,0 +1,500 @@
++ (* (+ 26.75 970) (/ 807 635) (- 51.36 820 32.12 1.77) 614)
+- (- 33.21 (* 248 376) (+ 822 0.34 35 90.88) (* 226 99.30)) (+ (* 195 35.69) (+ 872 49.32 733 22.47)) 38.18 88.82
+- 79.6 67.55
++ 19.69 247 -29 30.50
+/ 52.69 (+ (* 63.31 72.1) 78.59 -30)
+/ 69.48 (/ (/ 3.32 90.99) 14.63)
++ (+ (/ 52.6 196 517) 169 82.50) 27.75
+* -66
+* (/ (/ 86.23 80.45 28.16 10.83) (* 174 44.88 69.44 4.16) 126) 86 51.96
+* 952 (- (+ 451 33.3) (- 81 124 904)) 167 6.51
+- (- (- 944 57.5 140) 740) 18.91 (- (- 203 635 -97 346) 70.66) 725
+/ (+ (+ 51.0 11.49) (- 63.25 989)) (/ (+ 93.43 10.70 33.49) 76.75 (- 12.92 812) 10.40)
++ (* 532 81.33 (+ 41.97 52.52) 73.77) (* (* 18.91 7.70 82.92) 98.69 (- 951 98.36) (- 67.44 43 88.41)) (/ (* 742 28.44 -65 11.20) (- 119 757 261 570))
+* 714
++ 348
++ 10.16 (- 95.22 774 3.83) (* (/ 359 429 92.5) (* 18.56 28.81 3.13 581))
+- 319
+* (* 70 (/ 40.96 86.16 275 0.65)) 49.44 (/ (* 805 737) (/ 452 500 10.84 7.81)) 52.13
+* (- 329 53.94) (- 81.55 (* 73.22 51.84)) (* (+ 909 64) (/ 85.54 28.43) (* 929 32 467 759) (/ 99.2 12.12 272)) 659
+* (* (- 142 4) 981) 390
+/ 934 314
+- (- (+ 35.4 329) 139)
+- (/ 749 694 (- 4 429 82.36) (/ 46.1 57 56.43 67.21))
++ (- (/ 865 59.76 364 53.13) 948 216 76.97)
+/ (+ 29.5 13.0 1.86 (* 64.4 83.32 500)) 336 (- (+ 687 683 833) -60)
+/ (* 403 (* 190 7.94 52.38 695)) 1.27 83.66 (- (+ 354 490 499 351) 13.94 52)
++ (+ 672 (* 694 727 401 78.42)) 91 15.97
+* 218 (/ 43.41 (+ 56 909)) 29.75 937
++ 81.5 (/ 19.37 (/ 657 765 859 45.8)) 26.7
+/ 884
+- (+ 29.67 56.37) (* (/ 6.20 580 96.50 724) (/ 514 818) 1.57 (/ 61.8 322 326 721)) (- (- 64.60 732 -39 958) (/ 261 42.99 30.33 3.87) (- 53.95 41.76 778)) (+ 558 60.64 (/ 605 55.9 -44))
+- 26.51 (- (- 259 201) (+ 659 903) 62.13) 37.20
+* 727
+- 770
++ (- 52.72 (+ 445 50.34)) (+ 9.57 (+ 64 24.57))
++ (+ (- 58.23 35.48) (+ 35.56 30.71 28.72) 41.33) 565 360
+- (/ (+ 141 355) 98.72) (+ (/ 42.21 21.70 628) (/ 665 92.0 790)) 95.63 (/ 111 (- 23.98 47.99 512 387))
++ -30 (- 26.22 45.8) 578
+* 363
+* -32 64.70 (* (- 20.37 707) (/ 68.3 95.94) (- 34.96 20.74) 704)
+* (+ 25.9 (* 20.8 686 99.34 316)) (* (+ 50.57 29.12 29.92 54.35) (- 716 13.18 771 98.29) 224 (* 453 21.90 45.88))
+- 34.26 (- (+ 6.66 893 844) (* 159 94.32 214)) (- (* 124 -85 69.61 55.63) (- 248 780) 79.7 69.85)
+* 583 (* (- 556 878 22.2 445) 74.99 27.99 (* 74.50 20.22 44.1 992)) 730 514
+/ (- (- 21.20 35.11 73.22 -73) (/ 88.56 52.51 43.6) (* 8.61 -20 29.78) 72) (- (- 59.11 75.28) 5.53 (- 4.41 51.14 756))
++ (- 624 367 (- 56.54 356 321)) (- 430 55.38 12.49) 489 841
+- (/ -36 414 (- 468 42 43.12 803) 63.79) (- 21.36 (/ 34.9 244 44.54)) (- (* -78 37.98 361) 756 (+ 254 55.93 29) (+ 64.43 540 34.22 92.35)) -68
++ (+ (+ 82.81 12.37 64.66) 6.50 (+ 619 425 857 49.96)) 37
+* (+ -32 (- 89.21 125 66.39) 688 644) -32 90.31
+/ (- 56.85 864) (+ (- 52.60 475 -67 825) (/ 97.42 -5 96.26) (- 246 931 718) 560) (* 832 765 (+ 806 50.26 7.97 97.20) (+ 74.74 65.78 72.68))
+- 89.41 (- (/ -88 530 251 37.20) 996) (- (- 81.76 131 99.72) (/ 48.76 78.43 799)) 77.67
+- 469 (- (+ 128 64.0 48.82) 14.43) (+ 190 (+ 57.99 60.6 219))
+/ 316 -36 (+ 21.76 (- 506 978 3.84 837) 594)
+- (+ 75.87 688) (- 71.4 (+ 834 96.22) (/ 441 27.41)) (/ (* 892 66 94.95) 192 665 84) (- (- 34.72 90.7) 97.57)
++ (* 97.88 28.89) (* (/ 470 397 457) (- 91.72 63.31) (* 19.25 372 48.51 983) 164)
+* (/ (- 32.23 692 52.72 -78) 58.72 (- 672 216) (- 70.94 51.71)) (/ (* 15.31 22.6 415) (- 77.67 73) 1.3) 38.6
+/ 37 (* (- 44 15.2) 915 862 790) (/ 177 79.90 (+ 43.29 62.54 13.79 720)) -31
+* (+ (* -95 52.52) 582) (- (* 39.62 90.20) 297 (* 6.63 25.82 63.44) 96.73) (- 79.95 (+ 61.24 5.24 23.37 535)) 70.77
++ (+ (/ 545 -90) (/ 99.96 865 631) 240) (* 32.4 (+ 942 44.69 95 57.33)) 703
+* (+ 60.0 31.1 (* 35.2 409 206)) -51
+- 94.93 717 (* (+ 69.1 41.20 592 48.36) (- 601 170) 859 930) (+ (/ -16 140) (+ 477 61 87.18 675) 35.70)
+* 393
+- -34
+* (- 60.86 34.46) (* (+ 181 302 96.8 95.9) (* 34.53 895 735 52.23) 669) (* (- 94.68 16.47 71.57 49.66) 6.50) 30.55
++ 79 (/ (+ -11 237) -41 77.33) 842
+* (* (- 79.91 -12 59.44) (/ 427 180 36.95)) (* 65.11 71.15 (/ 984 36.97 51.20) (* 78.63 89.52)) 52.13 (- (+ 57.81 53.51 25.45) (+ -45 25.87 56.29) (+ 12.40 44.67 7.47))
+- 31.75 33.7
+/ (* 857 (* 73.94 82.67 988 95.38)) (/ 15.70 913 842 666) (+ (/ 81 400 105) (- 785 27.24))
+- 330 (/ 71.17 708 (/ 282 56.60 226)) 592 (+ 73.12 33)
+/ 957 38.63
++ (+ (* 34.88 49.7) (/ 88.77 313 352) 50.36 (- 99.97 80.92 162 59.59)) 748
++ 61.3 (/ 30.48 (* 79.64 177 73 -24)) (* 453 789 (* 58.53 72.0 780 -72) (- 65.84 726 437 45)) 40.76
+/ 892 (* (* 936 75.94 545 -71) (- 793 16.16) (* 12.20 992 52) (+ 595 2.0 273))
+/ (- (* 81.20 91.59 906) 926) (- (/ 69.37 66.6) 93.25) (* (/ 73.76 455 96.86) 56.79 692 394) (/ 3 (+ 754 51.16 53.41 40.93))
+/ (* (/ 97.45 621 22.32) (* 49.67 66.53) (- 631 48.45 13.19)) 38.33 867 (+ (- 994 -66) (- -15 826 31.52))
+- (* 82.52 88.42 (- 469 335))
+* (/ 892 (/ 589 450) 78.34 (* 850 96.98 88.62))
+* (/ (- 2.43 -8 55.0 78.32) -10 (+ 186 35.78 -65) (* 12.72 841))
+/ (/ (+ 65.54 970 312 66.96) (* 711 466 53.20 98.28) -37) (* (* 61.37 329) 294 (/ 75.27 77 67.97) 206) 48.46
+* -53 (- 350 (+ -45 250 86.73)) 777
+* (/ (* 561 44 811) 25.75) (+ (/ 74.8 77.7 519 77.97) (/ 70.26 948) 2.19) (/ 51.87 80.85 (* 69.12 72.82 971 101))
+- (/ (/ -25 -4 16.28 18.75) (/ 373 90.65 794 830))
++ (+ (/ 962 361 291 88.57) 30.94 84.27) 80.5
+* (+ 61.79 (- 35.33 47.65 114 537) 5) (+ (* 68.56 80.96) 993) (+ (/ 6.18 38.99 631 37.33) 37.3 (- 775 -56 27.17) (/ 936 143)) 649
+/ (- 50.71 (- 72.11 47.90 235 364) 48.94 420) (/ 26.38 60.90 15.44)
+* (/ (+ 0.43 20.21 85.12) 487 (+ 514 882)) 422 (- (/ 16.75 156 491) (- -42 769) (* 92.82 283 24.53 58.15) (/ 9.0 40.95 30.35))
+- 162
+- -19 796
+/ (/ (+ 57.78 19.81) 146 21.27) 28
+/ (* (- 125 404 16.48) 630 (/ 629 223 895 669)) (* 27.70 585) 326
+* (* 68.68 60.96 32.46 71) 74.25 33.89
+/ (* -84 484) 55.54 89.67 (+ 883 (+ 10.41 8.32 61.68))
+/ (+ (+ 5.78 974 38.16 58.6) -96 74.84) 47
+* -75 24.6 586
+* (- 37.19 4.13)
+* 190
++ (/ (- 163 17.35 40.29 167) 47.48 84.94)
++ 68.39
+- (- (* 139 224) 587) (/ 38.23 (* 776 254 65.55) 95.6 (* 58.81 396))
+* 29.45 585 (/ 8.34 (/ 31.81 753) 60.47)
+- 659 454
+/ (- 735 594 (- 90.96 911 208)) 10.20 (/ (- 84.36 42.64 404) (+ 705 201 60.75)) (+ 924 65.83 3.31)
++ (/ 21.99 (+ 78.54 -61)) (- (- 15.36 25.75) (/ 82.35 236 89.37) 24.76) 74.75 (* 437 (+ 82.52 684 842 52.57))
++ (- -33 21.44) (+ 457 (+ 29.34 341)) (/ (- 12.36 72.69 443 7.9) (/ 9.32 86 1.36 70) (+ 230 -21 71.53)) (+ (+ -19 18.15 310 95.42) 19.7 54.7)
+/ (+ (/ 61.12 76) (+ 100 533))
++ 0.20 (+ 68.58 (* 62.89 77.27 875) (* 54.24 389 63))
++ 676 486 143 55
+- (- 787 (- 70.32 590 41.22) (/ 9.0 46.36 8.90 69.76))
+* 937 (- 80.89 (/ 84.51 46.99 198)) (- (+ 51.17 640 3.33) 2.84 83.35)
++ 942 (/ 948 -90)
++ 456 (+ 60.52 127 230) 18.23 1.68
+* 24.45 (* 92.96 (/ 367 13.90 31.44 543)) 807 (- (- 794 81.89) (* -17 851 -41) 49 79.36)
+* 158 (+ 52.58 163 (- 357 28.96) -49)
+- (+ 84.79 (/ 390 724 -72) 41.44 (* -58 469 94.0 780)) (+ 964 (/ 93.6 53.58) 34.47 51.40) 28.53 (+ (+ 81.2 298) (/ 714 38.58 921 269) -82)
+* 32.22 -35
+* (- 31.50 (* 58.36 -42 63.72 -70) 57.7)
+- 43.86 (* (+ 185 363 2.17) (/ 85 12.62))
+* (- 69.98 87.30) (/ (/ 16.45 341) 20.64 633)
++ 85.74 398
+- (/ (+ 2.23 599) 23.43 475 (+ 624 533 57.74 192)) 99.44 (- (+ 859 68.98 42.48) 401)
+/ (+ 301 (+ 921 53.91) 22.84 (/ 73.20 557))
+/ 92.79
++ 14.50 (/ 775 19.25)
+/ (- (/ 482 652 63.10 19.77) 3.95)
+- (- (- 49 33.55) 928 (/ 61.96 428 84.70 87.63) 598) (- -38 (* 704 55.56)) (- 23.35 31.62 (* 96.49 741 56.65 54.20)) 489
+* 17.40
++ (/ 124 763 (/ 267 373 -56)) (- (* 73.14 84.47) (- 499 845) (+ 909 849 180)) 496 (+ 78.67 71.87 (- 82.93 14))
+* 899 -76 28.85
+- 17.19 0 (* (- 316 96.27 57.86) (+ 88.69 921 75 680) 86.32 (* 172 47.53 91.6)) 33.79
+* (- -99 497 67.91)
++ 943
++ 36.7 51.49 (* (* 111 82.27) (/ 6.25 81.1 51.66))
+* 57.70 77.4 84.13 318
+/ 66.49
+/ 862 (/ 967 52.8 (+ 3.42 998 24.32 69.8)) (/ 47.31 31.74 (- 51.84 59.99 586)) (+ 771 26.0 (- 65.43 59.22) (/ 354 8.81 94.90))
++ 659 (/ (+ 24.0 866 92.1 358) (- 860 95.96 97.64))
+* 884 (/ -83 9.6)
+- 37.62 6 815
+/ (/ (/ 90.78 98.51) 37.5)
+/ -68 211
+- (/ (- 273 11.74 33.31) (+ 88.36 31.53 14.42) (+ 573 89.12) 19.53) 175 327
+* (/ (- 64.64 633) (+ 36.73 72.11 687 90.64) (/ 391 -54 87) (/ 84.52 18.99 535 42.33)) (- (- 4.88 189 50.85) 95.48 (* 592 18.63) (/ 7.82 305 555 344)) 311 (+ 6.67 (- 967 0.39))
++ (- (* 76.96 87.6) (- 351 754) 53.50) -50
++ (/ 520 (* 611 351 11.4) (- 400 78.55 25.77 64.37) (+ 155 186 376 52.93)) (+ 774 (+ 50.16 343 30.55 632) 712 (- 252 276 55.56))
++ 50.41 -99
+/ (- (+ 79.61 19.55) 915 24.71) -50 495
++ 693 285 (- (* 11.68 64 531) (+ 639 -92) (- 90.81 57.71 906) 6.80) 18.75
+- 207
+* -27
+/ -53 605 29.24
+/ (+ 63.81 435 (/ 184 73.57 60.94 -50)) (* (+ 524 84.76 52.86 915) 909 (* 47.28 92.8 83.54 998))
+/ (- (* 37.71 368 623 778) (/ 50.38 392 84.58) (/ 495 98.83) 347) (* 781 (* 3.97 525 7.46 -35) (* 93.1 25.35 97.77)) (+ (- 18.75 81.44 -91 3.8) 44.14 -91 84.23)
++ 8.17 (* (- 577 92.92) (+ 45.73 21.51) 441 86.48) (* (* 24.70 616 43.10) -17)
++ 85.38 96.87
+- (/ (+ 31.56 12.17 550) (* 241 427 255)) (+ 83.56 79.7 77.55 381) (* 7.39 192) (- (/ 12.22 340 29.99) (+ 85 211 47.77) (/ 86.18 386 32.16) (* 23.77 125 499))
++ (- (- 55.78 10.4 221 890) (+ 18.87 857 698)) (* (- 775 78.10) (/ 218 75.70)) 54
+* 99.61 17.72 (/ 609 (+ 15 40.6 22.0) 966) 78.4
+- (+ (/ -4 99.6 77.99) (- 88.58 509 998)) (- (+ 31.70 814) 96.40) 48.7
++ 30.68 (- (- 303 57) (/ 99.81 53.1 72.86 76) (/ -75 65.75)) (/ (+ 16.10 91.12) (/ 55.30 46.3) (* 58.0 65))
++ (* 77.60 43.49 (- 10.30 93.87 926))
+/ (- 94.51 (/ -49 63.26 25.69) (/ 5.21 345 491 40) 680) 93.27
++ (+ (/ 256 109) 29.14) (/ (/ 32.49 68.72 65.61) (- 373 35.69 87.77)) (- (+ 270 196 132) (- 685 28.35 33.6) 197)
++ (- (* 24.2 14.57 720) (/ 976 966 877))
+* (+ 118 (+ 738 755 94.12) (+ 63.27 541)) 52.25 (- (* 22.95 748 76.39) (- 938 73.27 9) 241 (+ -74 54.63)) 251
++ 298 30.9 (* (+ 15 86.20 505) 931 380) (+ (* 80.19 41.99 600 34.8) (- 36 420 762))
+- (- 148 (/ 434 12.26) (* 40.49 6.77 98.60) (* 75.54 526 74.68 80.35))
++ (/ (- 90 65.8 26.27) (/ 827 88.17) 501) (- 21.94 (* 975 370) (+ 403 30.55 1.12))
++ 97.70 (* (+ 401 653) 799) 86
++ (* (+ 483 63.44 69.79 294) (* 174 41.11 14) (- 44 25.40 78.34)) 259 395 (/ (/ 21.72 29.68 72.32 8.80) (- 372 525 83.80 502) 22.65)
+- 38.86 (- 13.94 (/ 4.64 46.36 31.93 685)) (- 34.26 611 971 (* 61.80 409 764 26.41))
++ 58.15 (- 596 832) 36.94 (/ 780 428 (/ 89.82 55.74 33.79 10.10) 972)
+* 45.53 83.43 765 (+ (* 270 88.26 653) (/ -62 469 2.82 52.52) (- 5.17 441 790))
++ (- (+ 166 87.30 904) 48.38 (+ 96.31 488 733 6)) (- (- 73 10.97) 672 (+ -97 931 201 902)) (/ 41.53 765 36.27) (* (/ 400 68.9 208 47.56) (+ -3 28.15 517) 59.54)
+- (/ (/ 5.65 900 442 666) (* 36.64 183 289 58.32)) (+ (/ 476 19.2 883) 39.76) 11.9 26.83
+- (+ (+ -32 663 92.64 95.37) (* 583 765))
+* 25.86 4.80
++ 73.94
++ 39.74
+* 927 (/ (+ 40.64 57.35 9.39 863) 945 (/ 0.35 742 83.49 201)) (+ 51.43 (* 38 21.89) 93.23 (- 36.2 61.87 68.54)) 32.7
+* 49.48
++ (/ 84 924) 38.38 (+ 13.2 (- 64.61 631 1000 732))
+/ (/ 26.46 -83 300) 756 (+ 979 (* 15.62 571 79.79 73.66) 55)
+- 126 79.22 12.75 87
++ (+ (- 77.22 20.13 657) (- 108 65.40) 504)
++ 25.31
++ (* 8.41 39.37 11.85) (+ (/ 520 540 52.94) (/ 525 38.15) (- 189 78.76 19.7 87.10) (+ 13.88 679)) (+ 978 (- 94.15 18.53 157 10.81))
+/ (/ (/ 681 -38 454 90.11) (+ 184 620 97.16)) (/ (- 82.84 34.71) 16.32) (/ 37.42 -9)
+* (- (/ -11 3.22) (- 45.38 439 51.88) (* -53 10.81) (* 88.33 12.49 45.55))
+- (/ (/ 611 78.79 51 84.6) 17.75 12.93 (/ 887 467)) (/ (+ 324 97.92) (* 21.91 530 91.96 58.72))
++ 71.30 (+ 7.72 84.93 71.32 (/ 747 579 84.19 241)) 995
+- (- (+ 215 26.5) 602 765 (/ 2.78 470 70.28 34.93)) 73.60
+* 25.10 (* (* 930 900 90.58 78) (+ 978 20.54 97.15 141) (/ 28.34 628 47))
+* 51.56 (/ (+ 323 64.23) 24.4) 873 (- (- 340 84.76) 70.6)
+* (+ (+ 26.25 -90 42.28) 67.51) 113 (* 606 50.5 (/ 725 182 6.80)) 89.38
++ (- (* 80.87 64.46 249) (* 345 -60 829) 17.11 (/ 27.77 61.82))
+* (+ (+ 68 104 32) (* 73.86 512 39.77) (* 779 264)) (- (* 457 55.44 40.74 885) 92.78 330 (* 784 908)) 257
+- (* (+ 88.30 14.44 75.59) (+ 15.42 846 29.98 33.30) (* 173 46.59 589 13.28) 899)
+* 83.47
+/ (* 46.47 99.86) (* (* 64.12 724 67.98) (+ 30.27 518) 59.13)
+* (/ (* 901 402 154 554) (+ 922 663 724 59.3) 106 78.86) 114 49.58 (* 264 (* 714 219 46.74) (- 768 86.31 25.54 30.47) (* 734 7.58 68.68 99.10))
+- (+ (+ 77.59 534 81.39) (- 86.28 91.98 747)) 28
+* -78
++ (- (/ 214 3.65 43.23) (/ 864 441) (+ 971 74.13)) 16.25 (- 560 (/ 901 200)) (* (* 458 47.89 47.87) (* 124 990 601) 57.24)
++ 82.82 (- (/ 12.68 472 64 85.17) 434 (- 34.7 127)) 26.49
++ 99.50 (/ 763 (/ 69.30 672 77.47) 61.88)
++ 18.5 957 38.13 (- 231 42.51)
+* (+ (/ 87.96 87.2) -33 (/ 38.16 84.14 822 152) (* 284 69.18 851 846)) 42.31 50.93 251
+/ 73.94
++ 1.18 (- (* 64.38 79.81 52.46 41.10) (* 27.98 606 20.94)) 97.11 287
++ 887 (+ 829 66) (+ 57.7 (* 89.48 11.50))
+* (* 33.14 (/ 85.55 -81 28.39)) 831
+- (/ 33.74 (/ 923 440 596))
++ 68.5
+* (- (* 43.37 6.58 637) (* 15.13 61.73 39.57)) 619 65.72 (- 506 (* 26.74 64.33 678 614))
+/ (/ (- 735 66.16 875 98.56) (/ 859 83.26 732) 59.75 809)
++ 30.45
++ (/ 733 (- 29.24 395 18.27)) (- 51.90 (/ 429 -96 44.83 43.56) (/ 525 64.43 91.6))
++ (* (* 597 14.74 965) (* 39.18 -87) 740) (* 882 (/ 814 -44 -14 75.16)) 9.61 567
+/ (- (/ 963 89.9) 39.72 73.14 (/ 54.1 97.23 937)) 41.10 (- (* 2.18 -93 62.46 34.8) 181 (+ 451 16.59) 100) 87.73
+/ 370 (/ (* 286 73.47 910) 71.27) -79
+/ (* 369 34.94 (* 842 46.5 785 61.85))
+- (* (+ 216 622) 19.72)
+/ (- (- 603 661 155 27.77) (+ -61 855 58.38) (+ 512 857 743))
+- 959 (- 73.60 (- 59.61 96.33 81.39 43.38) (/ 77.48 14.43 529 66.86) (- -4 363 68.82 37.16)) 757 (+ 76.8 29.61 21.51 183)
+- 4.28 8 (+ (+ 203 13.90) 23.50 62.42 -74)
++ (- (- 458 39.20 68.81) 561 (/ 61.10 410 -60 240) 516)
+/ 92.25 -23
++ 8.82 64.62 565 7
+* (+ (- 25 807 448 360) (* 719 467) 99.85) (- 355 65.12 (- 376 31.80) (- 29.54 22.19))
+* (+ (* 839 30.29) 9.51 16.41 90.11) 68.63 446 (+ 512 (/ 75.79 47.11 29.65) (+ 54 410 607))
++ (- (* 863 88.63) (* 15.50 29.22 169) (/ 55.15 174) (+ 998 785 16.1 -99)) (+ 40.77 (/ 760 843 526 27.88) (+ 97.75 5.10 755 2)) (- (+ -22 50.84 31.71 734) (/ 621 87.45 -7 -28) (/ 998 678 67.4))
++ (/ (+ 494 80.24 45.53 59.66) -42) (- (/ 660 32.44 318 10.33) 4.55) 755 71.43
+/ 55.5
+* (- 931 798 -67) (- (* 27.30 876 30.2) (+ 71.61 20.53 36.70) (- 194 7.17)) (* 600 938 (+ 327 915 58.30 879))
+- 1.25 (* (+ 10.37 20.78) -64) (* 745 96.49)
+- (* (/ 19.57 727) 31.4) 487 59.57 (+ 962 (+ 66.80 64.1 52.51))
+/ (+ 67.70 81.78)
++ (/ 78.41 (* 1.18 33.88 414)) (/ (- 9.38 28.9 125) (+ 86.48 149 148 409)) (/ 58.11 (+ 156 674)) (- (/ 332 5.28 35.11 8.66) 112 600)
++ 811 (+ 46.53 -3 (/ 84.64 27.8 13.33))
+* 97.19 (/ 92.34 57.33 975 370) 29.50 (* 515 -66)
+- 618 82.71
++ (/ 66 731) (* (- 4.49 -57 56.37) (/ 675 962 941) 1.83) -49
++ (+ 354 (* 304 -25 13.14 51)) 766 (+ (- 37.11 630) 816 85.84) (/ (* 13.61 -46) (- 0.96 79.88 268) 44.27 (+ 834 58.27 521 216))
+* (- (* 42.84 79.19 694 89) 30.35) (+ (/ 781 46.71 878) (* 142 148 43.3) 284) (* 75.68 (/ 37.84 571) 29.76) (* 102 (/ 209 16.77 12) 255 6.85)
++ (+ (/ 74.58 33.32) (+ 373 86.94))
+- (* (+ 729 25.86 50 85.33) (/ 854 401 745 643) (/ 158 986) (- 96.10 714)) (+ 357 (- 97.14 793) (/ 80.78 747 789 31.18))
+- (- 68.19 (/ 258 77.30 33.77) (* 541 78.53) (* 470 408 779))
+/ (+ 352 77.90)
++ (/ (* 86.84 14 695 241) (/ 45.73 19.2 445 382)) (+ 712 18.24 68.0) 84.79
+/ (/ 901 (* 82.18 57.34 50) 701 (/ 67.54 45.50)) (/ 71.37 (- 1.69 50.31) 199) (- 185 (- -20 968) (+ 370 623) (* 23.0 0.8 -54 182)) (* 228 (/ 568 79.93) (* 90.2 46.10 14.79) 424)
+- 88.6 57.17
+- 83.67 289
+* (* (* 790 189) (+ 53.90 15.54 773 865)) (* 420 31)
++ 74.59 488 -44 94
+/ 745 (- 12.15 2.83 (/ 751 92.98 42.20 662) 20.17) (+ (- 522 34.94 89.91) 257 (- 98.13 42.99 41.40 791)) (/ (- 10.56 75.2 -60) 992 (+ 864 69.55 39.16 28.47))
+* (* (+ 622 807 63.76) (+ 819 357) 42.59 32.41) (+ (+ 630 851 -21 123) (- 26.25 66.76)) (+ (- 87.95 85.64 957) (- 915 13.94))
++ (/ (- 42.89 6.28 86.62) (* 948 83.13) (* 857 31.6) (+ 30.63 508 540 82.84)) 467
++ (- 98.43 98.57 (+ 93.33 74.83 328 956) 10)
+/ 822 (- (/ 47 67.39 346 -21) (- 100 854) (/ 295 3.82) (/ 694 204 91.91 478)) 737 (* (* 283 97.17 704 20.58) 577)
++ (- (+ 16.31 62.9) 575 (- 47.44 -15 204 52.14)) (+ 46.72 50.14) (+ (+ 86.93 -71 565 94.51) 19.69 (+ 36.53 622 0.32) 43.74)
+* 90.42
+/ (/ (* 17.62 24.73) (+ 741 66.22 400) 84.18 (/ 87.23 72.56 43.86 13.58))
++ (/ (+ 253 26.74 417) 55.76) (- 296 (- 48 222 673 200)) 359 22.53
++ (- (/ 272 6.40 71.41) (/ 197 24.19))
+- (- (+ 90.53 74.41 34.62) 753 (+ 33.56 80.32 601 59.27))
+/ (/ (* 89.89 753) 99.6 (+ 952 829)) (- 7.76 200 (+ 673 56.3 25.63 66.54) 91.50) (+ 722 653) (- (- 437 87.46) 87.34 2.10)
++ (/ (+ 65.99 719 13.46) 83.13) (+ (+ 54.70 806 827) (* 6.41 87 73.0) 13.63) (* (+ 44.85 60.20 370) (- 86.22 863))
+* 88.83 (* 558 (/ 97.21 49.84 428 239) 36.14 802) 650 284
+- (- (/ 816 14.95 671 -91) (* 11.58 84.5 966) 957) (* (+ 43.64 36.94 45.56 42.3) (/ 47.97 18.56) (+ 85 16)) (* (* 947 558 239) 73.52 7 (/ 463 989 97.5 202)) (/ 914 (- 42.37 235) (/ 188 477 87.32 473))
+/ 74.31 (+ (* 23.10 10.58 43.68 34.44) (- 54.79 961 831) (/ 35.42 825 41)) 78.17
+- (+ 272 (* 327 31.66 127 35.67) 77.31 615) 43 (/ (- 30.7 853 53.42 961) 29.13 16.57 (* 27.56 260)) (/ (- 45.53 8.13 9.26) (+ 280 899 -3))
+/ 511 578 (/ 37.10 (+ 969 17.9)) (/ (* 75.91 535 64.20 990) (/ 5.31 28.86) 842)
++ 2.26 (/ 56.95 (/ 69.89 592) 59.94 31.19)
++ 34.56 (+ 354 654 (* 83.16 827 91.98)) 27.43 (/ 59.28 (- 817 -54))
+* (+ (* 52.66 356 821) (/ 13.13 71.68 41 74.53) (* 842 50.43 1.38) (* 441 783 29.26 22.79)) (- (* 796 84.54 389) (* 471 763 62.52) 561)
+- -4
+- (+ 933 (/ 407 70.79) 55 139) 58.35
+- 81.83 98.58 48.46
+/ (* (* 72.47 -48 563 391) (/ 69 38.65) 486) (- 40.16 (* 26 984) (- 40.12 278) 666) (* -18 (- 436 3.65 189) 93.46)
+- (+ (* 89.22 793 82.2) (+ 81 -21)) 237
+* (+ 879 (* 83.30 565) 70.76 133) 93.29 651 (- (/ 59.54 78 30.37 137) (- 76 317))
++ 39.71 3
++ (* 73.13 (+ 85.27 50.71 323 19.29) (/ 38.91 41 74)) 88 (/ -39 225 409) 653
+/ (+ (/ 91.63 96.90 90.83) (- 327 3.25) (+ 12 88.96))
+/ (/ 59.2 475)
+/ 180 (- (+ 95.87 1.3) (+ 761 23.27 3.96)) 905 977
+- 93.0 (/ 565 (- 43.95 40.14 98.14 761))
++ (- 322 (/ 72.81 30.68)) 30.52
+* 53.35 (/ 62.98 29.13 (* 884 15.33) 65.13) 418 (* 39.91 8.9 13.39)
+/ (/ 718 (+ 90.80 44.33 50.64))
+- (* (+ 306 86.34 544) 72.45) (/ 76 181) 351 (/ (* 12.83 811 325 67.29) (+ 86.80 74.24 99.91 74) 638 24.52)
+* 415
+* (/ 253 (* 586 154 23.76 422) 776) (* (/ 624 167 21.64 1.14) 36)
+/ 84.36 (* 15.52 (- 93.65 86) (+ 1.59 111) 481)
+* 94.30 99.72 89.36 402
+* (- 68.60 (/ 71.15 -2 749 674) 91.60 66.71) 32 (/ (* -96 73.15) 9.38)
+/ 67 (- (/ 253 518 902) 957) (* 92.85 (* 914 7.60 147 597) 12.20 -37)
+- 23 (/ (- 92.26 340 639 52.39) 984 91.0)
++ (/ (+ 31.62 24 948) (/ 790 360 63.96 954)) 216
+/ (/ (- 7.60 450 708 17.54) (* 98.76 928 75.34 73.44) -18) 16.96 22.50 (- 696 (* 47.56 1.78 -33))
+/ (+ 55.65 456 (/ 43.90 887 -50) 329) 735 (- 27.33 626)
+/ (- 348 (- 74.26 29.29) (+ 539 26.32)) (+ (+ 29.97 15.80 953) 51.81)
++ 70.80 (* 67.90 (* 877 689 690 90.45) 195)
++ (- (- 41.26 822 77.54) (* 92.16 337 -23 58.78) (/ 345 64 -54 12.76)) (/ (+ -39 1.50 94.83 -25) 38.63 38.72) (/ 82 (+ 279 60.48))
+- 97.51 504
+- 589 (* 556 (* 99.84 306 7.65)) (+ -68 (/ 48.28 243)) 59.26
+- (- (/ 33 50.0 153) 70.66 -54) (- 96.57 (- 45.78 35.11 55.7 -53) (/ 499 649) (+ 96.62 456))
+/ (* (- 378 16 566 73.3) (/ 11.70 69.38 806) 929) 31.33 725 (- 41.7 73.82 (/ 77.81 28.38 375) 575)
+- 45.49
++ (+ (+ 39.53 681) 20) 56.35
+/ (+ (+ 22.14 -10 386) (/ 44.70 929 43 -10) 151 340) 69.53 (/ 40.40 (+ 886 66.1)) -37
++ (* 667 (/ 85 137 51.80 665) 15.73) 355
+/ 84.63 1.82 317 (* (+ 19.75 17.9 472 234) (+ 443 6.27 86.9 864))
+/ (* 69.0 88.23 (- 29.7 658 779 86.11)) 55.6 (+ 93.16 (- 353 23.41 95.65 177) 352 84.43)
+/ (/ -1 (* 11.8 6.27) (+ 35.99 88.71 418 52.5) (+ 109 99.70 459 41.33))
+* 75.87 (* 835 76.71 613 (+ 77.35 18.85 -68)) 83.56
+/ 97.80 (/ (+ 299 50.36 67.80 60.37) (/ 1.17 693 57.49 97.49) 717)
+/ (* (* 745 5.15 48.20) (/ 20.8 918 322 18.41) 25.43 699)
++ (* 23.13 595 (+ 93.29 98.11 15.65 52.2) 370)
+* 91.91 200
+* (- 53 68.62 (* 303 853 886 209) (* 97 774)) (- 72.87 (+ 1.5 684 39.20 604)) (/ (* 36.99 610 754 89.38) (- 911 205))
+* 81.41 59.67 (- 31.32 94.67 225 50.60)
+/ (+ 914 925 164 26.9) (- (* 47.99 179 12.84 884) (+ 439 81.15 49.10) 18.75 (/ 59.39 26.27 78.61)) 46.29 35.74
+/ (/ 321 (* 76.76 94.91)) (* (+ 937 60.65 90.16 73.75) 345 (- 36.74 331 20.21 77.41) 56.1)
+* 39.93 (- (* 63.32 2.28 52.97) 86.57 231) (- (- 160 27.64 68.21 33.97) 90.27) (- (* 782 -25 721 713) 45.29)
++ 441 93.35
++ (* 33.23 381 (+ -62 90.92 670))
+* 43.74
+* (* (- 923 304) (- 88.50 63.22 59.54) (/ 26.46 770 99.39) 76.9) (- 509 166 -74 (/ 3.4 10.28 584)) 530
+* (/ (- 74.77 0.92) (/ 687 412) (+ 83 61.28 -46)) 680
+/ 4.74 (+ (- 39.28 17 49.72) (- 860 96.82 87.56))
+- (/ 42.39 (+ 321 274 747) 768) (/ (/ 96.67 77.60) 48.61 (* 298 741) 4)
+- 63.84 618 (* 94.49 74.81 10.44 388) 32.40
++ 394 82.0
+* 79.33 56.44 -34 (/ 27.25 (* 282 147 76.48) -13 (* 58.26 35.11))
+* (/ 427 (* 94.18 66.29))
+/ 708 (/ (/ 407 17.62 73.79) (+ 9 480 42) 22.80) (+ (+ 571 38.66 59.60 861) 30.2 27.41) 452
+/ (+ (- 97.59 51.67 55.96) (/ 145 273) 94) (+ 46.76 (* 94.26 408 64.57 88.64))
++ (+ (/ 3.54 63.4 980 68.87) (/ 949 -79 66.98 27.55) (* 86.0 437 881 7.78) 57.70) (- (* 69 95.66) 446 (* 546 341) -32) (* 600 10 26.83) 76.84
+/ 76.21 (* 401 140 (* 848 20.3)) 631 568
++ 85.68
+- (/ 516 (+ 30.7 609 36.90 66.45) 815 (- 574 570 13.47))
++ (- (/ 627 101 278) (* 53.99 977 62 43.75) 65.15 (* 64.58 86.43 90.97)) 135
+* (- 37.5 56.52 (* 330 42.65 26) (- 56.99 57.98 917 456))
+* 140 203
+* (/ 90.36 (* 535 752 33.92 116) 86.72 62.15) 28.43
++ (/ -58 19.99 (/ 713 8.36)) (+ (* 81.6 36.46) 37.45 644 (- 71.84 47.84))
+/ 78.45 (* (+ 91.6 10.60 42.87 41.98) 835 (- -6 396 760) 960) (* (+ 97.70 10.11) 254 6.4 (- 386 787 75.5 0.85)) (- (/ 83.8 332 480 821) (/ 31.95 176 376) 280 728)
+/ (- (* 427 71.24 240) (/ 76.83 11.87 871) 458 (- 57.84 32.49 344)) (* 55.51 78.35) 48.74
++ 695 963 272 (- (- 62.17 6.28 29.62) (* 31 52.62))
+* (- (* 566 820 661) (/ 86.0 45.43 94.16 880)) (* 339 (- 47.52 55.45) 32.22 11.87) (/ (+ 31.41 73.11 980) -56 (/ 382 70.40 11.80))
+* (- (/ 26.23 -3 163) -97 935 (+ -12 19.16 982 58.83)) (* (/ -58 16.60 23.44) (/ 493 64.24) -88 (/ 650 5.54 76.96 17.13))
+/ 311 (+ (- 31.10 808) 267 50.5) 11.52 (* 413 (* 58.17 395 60.95) 40.14 629)
+/ 553 (+ (+ 684 88.76 23.30 24.73) (- 658 36.93)) (* (/ 7.56 285 13.90) (+ 50.87 95.67)) (* 92.4 32 64.4 (+ 289 99.46))
+- (- 98.47 (- 8 69.36 98.33)) -33
+- (+ 23.43 (- 358 863 82.69 67.13) (/ 77.12 94.30 389) 17)
+* (+ (- 50 27.48) 66.77 (* 49.44 506 626 584)) (* 48.47 23.1 (* 92.23 74.84 741)) 80.84
+/ 2.94
++ (- (+ 73.0 37 0 25.17) (/ 3.44 972 62.63 73) 174)
+/ (+ (/ 721 3.62 81.40 641) 129) (- 146 (* 93.72 841 986))
+- 13.54 (* (/ 15.70 14.62) (* 36.63 30.47 582 528) 49.77 (/ 18.98 10.78)) 420
+/ 129
++ (- 335 (- 27.5 50.67 94.92 665)) 42.22 17.76 (/ (+ 20.51 303) 57.29 (- 28.10 58.65))
+/ (+ (* 799 97.82 547 61.88) (/ 38.26 16.85 38.82 44.31)) (+ (/ 75.18 840 79.34) (- 664 45.53 78.32)) 733
+/ (* 457 458 91.8) 62.99 (/ (* 207 0.13 45) (/ 132 19.97 402 41.26) (+ 91.63 24.38)) (/ (/ 230 38.42 481) 22.15)
+- (/ (- 482 10.96) 369 7.79 (* 3 31.73 57)) 632 17.9
+* (+ 898 65.5)
+* 982 (* 25.55 -75 76.8) 97.40 (/ (* 21.72 42.22 522 248) 137 (+ 73.74 453 494 0.96) 641)
+/ (* 15.20 (+ 5.19 64.82)) 79.64
+/ 9.88 (/ (+ 836 569) (+ 34.88 153 541)) 14.71 (+ 181 68.98)
+- -75 (- (* 50.61 397 223) 31.96 (- 803 817) (+ 305 996 90.54))
+/ 922 (- 265 (+ 27.89 47.9)) 909 (- (- 55.44 8.55 989) (- 55.96 379 553 349) (+ 65.73 48.82 85.80 58.70))
+/ (+ 621 (/ 66.78 381 10.92 74.75) 24.40)
+- (+ 83.0 (* 509 718) 48.64) 156 (- (* 78.99 472 469 233) (* 24.90 41.78 37.12) (- 124 103 52.63 13.86) 778)
+- (+ (* 63.18 33.17) 928 (/ 306 253)) 129 8.67 (- (* 87.95 17.15 20.56 766) 345 26.30)
++ (/ (+ 584 431 -47) 990)
++ 70.47
++ (- (* -52 816) 765)
++ (/ 292 72.77 (+ -58 82.39) (* 528 13.5)) 5.2 8.1 (+ 42.95 (* 60.97 200))
+- (* (/ 901 99.9) (/ 829 60.94 47.8 61.59) (- 72 357)) (- 4.35 553)
+* (+ (/ 14.68 -38 74.84 39.93) (- 119 62.40 294 117) (* 187 35.39) (- 10.86 415 52.29 761)) (+ (/ 45.25 84.35 87.44 83.44) (- 36.97 821 957 746)) (- (- -36 832) (+ 96.79 97.8 255) 56.46 (+ 2.88 775 10.66)) 205
+/ (* 70.53 (+ 928 99.1) 59.99) 37.28
++ 48.84 888 (* (+ 16 29.65) (/ 924 192 73.20) 67.15 292) 490
+- 631 (* (+ 76.10 872) 30.97)
+/ 625 (/ 577 11.83 (- 43.33 8.14)) (+ 62.13 74.26 16.22 442)
+- (/ (- 309 178 54.15 52.13) (* 537 18.52 74 574) 99.40 (- 655 13.34 536)) (- 47.75 7.88) 582 (- (* 915 63.91) (+ 823 638 37.16 35.90) (/ 36.99 699 75.31) 6.6)
+/ 946
+- 94.85 (* (- 83.37 677 12.17 32.3) (* 625 791 96.55)) 355 417
+/ 17.46
++ 50.99 7.83 (* (* 841 632 31.54) 441) (* (* 625 625 938 254) 13.63 (* 194 13.67 18.87 3.20))
+- 164 (+ -38 (* 49.43 103) 373)
++ (* (- 231 99.83 81.43 247) (- 760 34.23 26.40))
+* (- (/ 172 965) (/ 63 605 1.17 62.56) (+ 80.80 89.66 72.85) (* 39 45.60)) 629
+- (- (- 640 79.26) (/ 366 16.78 24.35))
++ (+ (/ 664 -46 743 -63) 19.22) 878 96.15
+* 562 (+ 41.79 (/ 46.57 -40 25.1)) (+ (* 1.21 472) 3.6 766)
+/ (/ -90 (+ 37.79 796 31.50) 50.16) 594 489
+- 362
+* (* 49.33 (* 486 91.96 819 4.56) (/ 637 814 9.96 50.82)) (/ (/ 932 30.83 549) 9.20 14.55) (* (- 798 453 37.5) (- 65.57 74.22 185) (- 225 26.43 141 49.61) (+ -91 99.43))
+/ (+ 271 2.0 (+ 335 77.5 320)) 450 403
+/ (- (/ 446 808 803 -44) (+ 63.34 103 390) 6.35 (+ 899 481 71.56 93.81)) (/ (/ 10.45 903 -88) (* 795 67.19 69.92)) (+ 378 (* 930 254) 252)
++ 973 (- -71 (+ 183 -87))
+* (* 889 444 677) 53.70 (- 87.94 51.62 (/ 870 688 32.61) (+ 1.64 600 186 536))
+* (+ 79.68 (- 898 858 94.35 0.55) 640) (/ 857 (- 464 48.61 53.55 4.31) 426 69.89) 389
+- (+ (* 45.32 562 63.40 89.37) 113)
+* 58.32
+* (- 73.69 82 (* 768 784 406)) (- (* 1000 32.8 68.18 87.49) (+ 127 785 54.77 60.53) (- 87.68 55.67 139 75.58) 93.77) (+ (+ 912 19) (* 160 284 830 16.15)) (* 35.45 (/ 454 23.19) 54.52 334)
+* (* (/ 86.68 35.1) 542)
+* 20.7 38.24 (* (* 334 405) (+ 853 33.34 25.11 79.1))
+/ 382 (- (/ 351 45.43 50.8) 60.28) 13.36 (+ (/ 87.31 161 267) (+ 608 82.12))
+- (- 20.60 (* 36.57 27.90 43 -12) 124 76.31) (* (+ 72 83 86.23) (+ 83.92 81 91.35 288) 703) 20.95
+/ 97.90
++ (- (/ 389 59.65 80.64) (/ 61.13 27.24 662 1.5))
++ (- (* 768 874 577 47.70) 70.84 3.30 343)
+- (/ (/ 98.8 95.52 581 40.63) 39 (* 923 86.49)) 639
+/ (+ (- 95.40 72.50 956 17.11) 16.41) 45.61 (* 370 (/ 36.18 528) 60.5 (- 75.71 2.79 640))
+- (- 656 525 (- 58.55 572 6.69 27.84) (* 87.79 56.64 38.51)) 77.39 (- (+ 533 52.64 87.95 93.2) (* 81.54 61.23 72.96 331) (- 20.62 38.91 745))
+- (* 393 55.53 12.38) (/ (/ 64.70 94.95 968 246) 32.2) (* (/ 754 370 459 71.69) 107) (+ 448 (+ 316 63.77))
+- 223
+- 64.97
+* 392 (* 396 (/ 344 496 263 62.5))
+- 773 (+ 2.31 895)
+* (+ (+ 62 670 335 256) (* 27.65 885 9.40 63.38)) 59.80 826 68.23
++ 964 313 133
+- 87.1 339
+- (- (* 687 18.83) (- 12.55 44.92)) 340 86.3
++ 131
+/ (/ 267 64.50 (- 99.2 5.78 71) (* -53 86.1)) 77.66 85.43 40.0
+* 62.57 932 62.6
++ (/ 5.43 (- 0.10 20.56 82.76) (- 23.72 88.70 167 13.11)) (+ 25.49 (+ 645 38.5 8.8 459))
+/ (/ (* 56.72 65.71 24.80 234) (* 84.77 81.38))
++ (+ 96.35 (* 88.51 53.9 592 72.51) (+ 19.12 39.42 61.59) (+ 321 415)) (* 232 560)
+- 273 (/ 257 (- 289 92.43 -68 32.3))
+- (- (* 36.34 58.31 376) 610 9.70 (/ 21.19 42.28 538 699)) (+ 34.99 17.11) 423 (* (/ 67.71 27.24) 35.34)
+* (+ (* 37.18 13.59) 442 879 (- 988 267)) (* 46.9 52.34 (- 490 76.64 255)) 561
+- 142 25 (+ 54 (- 72.22 380 59.71) 25.9) 187
+* (- (/ 95.6 45) (/ 94.95 133) (/ 396 533 201 30) (/ -25 1.54 98.34 44.74)) 21.40 291 32.97
++ (/ (/ 173 22.7 63 89.78) (- 59.79 48.79 827)) (* 8.36 179)
+* 62.21 766 654 559
+* (/ 903 (- 43.40 73.60 994 327) 60.39 (+ 27.77 86.68)) 35.29 (- (/ 17.67 70.80 80.49 1.79) 86.59 (/ 568 251)) 37.16
+/ (/ (* 167 607) (+ 77.81 51.47 20.35 863) (* 754 642)) (* (/ 622 216 21.21) (* 75.81 84.62 247) (/ 258 776 20.26 713))
+/ (+ 66.43 7.71) 73.91 18.53
+* (- (+ 887 31.42 36.53 16.92) 34.7 (- 31.26 52.9) 976) (/ (/ 286 939 13.91) (+ 49.6 314 373)) 497 517
+- (/ (+ 307 60.70 224 36) 53.62) (/ (/ 53.43 834 45.44) 19 932) 89.32 127
++ 545
+* 79.93 (- 68 43 544 851)
++ 17.54 91.13
+* (* (/ 53.36 401 422) (/ 828 22.74 55.72 61.21) 222)
+- (- (+ 23.68 98.71) (+ 514 633 686 583) (+ 465 50.84 511 98.41)) -88 47.21
+* (/ (* 1.8 862 609) (+ 57.5 367 18.97 603) (- 17 534 845 91.4)) (/ -13 (+ 84.38 62.75 79))
+/ 22.62 929 (- (/ 928 11.45 766) (/ 43 95.59 41.46 752))
++ 517 (- (- 81.1 47.40 52.14) (+ 42.53 283) 52) (* (+ 18.82 823 538 694) (* 96.64 736 74 359) 80.6) 73.23
+- (+ 15.17 (/ -80 49.26 85 928) (- -66 643 363)) (+ (- 24.44 26.82) (/ 79.93 98.77 32) 1.90) 226
+/ 531 (- 680 160 (- 65 65.88 -74) (+ 574 745 37 309))
++ 929
++ (+ (/ 50.83 522 64.9) (- 568 473 24.25)) (/ 84.76 360 (- 305 120 218) (* 817 575)) 601 411
++ 7.58 (- (/ 79.37 47 227) (- 246 51 35.75 63.52) 51.92 802) 65.21
+- 571 (+ (* 288 424 555 52.50) 997) (* -31 (+ 44.92 56.65 26.72 646) (- 139 483 81.58) 71.99) 4.90
+/ (/ 28.81 (+ 97.73 711))
+/ (/ (- 37.99 28.48 61.0 12.74) (+ 41.62 296 901)) (* 76.31 76.0 (* 990 30.91 624)) (/ 576 75.22 161 941) (+ 1.11 (/ 856 -74) 74.85 -29)
+/ (* 374 (/ 51.96 -34 465) 67.40) (/ 13.25 (* 84.69 258 8.13) -15)
+- (+ 478 72.57 (+ 185 69.90 53.59 55.4) (/ 972 555)) (+ (* 863 993) (* 298 12.65 30.20 318)) (/ 48.31 (+ 39.71 41.15 13.9) (/ 57.51 910) 90.85)
+- (+ (/ 452 64.79 280) 328)
+/ 61.14
+- (/ (/ 59.8 51.36 748) (* 88.95 29.57 22.45 38.38) (- 53.83 -1 966) 13.14) 31.29 (* 94.53 (+ 84.52 989 77.69 94.26))
++ 7.22 (* (+ 512 604) 323 (- 46.17 41.57) 43.92)
+/ -85 (- (- 14.85 698 947) (/ 413 92.23 341 -50))
+- (* (/ 67.12 287 217 73.35) 259 (- -99 702)) 74.32 (+ 35.8 (- 985 389 98.0) 51.28 224)
+- (* 531 (/ 54.64 794 89) 650 69.52) (* 510 87.67 (- 21.46 262)) (* (- 50.25 70.37 13.60) 19.65 (- 729 6.65)) (* (+ 30.32 355 -30 12.7) (+ 98.48 96.18 643) (* 0.68 829) (/ 73.45 13.81))
++ (+ 749 (+ -88 75.2)) (/ (* 116 677) (- 3.53 62.69 554) (- 781 22.87)) 974
+- 1.58 1.87 (- (+ 84.3 -38) (/ 69.43 28.84 15.63) (* 548 94.8 70.88) 264)
+- (- (+ 270 75.87 14.56) (+ 223 55.21) 41.97 178)
+* 388
++ (- 896 19.30 (* 86.29 50.45 76.74)) (- (* 291 3.66 32.12 52.83) 83.5 (+ 457 946 116) 40.15)
+- (- 32.36 374) (+ -80 630 932)
+* 326 (* 0.56 93.7 (/ 0.71 0.24 76.26) (- 171 477 27.74)) 51.2 572
+/ 781 71.6 775 8.58
+* 37 49.34
+- (- 632 94.89) (/ (* 71.59 494) (+ 79.77 92.38))
+/ 86.83 35.97 (+ (/ 39.46 697 588 823) 99.4 (* 26.51 97) (+ 917 542 81.35))
+- (- (/ 8.86 106 64.59 52.31) 4.33)
+* (/ (+ 61.88 8.70) (+ 993 237) 31) (/ (* 612 585) (- 26 469 53.26)) 72.51 (+ (/ 422 95 39.0 95.93) 656 99.15)
++ 810 (/ (- 930 576) (* 26.95 75.91)) (- 883 (/ 558 812 650) (/ 398 891 22 560)) 192
+* (/ 91.51 873 2.32)
++ 20 12.52
+/ (- (+ 19.57 859 55.27) (* 97.37 89.58) -52) (- (+ 733 17.21 797) 538 81.29 (* 53.34 158 6.36 59.65)) 318 88.13
+* 704 (- 865 216 (+ 56.55 41.36 564 81.22)) 133
+/ 21.64 (+ (+ 38 66.4 827) 48.99 (/ 47.17 40.15 1.94)) 63.1
+* (* (/ 16.98 86.75 788) (* 19.51 55.3 82.23 44.8)) 97.75
+/ 872 (* 22.58 (* 584 -60 908) 25.34 35.87) 89.55
+* 86.33 (/ (+ 67.88 74.92) 996)
+* (* 518 (+ 955 96.76))
+- (+ (+ 940 15.34 27.36) (+ 130 -2 90.28) 784)
++ (- 521 53) 495
+/ (* (- 610 289 20.6 34.79) (* 557 252 74.19 28.10)) (* 87.45 (+ 62.65 332 73.79) 30.64 (/ 714 5.67 92.90)) (* (- -53 18.34) (/ 23.52 27.85 645)) (* 142 (+ 64.25 539 -26 655) 471)
+- (* (+ 55.78 48.78 47.85 749) (/ 184 68.30 22.60) 151 (* 863 -33 17.65)) 918 761 2.17
+/ 46.85 82.36 (+ (- 153 783) (/ 2 764 426))
+/ (- (+ 25 70.29) (- 71.22 10.82 860 608)) (- (- 75.28 165) 97.63 (- 46.57 -2 13.84) (* 36.67 4.29)) (- 994 (* -68 484) (- 537 60.7 400) (- 16.82 207 549 10.53)) (/ (/ 826 39 958 340) (+ 566 495) (* 8.14 586 254 80.42) (+ 843 62.73))
+/ 74.48 (* (/ 10.90 80.80 17.2 91.82) 99 (- 752 709 10.41 75.43))
++ (+ (/ -72 -84) 45.65 (- 22.61 500 707) 163) (- (* 75.59 42.8) 32.26) (- 47.86 56.27 166)
+/ (/ -82 796 (* 61.9 273)) (+ -28 (* 90.52 918 459) (+ 21.37 654 64.84)) (+ 692 (* 46.41 677 40.93 71.97))
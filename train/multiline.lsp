@@ -0,0 +1,733 @@
+(+
+916
+67.84)
+(+
+-62
+928)
+(+
+930
+65)
+(+ 45.72
+129)
+(+
+167 536)
+(+
+82
+7.43)
+(+
+173
+301)
+(+
+738
+35.35)
+(+
+939
+727)
+(* (+ (* (* 94.15 44 63.33) (+ 542 67.25 146 20.12) (* 615 973) 50.28) -58) (/ (- 58.93 (- 107 332 70 845) 46 754) (/ 783 -50 46 (* 914 3.39 464)) (- 479 (/ 291 924 759 256)) (* 266 716 171)) (/ (+ 373 (+ 933 397)) 199 61 (/ (+ 484 417) 184 149 (+ 730 996 87.40))) (/ 13.65 47.43 (+ 235 74.59 (/ 653 827 25) (+ 82.53 5.68 466
+791))))
+(/ 82.74 (- 25.76 (+ (* 49 290 14.2 168) (/ 28.37 973 5) (+ 17.46 72.1 35.10 50.90)) 783 (/ (- 914 408) (* 52.14 49.92 149 376)
+(/ 15.66 391 854 284))) 738)
+(+
+24.50
+143)
+
+(* (- (* (- 11 853) (+ 860 59.99 41)) (+ 345 (* 40.35 897 206) 111 (* -61 68.78))) (/ (+ (+ 75.14 694 796) (* 564 21.61) 605 (/ 384 747)) (* (+ 760 968 150 141) (* 919 65 417 836))) (/ (/ (/ 964 93.63 166 -73) 990) (- 39.69 865 (+
+993 28 505) (* 123 712)) (/ (/ 112 95.86 85.0 -24) (/ 961 -36 86.41))))
+(+
+406
+16.48)
+(+
+35.11 -85)
+(+
+147 196)
+
+(* 800 (/ 558 (+
+861 (/ 58.66
+608 215 34.71)) 532 -11))
+(+
+-99
+485)
+(-
+737
+511)
+(+
+68.81
+66.85)
+(/
+59.30
+442)
+(+ 565
+992)
+(+
+-39
+96.70)
+(+ (- 997 (- (*
+933 513 442) 504) (/ (/ 37.23 579 394 8) (* 423 56.96)
+(- 185 7.11 617) 599) (- (* 672 49.48) (/ -78 5.69) 414)) (- (* (/ 209 67.73 857 271) (/ 51.59 926)) (- 619 (/ 629 17 45.27) (* 883 60.7 477
+17.87))))
+(* (- (- (+ -29 730 336) 148 371
+52.76) 50.87 681 (/ 72.7 (+ 899 507))) (+ (* 370 (- 808 342 44.51 92) (+ 63.19 417 279)) (+
+79.37 679))
+52.34)
+(- (/ (- (- 751 58.58) (- 69.12 68.40 390 10.48)) 653 52.62) (+ (/ (/ 62.12 41.51 383 669) 288 601 (/ 65.28 195)) (+ (/ 711 77) (- 32.45 510 240 274) (+ 405 652 637)) (* 775 (* 1.50 55.30 486))) (* (* 22.36 (- 769 82.71 979)) 562 747 (/ (- 790
+810) 823)))
+(+
+966 771)
+(+ (- 24.30 397) (* -99 32.12)
+(- 436 (* (- 406 992) 188 (* 476 715))) (- 22.0 (* 625 780 (/
+377 583 81 148))))
+(* (*
+(* 592 29.46) (+ 75.7 (/ 832 686 97.89 63.15) (* 397 58.44) (/ 52.2 21.79 -90 420))) 923 (/ (*
+(- 548 290) 66.49 61.83)
+(/ 82.42 71.96 86.18)))
+(+ 38
+436)
+(* 264 (* 29.32 (* (- 734 860 -77) -11 (* 19.2 626))
+(- 60.87 (* 7.28 1.99))))
+(+
+8.12
+31.1)
+(+
+827
+74.23)
+(-
+(- (+ (- 758 461) 839 70) (+ 201 887 21.90 772) (* (/ 12.46 176) (/ 702 332 16 721))) (* 568 347 (- (* 458 482) 936 (+ 43 276) 824)) 56 (- -20 (* (+ -54 562 519 381) (+ 38.66 948 926)) (* 226
+186) (- (+ 516 583 826)
+(/ 18 692 54))))
+(/ 896 (/ 181 (* 4.42 (/ 64.16 -27 44.44 -31) 560 (- 325
+80.78 65.48 529)) (/ 399 (* 23.13 585 805 271) (+ 789 235) 95.33) 528))
+(+
+109
+80)
+(* 29 580 (+ (* (/ 474 723 69) (+ 6.38 681 85)) 371)
+(/ (* (- 36.91 99.78 48.53 4.76) 110) (- 218 39 (* 676 641 712)) 95.76 (- 528 72.33 (- 841 61.85 71.88 633) 700)))
+
+(+ 638 (+
+15 563 (/ (* 976 268 58.57) (+ 939 92.52)) (+ 85.54 65.21)))
+(/ (-
+16 (- 788 224
+263)) (/
+95.49 59) 603)
+(- 791 (/
+(- 544 29 12) 511 955))
+(* -89
+677 515)
+(/ (- 588 560 24.49 260) 792 (- -1 (- (+ 77 30.25 851) (- 358 225)
+(- 317 41.90
+60.51 387)) 120))
+
+(* (- (* (/
+549 976 117) 29.29) (/ (/ -23 248 404 68.90) 270 67.43) (+ (- 27.66 739) 827 153 262) (- -33 848 (- 732 428 818 658))) (/ 809 (+ (* 432 713 784 983) (/ 146 748 16) (+
+923 298 405 298))))
+(/ 15.3 (/ (- (+ 58.77 503) (* 137 364 55.53 77) 174 (* 739 87.30)) (-
+(+ -63 66.10) (* 679 649 32.4 7.12)) (- (+ 730 450 -52) (* 493 892 -44 117) (- 3 24.91 584)
+450) 586) 991 171)
+(- (- 740
+809 -22)
+72.39 44.60
+614)
+(+
+22.67
+12.91)
+(- 751 (/ (/
+(+ 437 624 28 932) 90.94 26) (/ 57.96 (/ -74 299 407) (/ 669
+72.94 47)) (* 440 (- 863 77.60))) 716)
+(+ 491 94.68 (/ (+ 278 (* 281
+193 85) (/ 479 650 62.24)) 0 416) 618)
+(+
+668
+951)
+(+
+125
+-37)
+(+
+54 920)
+(+
+748
+452)
+(+
+649 93.13)
+(+
+168
+146)
+
+(-
+984 (* (+ (+ 12.5 334) 899 115) (* (* 726 19.8) (/
+93.40 820 636 -30) (* 758 855)) (+ (/ 538 928 -96)
+851 (- 59.78 32.48))))
+(+
+86.65 820)
+
+(+
+924
+926)
+(/ -22 (* (+ 741 (* 346
+356 29.71) 131 467) 227) (* (+ (+ 86.92 892 52.10) 572) (/ (* 84.37 890) (* 265 98.4) 129) (- (+ 701 23.30 532 70.57) (- 50.62 -27 200 76.88) (- 6 753 54.26)) (/ (- 147 41.30 401 12.31) 16.5 (* 86.85
+379 408
+160))))
+(+
+41.59
+520)
+(+ (+ (*
+(+ 71.20 814) -68) (/ 336 2.25 444) (* (* 64 956 842 560) 785 (- 52 882)))
+876 641 11.13)
+(/ (/ (* (/ 662 29.35) 755 (- 131 22.79 542 202) (* 25.90 -72 585)) 948 (/ (* 17.81 633) (* 34 123))) 173 (- -34 (+ (- -54 36 8.23)
+96.68)))
+(* 41.46
+(-
+30.48
+84.19) 345 192)
+(+ 496
+(- (/ (/ 85.3 454 4.84) 15
+(- 595 831 239) (+ 640 33.95 983)) (+ 580 (/ 893 15.3 372 584) 740) 371))
+(* (/ (* (/ 97.81 668 316) 104 402 282) (- (* 988 627) (+
+921 645 94.42 26.64) (- 455 67.85 18.29) (+ -77 5.85 86.82 6.79))) 355 (* (* (/ 264 849 18.28 292) 10.40) (+
+(* -89 176) 31.26)))
+(+
+115 2.38)
+(+
+813 175)
+(/ (+ 7.96 (* 237 (/ 80.11 375 144 1.15) (+ 94.74 207 859 661)) (/ 312 (* -85 23.37 77.54) (- 58.99 461) (+ 17.19 3.22))) (+ (/ (* 456 406 936) (/ 883 261) 28.71 477) 51.23) (* (/ (+ 281 63.7 363 34.32) (* 666 41.70)) 594 31.36 (* 534 (/ 17.32 682 904))) (+ (+ 36.56 (* 22.64 77.16 356 -86) 828) (- (+ 99 13.14 729 49.82) 941 (+ 1.77 74.39)) 746 (*
+233
+(* 73.86 749 441 457))))
+(+ (+ (+ (* 751 77.79
+739) (* 464
+758 895) 882) 20) 23.28 753)
+(+ 872
+830)
+(/ (* (- (* 78.88 35.68 354) (+ 88.33 455 95 989)) (+ (* 384 245 75.23) 78.14 (+ 807 64.91 4) 873)) (* (+ -16 (* 739 62.38 60 642)) 63 (* (/ 671 674) 93.74 688))
+(+ (+ 39.72 836 (+ -40 -38 81.34)) (/ 73
+958 (- 773 735))))
+
+(+ (/ (+ (+ 312 84.72 27.68 74.47) (- 128 906)) (- (+ 81.1 49.60) (-
+-36 86.57
+327)) 871) (+
+(+ 99.38 92.49 420 (+ 674 609)) -40))
+
+(+
+-54 417)
+(+
+(*
+581 17) 541)
+(* (* (* 203 553 (+ 827 -19 386 43.24)) 17.82 60.87) 715 (- (* (* 14 293) 916 1.73) 93.19
+(- (* 334 769) 33 -77 (/ 901 910 512)) 0.49))
+(+ (* (+ 85.25 49.82 (+ 452 987) (+
+22.85 657)) (- 981
+249 10 786) -26 (/ 546 713 481
+(/ 534 60.23 593 922))) 95)
+(/ (* (/ 640 (- 46.86 70.11 307 152)) (- (+ 38.57 296 20.89 703) (* 537 17.30 818 953) (/ 10.75 481 784 42.25) (/
+655 14.68))) 279)
+(+ 20.63
+63.51)
+(+ (/ (+ (- 13 895 790 265) (/ 813 91) -10 91.40) (+ (* 250 68.72 168 10.46) 136 (- 459 -79)) (+ (/ 44.2 55.46 460) (+ 167 12.22 17) (* 21.52 836 217) (-
+860 -42 66.44 928)) 29.65) 51.7)
+(+
+89.60
+94.56)
+(+
+515
+26.4)
+(* 69.5 (/
+(+ (/ 51.24 293)
+91.77) 849) 582)
+(+ 458
+78.19)
+
+(+ (/ (- (* 966 756) 93 (+ 28.64 -75) (* 63 19.82)) 582 (+ 40 437 (- 816 -27 81)) (- (+ 587
+51.28 -54) 774 96.53)) (/ (/ (* 788 53.8) (* 17.90 66.6 42.83 45.96) 266 -94) 418 (* 673 31 (+ 542 465 583 890))) (+ -35 (* (- -31 899 31.29) (* 651 950 894 652) (* 86.23 -68)) (* (* 409 40.51) 103)) (- 825 0.18 (/ 746 (* 373 980 938 800) 7.1)))
+(* 44.27 (* (*
+17.91 69.30 943) (* 380
+(/ 944 483 909) (/ 542 848 625 80.10))
+(+ (+ 938 40) 43.46)))
+(+
+31.17
+90.85)
+(+
+157
+347)
+
+(+ 44.9 (+ (- 49.24 (- 860 17 -15 10) 137) (* 2.44 (/ 487 86)) (+ (* 979 31.98 44.3) (/ 17 951 318
+22.94) (* 844 208 29.28) 964) (+ (- 848 257 35.91)
+14.84)) (- (* (+ 185 567 53.14 467) (* 1000 299) 47.37 0.40) 42.85) 239)
+(+
+98.65
+43)
+(- (* (* 67.27 (* 43.90 742 39.92 400) (- 209 20.54)) (* 660 (* 58.54 570 34.37 38.49) (+ 213 669))) (* 953 423 (- (/ 300 -71
+337) (* 908 133 506) (- 415 420 91.2))) 13.67 67.56)
+(/ (- 772 (- (+ -75 21.26 957 -43) 498 92.98)) (+ (- (- 720
+51.74 -76)
+(* 133 50.74 181) 25.82) 24.51 334))
+(+ (/ (- 809 (* 394 259) 594 565)
+(* 87.25 425)) 86.74 (/ -12 887 35.10) 90.76)
+(+
+256
+456)
+(+
+606
+397)
+(-
+368 544 963
+662)
+(+
+2.89 59.93)
+(+ 722
+37.29)
+(* 813 (/ (/ (+ 137 665) (+ 418 665
+847 -71)) 632) 185 (/ (+ 103 81.35 (* 11.2 987 -85)) (+ 672 (- 394 994 -72 -82)) 386 167))
+(- 370 (- 191 (/ (- 35 34.63 54.75
+-43) 510) (* 880 74.58
+996))
+-71 217)
+(+ 91.66 (-
+887 151)
+965
+667)
+(+
+21.58 425)
+(+
+20 970)
+(/
+(-
+39.75
+59.65 992 819) (- 61.39 (* (+ 371 585 -21) (* 742 900 406) (+ 909 8.16 869 53.62) (* 911 18.45))))
+
+(* 676 (* (+ (/ 815 5.13 54.18) 662
+996) (+ (* -19 299 0.49 503) (* 73 325 55.31 52.17)))
+(/ (- (- 8.95 469 322 442) 43) 518 511))
+(+ 399
+73.85)
+(+
+-81
+0.38)
+(+ 596 (+ (/ 274 (+
+715 19 76.4 95.77)) (+ (/ -53 49.35 876 667) 50.35 (+ 105 717)) (- 645 428)))
+(+ 91 (/ 39.43 178 (/ (+ 378 103) (/
+99.70 810 982 780) (+ 75.65 186 17.95) (/ -80 128 77.62)) 497) (/
+(- 310 68.18) 15.41 72.35))
+(+
+145
+89.5)
+(- 873
+(/ 96.31 (* 610 (+ 26.48 679) 155)))
+(+
+55.27
+157)
+(- (* (- -88 564 0.95 (/ 5.2 297)) 92.34 321 66) 420 43.89
+464)
+(+ 924
+0.71)
+(/ (* 507 (+ 21.0 661) (/ (* 73.20 669 797) (* 28.35 62.33) (/ 55.87 92.95))) (- (- 85.27 87.65 562 53.24) 855) (+ (* (/ 82.58 93.74 865
+930) 177 (/ 133 779) (/ 3.50 -5 47.99 175)) 866 65.65 9.25))
+
+(* 632
+(/ 7.47 (- 9 1.92) (- 103 298 (- 909 351))))
+
+(+ 931 (+
+491 341 9.59 241) (-
+879 (- (+ 351 517) (+ 62.97 31 40.23) 7.85)) 29.86)
+(+ (/ 853 (* 56
+951 (- 652 87.29 56.39)) 21.36) 31.16 720 (+ (*
+(+ 116 728)
+(- 67.37 45.32)) 83))
+(-
+220
+501
+957)
+(+
+82.14 515)
+(*
+89.0
+347
+33.30)
+(+ 127
+449)
+(+
+-8
+799)
+
+(/ (* 252
+469 60) (- 2.64 716 (* (/ 887 86.46 484 175) (+ 12.92 57 102) (- 24 -4 24))) (- (* (*
+561 51.96 86.44) (- 370 31.27 70 65) 444) 917 189))
+(*
+-28 340)
+(- (- 747 888 (- (/ 225 429 961)
+(+ 569 833 468))) (* (+ (- 956 641 912 198) -31) (+ (/ 6.44 -100
+648) (/ 72.53 132 55.75 22.20) 74.17 (/ 272 877 851))) (+ (* (+ 98.99 997 588) 540) (* (+ 851 -24 36 757) 684) (- 95 689)))
+(+
+668 25.40)
+(+
+20.19 38.68)
+(+
+103
+417)
+(/ (+ 365 449 (+ (- 999 526 272)
+(+ 644 424 535 19.83)) -99) (- (/ (- 48.69 52 172) (+ 51.73 148 87.18 860)) (- 43.98 26.23 (/ 859 486) (/ 87.43 115 19.23 989)) 730 149) (- (- 160 (* 267 75.11 432) (- 875 741 52.83) 31.52)
+(+
+(/ 741 81.27 860 209) (/ 571 188 358 683))) 798)
+(+
+15.27
+792)
+(- 50.39 (/ (+ 31.41 (+ 340
+179)) 604) (+ (- 918
+(/ 518 49.69 183 188) (+ -90 93.11) 296) (+ 37
+985)))
+(+
+444
+922)
+
+(+
+-98
+70.50)
+(+
+-100
+3)
+(/ (/ (* (- -24 846) (* 646 351 188 82.30)) 291 9.90) (- (- 689 (+ 470 71.86 -7) (- 55.29 642)) (+ (/ 298 63.75) 69.24 628
+(- 872 37.27))) (-
+(- 151 -69 (* 325 79.74 439)) 552 588 (/ (* -1 -41) (* -51 38.6 220 49.48) (* 43.96 253 96.52 687)))
+56)
+(+
+75.2
+27.54)
+
+(+
+724
+983)
+(/ 24.38 (* (/ (* 204 79.22
+46.83) 872) (* (+ 39.77 91.29 84.17) (/ 557 974 837 133) (- 50 214
+64.26 793)
+(+ 922 931 944))))
+(/ 61 10.86 (+ 938 354 (- (* 736 65)
+(* 32.1 17.2) (* 834
+934 690)) (/ 678 (+ 427 457 520))))
+(+
+34.32
+491)
+(+ 896
+620)
+(- (- 911 4.28 (- (-
+953 61.46 122
+671) (+ 197 395) 694) 663) 361 280)
+(+
+913
+41.38)
+(+ (+ (/ (/ 11.5 13.65 28) 1.97 (- 845 93.51 82.27) (+
+4 26.74 910)) (/ (* 571 56.28
+758 32.0) (* 417 -52))) (- 557 606 537) (* 92.71 (* (/ 71.35 66.58 864) (- 819 319 -43)) (+ 83 (* 85.68 649 888))))
+(+ 762
+94.87)
+
+(* 530 (* 26.25 (- (+ 892 664) (- 469 531 -37) (- 904 159) (/ 80 40
+105 279)) (/ 46.58 (+ 263 122 46))))
+(/ 166 567
+80.89 26.77)
+(* (/ 907 (* 96.13 (/ 328 78.39 686 209)
+(/ 435 104
+350)) 369 23.88) (* (* 201 (* 326 556 218) 22.1 (/ 388 817 294 689)) (+ 91 (- 98.35 395 914)) (+ 19.30 387 547) 268))
+(+
+58.1 278)
+
+(/
+-44 (* 18.73 22.82
+281 (* 269 76.35 (+ 18.70 187))) (- 941 32.30 39) 496)
+(+
+91.64
+760)
+(+
+6.86
+544)
+(+
+962
+318)
+(/ (- (/ 206 (- 743 440)) (/ 932 56.19 (+ 14.25 838) 227) (- -86 (/ 91.68 667)) (/ 91.25 (* 144 298 27.11) 170 33.19)) (- 544 (- (+ 0 825 43.82) (* 536 77.61 185) (/ 93.92 705)) 143 759) (- (/ 1 (/ 793 595 539) (/ 965 35) (* 262 193 76.88 75.38)) -30 (/ (* 366 699 940) 84.92 (- 73.81 25 66)) (/ (- 314 372)
+909 92.8 (- 37 833 263))))
+(*
+63.78 73.98
+10.5
+-47)
+(/ (* (/ 424 40.79 (* 84 784 943) (/ 819 349 686 243)) (/ (/
+406 -58 917) 437 891 886) (+ 8.29 (- 459 902 248) 973 (/ 66.63 466 287)) 315) 907)
+(+
+275
+88.29 908 23.82)
+(+ 640 (+ 994 28
+-31))
+(* (+ 17 628) 949 (- (- (/ 64 850) (- 388 273)) (/ -24 (/ 93.70 -80
+362 338)) 60.67) (- 9.80
+337))
+(* 903 8.1 (+ (* (+ 595
+169) 677 (/ 59.81 177 72.4)) (- 10 694 44) (/ 781 333
+(* 380 758 989))))
+(+
+83.82 58.47)
+(* (+ 36.91 (/ (/ 336 758 521) 30 (* 598 609
+322) (+ 90.93 7.35 899 537))) -13 310
+881)
+(+
+15.64
+33.17)
+(+
+32.25
+350)
+(* 726 875 (- (- 3.5
+(*
+47.7 347 117) (- 293 -52)) 43.35 618))
+(+
+696 40.91)
+(+ 982
+882)
+(+ 558
+836)
+(+ (/ 340 904 37.46 223) 637 (- (/ 452 (/ 98.98 31.57 833 350)) (* (+ 99.75 990 416 828)
+(/ 123 919 97.89 348))) (- 964 106 (+ (+ 93.55 271 904) 52 (* 19.74 829 99.51 65.7)) 85.15))
+(- 739
+(+ 414 944 525 561)
+593 165)
+(+
+62
+65.18)
+(- (* (+ 142 332) 86.51 (+ (* 871 785 -91 552) (* 441 161))) (+ 297 (- 171 437 87.53 (- 75.87 17.51 960)) 136
+94))
+(+
+64.61
+19.56)
+(+
+551
+933)
+(+
+78.72
+286)
+(/ 834 (*
+56.64
+90.39))
+(+ 755
+85)
+
+(+
+48.32
+6.80)
+
+(+
+835
+440)
+(/ (* (+ 943 (/ 120 177 512 24.65)
+(- 869 563) (+ 11.8 9.73 71.26 425)) 67.79) 864)
+(* (+ (/ 982 13.81 -56)
+714 221 730) (- 665 16.79 603 (+ 76.16
+(- 92.79 74 455))) 65.94)
+
+(+
+21.45
+61.37)
+(+ 260
+39.42)
+(* 351
+43.30 446)
+(+
+73.0
+492)
+(* (/ -54 70.98 317) (+ (/ 915 148) 926) (/ 97.44 (+ (* 63.33 67.99 547 -31) (- 68 282
+50.86) (+ 437 -98
+676 66.49) 39.80)
+(- 547 (/ 486 15.36 65.12))))
+(+
+474
+52.60)
+(- (/ (* (/ 616 906 51.73) 16.75) (* (+ 959 380 923 593) -59)) (- 399 12.98)
+(* (- 517
+370 (* 333 252) 560) (- (*
+80 546 55.53 10.36) 120 86.45) 129 83.32) (+ (* (/ 340 676) 460) 878 90.82 (/ (/ 433 194) 970 (/ 20 -68) (- 888 785))))
+(+ 287
+811)
+(+ -6
+426)
+(+
+-49
+2.60)
+(+ 936
+798)
+(/ (/
+63.10 144) (/ 446 234 999) (- (- (* 792 217 84) 52.25 927) 108) -28)
+(- (+ 89 (+ (+ 470 -93) 283 (/ 79.60 24.22)) (+ (+ 602 600 725)
+(- 58.93
+566) (* 293 -76))
+18.77) 212)
+(+
+43.40
+77.18)
+(+
+568
+31.44)
+(- 566 (- (+ (* 312 779 11.81) (+ 133 705
+696 86.25)) 841 483 75))
+(+ 0.35 95 (- 8 93
+34.79) 71.74)
+(+
+785
+908)
+(+
+100
+79.83)
+(+
+12.74
+561)
+(/ 94.69 (- 914 2.50 (* 97.36 (*
+15.7
+75.25 17.91) 655)) 816)
+(* (- (+ 581 944 7.35) 828
+(* (- 664 301 6.69) (/ -37 153 71.9) (+ 447 454 593) (/ 849 631
+294))) 264 953 18)
+(+
+253
+68.1)
+
+(+
+57.26
+801)
+(- (+ 522
+(- -3
+574 (- 844 177)) 63.43 938) 66.5)
+
+(- (- 488 956) (* 846 (/ (- 12.35 638) (* 177 87.80) 265
+85.19)) (+
+22.62 75.67))
+(+ 199
+-12)
+(- (/ (/ (+ 19.34 433 46.64) 457 (/
+269 248 76.8 416)) 24.70 (/ (/ 530 -74 539) (* 265 27.29 415))) (+ 0.31 70 (/ 583 (/ 967 786 476 -6)) (+ (- 26.11 674 867 313) (- 66.24 930 40.48 476) 935)))
+(+
+52
+-95)
+(+
+950 642)
+(+
+(* (- (+ 309 69.22) 362) 990 (/ 128
+(+ 62.37 795) (/ 263 27.88 169) (+ 416 4.36 636 676))) (/ -41 70) (* 198 (* 95.47 (* 33.93 816 72.17) (* 18.47 436 630) (- 41.45 854)) 94.21)
+501)
+(+
+920
+407)
+(+
+79
+651)
+(+
+759
+303)
+(/
+-90 (-
+535
+100 (/ 8.34 (/ 179 510))))
+(+ (* (* (/ 402 83.9 889 481) (/ 71.40 473)
+-44 46.75) (+ (+ 82 657
+912) (* 7.58 499 99) 82.1 484)) 344
+(* 899 415 (- (+ 447 12.68 588 60.1) 930)) (- (- 771 129 (* 758 63.59 -97)) (/ 577 (/ 79.70 783 1000) 6.60) 157))
+
+(+ 164
+205)
+(+
+69.70
+184)
+(+
+765
+-46)
+(+ 80.3
+504)
+(+
+548
+86.80)
+(-
+(-
+(/ 779 57.15
+(/ -14 339 29.3) (* 570 596)) (+ 456 (/ 84.39 92.96 827) 60.2)) (/ 92.56 -18 (* 374 581 (+ 81.39 53.89 691 252)) 299))
+(+
+668
+73)
+(+
+38.64
+288)
+(+
+96.88
+429)
+(+
+23
+39.19)
+(/ (+ 281 (- 66.53 (* 605 96.39) (+ 706 31.62 21.71 86)) (/ (/ 96 -5) (- 43.41 90.27 968)) (+ 10.58 38.29 (+ -2 27) 340)) 12.34
+(* -5 79.24))
+(*
+882
+297)
+(/
+631
+176 180)
+(+
+-77
+41.33)
+(+
+93.95
+866)
+
+(/ 48.89 (+ (+
+(* 280 716 587 24)
+604 33) 59 (/
+73 75.94 (+ 667 246 971))))
+(+
+72.71
+545)
+
+(+
+-6
+751)
+(/ 50.49 723 (+ 42.28 (/ -99 779) (- (+ 859 42.1)
+-90 (/ 921 488 352)))
+(+ 53.36 (+ 94.34 172 76.31 92.49) (/ (* 254 47)
+(+ 592 75.87 -87 996) (+ -31 4.6))))
+(+
+43.43
+686)
+(+
+980
+536)
+(- (- 255 100) (/ (+ 66.22 216 -44) (- (- 49.38 400 348 227) (/ -62
+0.59 89.57
+-94) (/ 15.57 894)) (+ (/ 9.74 747) 217 (/ 804 720
+430 252))) 38.32 44.53)
+
+(/ (+ 852 (- 359 (/ 66.38 19 958) 513
+-36)) (- 222 (* 204 (- 316 556 282 482))
+892 (- -26 (- 68.1 976) 47.26)) 821)
+
+(- (* 52.92 478) (/ (/ 429
+458) 787
+98.60 (- (/ 94.20 288 46.73 729) (* 188 703 799 490))) (+ (+ 494 (+ 685 886 146)) (/ 824
+(/ 784 114 291 826) 297) 58 (- (* 69.82 664 894 65.97) 16.56)) (* (/ 425 (/ 243 641 71.36 540)) 646))
+
+(*
+57.12
+72.35)
+(-
+-79 631)
+(* (/ (- (- 366
+70) 751 (- 561 83.14 499 628)) 248 (- (- 616 583 47.45)
+829 (- 695 68.85) 449)
+(/ 156 (- 82.55 657 763 0) (* 803 39.22) (* 929 155))) 880 (+ (/ 911 (+ 765 465 845)) 67.12 84.13))
+(+ (+ (/ 698 (+ 587 637 586) (+ 89.50 71.87 729) (/ 79.59 773)) (/ 309 (/ 462 292 18.50 131) (+ 14.25 584))) 291 (* 736 571 34 (* (+ 249 4.25 -54) (* 334 395 5) (* 219
+634) 521)) (- (+ (* 9.69 472 84 460) 170) (* (/ 393
+888 6 709) 70.92 797 (* 46.32 566)) 770))
+(+
+91.98 990)
+
+(+
+653
+58)
+(+
+68.30
+66.68)
+(+ 580
+(* 445 (*
+767 (/ 201 59.33)) 718) (+ 233 (* (* 16.36 629 83.28) 733 (- 48.99 -19)) (+ (/ 581
+83.1 563) (+ 534 888)) 520))
+(- 249 (- 479
+(+ 439 (/ 39.26 94 683))) -48 373)
+(/ (/ (- (- 867 60.82) 367) (- (+ 222 552 619) 113)) (- (+ (+ 446
+75.15 24.89) (- 834 124 351) (- 33.78 792) (/ 266 619 34)) (- 374
+(+ 216
+932 319))) -82 488)
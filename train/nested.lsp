@@ -0,0 +1,200 @@
+(- 63.22 (- 509 (* 448 (- 47 (+ 80 (* 319 (- 384 (+ 708 (+ 803 (* 510 -22))))))))))
+(* 77.43 (* 721 (+ 26 (- 698 (+ 141 (+ 58 (* 812 (- 13 (* 926 (+ 94.83 (* 300 (- 404 (- 227 (* 234 (- 703 (* 25 (* 958 (- -25 (* 23.88 (- 686 (- 96 (* 274 (* 84.16 (- 114 (+ 700 (- 864 (* 220 (+ 997 (* 63.61 (+ 38 (- 666 (+ 623 (* 868 (* 646 (* 220 (+ 654 (* 561 (- -48 (* 85.19 (+ 263 (- 382 (* 798 919))))))))))))))))))))))))))))))))))))))))))
+(* 297 (* 739 (* 220 (* 534 (- 744 (* 557 (+ 209 (- -80 (+ 623 (- 977 (- 69.61 535)))))))))))
+(* 593 (- 1.40 (- 0.71 (- 761 (* 432 (* 62 (- 988 (- 774 (* 49.81 (* 576 (+ 379 (* 806 (* 736 (+ 61.73 (+ 88.55 (+ 52 (* 27.62 (* 921 (+ 541 (+ 237 (+ -83 (* -93 (* 753 (+ 774 (+ 452 (* 896 (* 739 (* 68.96 (- 135 (- 799 (* 374 (* 319 (- 982 (- 822 (* 609 (- 827 (+ 996 (* 440 (- 699 (+ 397 (- 594 (* 876 (* 798 (- 18.28 (- 832 (* 48 (- 70.96 (- 860 (* 352 (+ -18 (- 22 (* 554 (* 132 (* 559 (- -34 (* 37 (- 520 494)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 861 (+ 285 (- 13 (* 314 (* 298 (- 867 (* -59 (- 220 (- 90.15 (- -100 (- 901 (- 863 (- 199 (- 289 (* 770 (+ 60.58 (+ 955 (- 795 (* 923 (- 921 (- 586 (+ 13 (- 468 (* 808 (- 51.20 (- -45 (- 56.78 (+ 202 (* 818 (- 37.49 (+ 79.38 619)))))))))))))))))))))))))))))))
+(* 58.56 (* 805 (+ 546 (- 75.70 (* 936 (- -86 (* 545 (+ -96 (* 50.43 (- 190 (* 659 (+ -51 (* 24.5 (* 818 (+ 16.68 (+ 396 (- -43 (+ 966 (* 218 (+ 249 (* 60.13 (* 772 (- 4.67 (* -32 (* 927 (+ 770 (- 767 (* 68.50 (* 747 (+ 872 (* 616 (- 398 569))))))))))))))))))))))))))))))))
+(+ 552 (- 805 (* 167 (* 501 (+ 88.95 (- 928 (- 80.69 (* 982 (* 43.62 (- 636 (* -5 (- 36.14 (+ 75 (* 59.94 (* 139 (* 971 (- 98.87 (+ 81.46 (- 794 (+ 482 (+ 802 (- -8 (+ 39.42 -31)))))))))))))))))))))))
+(- 166 (- 731 (- -24 (- 530 (- 795 (- 936 (+ 361 (- 345 (* 186 (+ 566 (- 99 (* 93.28 (+ 507 (- 433 (* 733 (* -28 (+ 432 (* -63 (* 754 (* 547 (+ 671 (+ 4 (- 817 (+ 1.75 (- 715 (* 110 (+ 370 (- 677 (- 23.70 (+ 107 (* 434 (* 214 (* 128 (+ 348 (* 56.51 (- 708 (+ 231 (- 920 (- 532 (* -24 (- 72.82 (- 824 (+ 374 (- 589 (* 54.4 (* 10.33 417))))))))))))))))))))))))))))))))))))))))))))))
+(+ 581 (+ 437 (+ 780 (* 606 (- 193 (- 748 (- 655 (* 86.73 (+ 848 (- 76.64 (* 176 (+ 293 (* 703 (* 539 (+ 753 (+ 895 (* 147 (* 453 (+ 791 (- 45.24 (* 45.43 (* 25.18 (* 80 (+ 151 (- 48 (+ 620 (* 641 (+ 594 (+ 930 (- 35.82 (- -73 (* 9.19 (* 39.4 277)))))))))))))))))))))))))))))))))
+(- 984 (+ 408 (+ 224 (* 216 (* 57.92 (* 789 (- 937 (- 499 (* 814 (- 502 (- 492 (* 297 (+ 901 (* 913 (+ 725 (* -91 (- 728 (- 799 (- 282 (+ 50.15 (- 322 (+ -70 (* -16 (+ 993 (+ 13.83 (* 96 (- 50.51 (* -77 (+ 176 (- 15.76 (+ 648 (+ 45.35 (- 891 (- 636 (* 77 (* 72 (+ 773 (+ 275 (+ 623 (+ -23 (+ 257 (+ 912 (- 169 (+ 589 (+ 199 (* 103 (+ 751 7.67)))))))))))))))))))))))))))))))))))))))))))))))
+(+ 61.78 (- -64 (* 78.67 (+ 78.61 (- 765 (- 666 (+ 339 (* 701 (- 235 (+ 806 (+ 301 (+ 828 (+ 304 (- 79.1 (- 217 (+ 598 (- 262 (* 887 (+ 482 (* 568 (- 971 (- 984 (- 29.21 991)))))))))))))))))))))))
+(* 212 (- 324 (+ 58.85 (- 98.41 (* 37.75 (- 409 (- 505 (* 653 (* 74 (- 537 (* 830 (- 60.80 255))))))))))))
+(* 343 (* 971 (+ 617 (* 648 (- 43.69 (+ 639 (+ 94.63 (- -36 (- 285 (+ 196 (+ 59 (+ 924 (+ 329 (+ 96.47 (- 761 (* 6.10 (* 85 (- 327 (* 55.21 (+ 684 (+ 324 (+ 465 (+ 716 (+ 676 (+ 219 (+ 8.60 (+ 147 (- 504 (* 412 (+ 125 (- 641 (+ -77 (+ 581 (* 376 (- 754 (+ 655 (+ 785 (+ 440 (+ -43 (+ 979 (* 100 (+ 568 (- 245 (* 295 (* 801 (* 516 (- 60.10 (* 209 (+ 910 (- 612 (+ 149 (* 970 973))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 93.70 (+ 13.40 (+ 33.20 (- 221 (* 925 (* 525 (* 52 (- 808 (+ 862 (- -99 (- 557 (* 550 (- 45.60 (- 293 (* 15.83 (+ 725 (+ 692 (+ -25 (+ 16.57 (+ 85 (- 79 (* 31.40 (* 632 (* -38 (+ 549 (* 716 (- 56.70 (+ 53 (+ 473 (+ 253 (* 42 (+ 868 (* 710 (* 96.67 (+ 7.82 (* 501 (+ 62 (* 435 (* 66.76 (* 89.43 (- 35.88 (* 200 (+ 914 426)))))))))))))))))))))))))))))))))))))))))))
+(+ 378 (+ 453 (- -81 (* 41.82 (* 88.27 (* 113 (+ 495 (- 395 (- 87.1 (* -7 (- 777 (- 557 (* 9 (+ 979 (+ 461 (+ 560 (- 469 (- 527 (* 447 (- 860 (+ 878 (+ 54.64 (* 46.30 (+ 890 (* 0.72 -63)))))))))))))))))))))))))
+(- 41.79 (* 816 (* 634 (+ 570 (- 625 (+ 889 (- 8.67 (* 213 (* 1 (* 252 772))))))))))
+(+ 44.34 (+ 680 (+ 950 (- -47 (- 10 (* 312 (+ 207 (- 842 (- 185 (- 20.26 (+ 279 (* 920 (+ 338 (- 778 (+ 843 (- 33.11 (+ 257 (* 912 (+ 40.83 (* 903 (* 12.86 (* -76 (- -29 (* 885 (* 83.65 (* 90.78 (* 6.84 (* 178 (- 575 (+ -96 (- 906 (* 358 (* 273 (* 613 (* 66.92 (- 87.9 (+ 74 (+ 108 (- 50 (+ 3 (+ 42.24 (* -10 (+ 729 (- 975 (* 112 17.93)))))))))))))))))))))))))))))))))))))))))))))
+(+ 248 (+ 410 (- 871 (+ 523 (+ 114 (+ 978 (* 800 (- 247 (+ 128 (* 280 (+ 10 (- 76.26 (* 13.79 819)))))))))))))
+(- 404 (- 56.81 (* 796 (- 152 (+ 327 (* 32.73 (* 527 (* -37 (* -69 (+ 376 (* 939 (- 26.33 (- 154 (- 71.22 (- 375 (- 18 (+ 995 (* 239 (* 625 (+ 660 (* 105 (* 380 (+ 813 (+ 752 (- 24 (- 722 (+ 377 (+ 8.91 (* 113 (- 351 (+ 903 (+ 289 (* 371 (* 58 (* 27.62 (- 332 (+ 180 (+ 487 (* -8 (* 12.50 (+ 819 (- 511 (* 879 (+ 41.7 (* 175 (- -51 (* 348 (* 803 (- 164 (+ 225 (- 607 (* -54 (+ 557 (+ 1000 (+ 748 (- 438 (* 568 (- 62 815))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* -32 (* 640 (+ 657 (- 759 (* 474 (+ 256 (+ 50.82 (* 397 (+ -51 (+ 427 (- 4.44 (- 6 (* -61 (- 32.34 (* 963 (* 6.1 (+ -24 (+ 744 (* 415 (- 982 (+ 996 618)))))))))))))))))))))
+(* 477 (- 190 (* 175 (* 23 (+ 986 (+ 578 (- 64.14 (+ 118 (* 663 (+ 140 (* -54 (* 592 (+ 44 (* 786 (- 891 693)))))))))))))))
+(+ 368 (+ 149 (- 866 (+ 39.48 (+ 420 (* 758 (* 934 (- 268 (* 72 (- 279 (- 37 (+ 395 (* 456 (- 471 (* 221 (- 564 (- 34.38 526)))))))))))))))))
+(+ 533 (* 422 (* 216 (- 930 (* 876 (+ 877 421))))))
+(- 321 (* 558 (+ 203 (* 12.68 (* 16.68 (- 804 (* 785 (* 719 (+ 67 (- 24.46 (+ 418 (+ 331 (+ 916 (+ 627 (* 816 (* -47 (- 793 (- 751 (* 38.35 (* 885 (+ 627 (* 858 (+ 46.95 (+ 637 (* 424 (- 556 (* 170 (* 343 (* 447 (- 631 (* 869 (* 739 (+ 592 (- 276 (+ 583 (+ 599 (+ 820 (+ 862 (+ 192 (* 569 (- 919 (+ 458 (+ 773 (* 52.54 (- 283 (* 527 (* 484 (+ -6 (+ 715 (+ 358 (* 856 (- 185 (* 760 (* 32 (- 24.87 (* -56 (- 255 (* 605 (+ 77.9 875)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 943 (+ 879 (- 67.8 (+ 530 (- 189 (+ 883 (* 785 (- 259 (* 100 (- 89.48 (- 621 (- 141 (- 515 (* -20 (+ 13.69 (+ 93 (* 631 (- 68 (- 24.29 (- 21 (* 688 (* 419 (+ 494 (+ 325 (- 487 (+ 514 (* 881 (+ 564 (+ -81 (- 57.60 (+ 62 (* 52 (* 5.42 (* 54.56 (- 469 (- 946 (+ 194 (* 844 898))))))))))))))))))))))))))))))))))))))
+(+ 978 (- 62 (+ 793 (* 62.61 (* 685 (- 37.2 (* 238 (- 680 (* 95.36 (+ 895 (+ 65.6 (+ 2.33 (+ -84 (* 41 (+ 473 (+ 408 (* 23.54 (* 104 (* 354 (* 61 (- 328 (+ -38 (+ 946 (* 807 (+ 87 (+ -6 (- 34 (- 463 (- 57.46 (* 923 (+ 13.90 (- 811 (+ 383 (- -10 (+ -89 (+ 492 (- 20.9 (- 223 (+ 434 (+ 751 (+ 680 (* 773 8))))))))))))))))))))))))))))))))))))))))))
+(- 74 (* -16 (* 70 (+ -37 (+ 594 (+ 40.95 (+ 130 (- 732 (+ 209 (* 290 (- 912 (* 754 (+ 425 (- 580 (* 60.44 34.21)))))))))))))))
+(* 434 (+ 439 (- 924 (* 907 (* 116 (- 921 (* 14.38 (- 98 (* 71.2 (+ 576 (* -14 (- 62.94 (- 567 (+ 493 (+ 471 (- 33.98 51.63))))))))))))))))
+(- 68.7 (- -11 (+ 153 (+ 948 (- 262 (* 809 (+ 421 (+ 934 (+ -89 (* 60 (* -10 (* 442 (+ 867 (+ 362 (- 857 (* 114 (- 32.15 (* 560 (+ 63.55 (+ 58.44 (+ 999 (+ 57.60 (- 938 (* 642 (* 984 (- 889 (* 787 (* 89 (- 262 (- 513 (- 430 (+ 81.75 (+ 20.57 (+ 893 (- 765 (* 474 (- 67.86 (- 87.98 (+ 448 (* 700 (- 992 (- 22.85 (+ 729 (+ 27.53 (+ -22 (+ -22 (+ 244 (- 83.50 (- 27 (+ 590 (- 116 (* 56.48 (+ 746 (+ 731 (* 712 294)))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 46.31 (* 285 (+ 203 (+ 465 (* 70.2 (* -63 (- 848 (+ 919 (+ 997 (+ 488 (+ 4 (- 49.41 (- 488 (+ 373 (+ 466 (* 89.40 (- -98 (- 916 (+ 401 (* -90 (* 4 (- 544 (- 396 (+ -70 (+ 984 (- 58.54 (* 285 (+ -3 (* 2 142)))))))))))))))))))))))))))))
+(- 571 (* 887 (+ 940 (+ 268 (* 683 (+ 926 (* 810 (+ 358 (+ 88.17 (- 554 (* 139 (+ 417 (* 56.70 (- 607 (+ 150 (+ 146 (- 79 (- 95.11 (* 2.91 (+ -15 (* 665 (+ 335 (+ 215 (* 197 (* 443 (* 853 (- 208 (- 317 (- 6.46 (* 5.56 (+ 15.26 (* 508 (- 82.40 (- 42 (- 781 (* 288 (* 775 (* 299 (+ 545 (- 473 (* 140 (* 69.74 (* 501 (* 120 880))))))))))))))))))))))))))))))))))))))))))))
+(+ -6 (+ 35.19 (+ 354 (- 390 (+ 691 (+ 564 (+ 214 (* 0.3 (* 791 (* 520 (* 63.83 (+ 228 (* 936 (- 773 (+ -41 (* 894 (+ 976 (+ -12 (- 91 (- 247 (* 3 (- 641 (+ 711 (+ 72.64 (- 747 (+ 980 (- 83.83 (+ 693 (+ 99.51 (- 972 (+ 226 -4)))))))))))))))))))))))))))))))
+(- 656 (+ 445 (* -53 (* 53 (- 174 (+ 106 (- 834 (- 344 (+ 7.67 (+ -92 (- 608 (- 986 (* -9 (* 993 (+ 53.40 (- 837 (- 692 (+ 27.8 (- -40 (* 749 (* 81.77 (- 521 (+ 987 (* -83 333))))))))))))))))))))))))
+(- 82.99 (* 393 (* 53.94 (- -53 (* 64 (* 555 (* 101 (+ 800 (+ 481 (+ 144 (* 694 (+ 464 (- 302 (+ 225 (* -21 (* 878 (* -35 (- -72 (* 721 (* 135 (* 502 (* 184 (+ 894 (- 775 (* 547 (* 515 (+ 764 (* 265 (- 848 (+ 91.53 (* -11 (* 102 (* 432 66.20)))))))))))))))))))))))))))))))))
+(- 377 (- 1000 (- 384 (- 25.68 (- 974 (* 45.82 (* 926 (- 744 (* 23 (+ 663 (* 6 (- 311 (* 62 (- 229 (* 29.80 (* 51.4 (+ 204 (* 484 (* -26 (- 54 (* -26 (- 71 (+ 13.55 (* 561 (* 536 (- 11 (+ 962 (* 166 (- 905 (- 220 (+ 544 (+ 167 (* 937 837)))))))))))))))))))))))))))))))))
+(+ 99.25 (+ 50.47 (* 117 (+ 21 (- 727 (+ 913 (+ 417 (+ 632 (+ 733 (* 58.53 (* 527 (- 187 (* 629 (+ 294 (* 904 (- 62 (+ -70 (+ 621 (+ 1000 (- 635 (- 910 (* 283 (+ 42 (- 561 (+ 984 (- 237 (+ 12.51 (* -59 (- 174 (- 837 (- 488 (+ 197 (- 606 (- 777 (* 478 (- 60.58 (+ 705 (- 884 (+ 944 (+ 505 (+ -80 (* 52 (+ 73.56 (- 255 (- 407 (+ 431 (+ 64.16 (* 614 862))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 268 (* 46 (+ 644 (* 81 (* 982 (- 441 (- 675 (* 201 (+ 443 (* 59.88 (+ -59 (* 343 (+ 390 (- 498 (+ 821 (- 451 (* 867 (+ 152 (+ 50 (- 9.23 (* 211 (+ 946 (+ 437 (* 934 (- 851 (- 6 (* 3.56 (+ -60 (- 166 (* 279 (* 422 (- 314 (+ 827 (+ 98.63 (- 422 (- 885 (- 394 (* 959 (* 573 (+ 290 (- 790 (+ 122 (- 467 (* 86.75 (- 938 (* 214 (- 18.95 (- 53.45 (+ 542 (+ 481 (* 911 (+ 578 (- 319 (+ 813 366))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 511 (* 684 (+ 766 (- 59.48 (* 191 (+ -59 (+ 67.54 (* 630 (- 850 0.44)))))))))
+(- 41.29 (- 9 (- 295 (+ -95 (* 915 (* 326 (+ 857 (- 243 (- 919 (* 688 (+ 65.86 (- 298 95.44))))))))))))
+(- 322 (- -47 (* 294 (- 83.38 (* 448 (+ 669 (- 687 (+ 314 (- 188 (* 52 (* 368 (- 981 (* 56.7 (* 219 (* 15.3 83)))))))))))))))
+(- 167 (+ 115 (* 664 (* 58 (- 724 (- 670 (+ 581 (+ 380 (* 66 (+ 703 (- 828 (* 845 (* 708 (* 294 (- 82.61 (* 71 (+ 787 (- -57 (- 31.6 (- 772 (- 39.89 (* 756 (+ 584 (+ 847 (+ -75 (* 506 (+ -100 (* 43 (- 755 (+ 27 (- 673 (+ 15 (* 6.55 (* 77.6 (+ 841 (+ 20 (* 58.84 (- 861 (* 315 (+ 483 (* 693 (- 59.34 (- 41 (+ 65.28 (+ 903 (- 860 941))))))))))))))))))))))))))))))))))))))))))))))
+(+ 343 (* 725 (- 782 (+ 419 (- 89.29 (+ -27 (- 32 (* 581 (- -68 (+ 298 (+ 210 (- 34 (* 968 (+ 997 (+ 273 (* 730 (* 143 (- 63 (* 14 (- 243 (- 343 (- 72.52 (- 75 (+ 83.78 (+ 949 (- 30.48 (- -47 (* -2 (* 525 (* 22 (* 32 (* 97.28 (- 218 (* 90 (- 48 (- 228 (* 995 -57)))))))))))))))))))))))))))))))))))))
+(- 772 (- 54.66 (+ 496 (* 778 (- 696 (+ 97.59 (- 77.35 (+ 738 (* 3.43 (- 605 (- 86.1 (* 882 (* 560 (- 483 (+ 7.25 (+ 964 (* 44.75 (- 264 (+ 522 (- 758 (* 105 (- 609 (- 270 (* 73.4 (+ 51.29 (+ 174 (+ 895 (- 12 (- 526 (- 64.22 (+ 638 (- 306 (- 272 (+ -92 (+ 82.43 (* 466 (+ 659 (+ 642 (* 408 (+ 319 (* 932 (+ 396 (+ 241 (* 91.28 30.32))))))))))))))))))))))))))))))))))))))))))))
+(+ 26.72 (* 888 (- 567 (* 0.62 (+ 665 (+ 90.33 (- 567 (- 524 (- 37.5 (* 226 (- 648 (- 802 (- 24.93 (- 776 (+ 639 (- 345 (* 7.47 (* 178 (* 25.90 (- 52.58 (* 30 (+ 177 (- -50 (+ 95 (* 808 (* 677 (- 763 (+ 83 (+ 1000 (* 3.88 (* 277 (- 54 (+ 356 (- 699 (* 644 (+ 896 (* 490 (* 80.41 (* 21.19 (+ 320 (* 425 (- 169 (- 691 (+ 16 (* 86.48 (+ 785 (- 314 (- 596 (+ 49.84 308)))))))))))))))))))))))))))))))))))))))))))))))))
+(- 18.9 (* 74.66 (- 526 (- 64.47 (- 116 (+ 290 (- 48.76 (* 750 (+ -30 (- 514 (+ 40.21 (- -97 (- 953 (- -37 (- 0.58 (+ 257 (+ -48 (+ 747 (- 83.42 (- 486 (* 457 (+ 899 (+ 306 (+ 912 (* 335 (- 358 (+ 55 (- 12 (* 508 (- 860 (- 574 (* 435 (+ 15.71 (+ 67.95 (* 240 (- 88.29 (+ 49.45 (- 533 344))))))))))))))))))))))))))))))))))))))
+(+ 118 (+ 67.14 (* -66 (* 31.17 (* 977 (- 62 (- 241 (+ -51 138))))))))
+(* 58.21 (* 72.13 (+ 361 (+ -62 (+ 270 (* 50.81 (+ 69.83 (+ 84.57 (+ 72.83 (- 86 (- 53 (* 693 (+ 383 (* 59.63 (+ 220 (+ 478 (* 91.73 (- 94.26 (- 618 (+ 323 (* 51.90 (+ 566 (+ 73.34 (* 893 (+ 46.85 (+ 592 (+ 157 (+ 807 (+ 75.19 -100)))))))))))))))))))))))))))))
+(* 25.43 (- 759 (* 384 (- 49.28 (- 641 (* 353 (- 40.64 (+ -44 (- 702 (+ 899 (* 91.39 (* 148 (* -89 (+ 423 (- 658 (* 494 (* 488 (- 12.64 (+ -57 (+ -96 (+ 612 (+ -86 (* 129 (* -34 (* 145 (- 230 (* 845 (* -58 (* 701 (- 18.86 (- 481 (+ 783 (* 922 (+ 0.32 (- 64 365)))))))))))))))))))))))))))))))))))
+(- 482 (* 504 (+ 192 (- 860 (+ 796 (* 31 (* 654 (* 71.6 (+ 79.2 (* 616 (* 545 (* 420 (+ 184 (- 745 (- 78.3 (- 226 (* 968 (+ 781 (- -16 (+ 756 (+ 130 (* 54.1 (+ 21.42 (* 314 (- 285 (* 821 (* 23.69 (+ 609 (* 907 -36)))))))))))))))))))))))))))))
+(* 819 (- 98.70 (* 132 (* 26.27 (- 111 (+ 235 (- 624 (* 179 (+ 683 (* 737 (* 849 628)))))))))))
+(+ -3 (- 622 (+ 59 (- 526 (+ 217 (* -69 (- 249 (- -84 (+ 585 (+ 982 (- 560 (- -78 (+ 86.92 (- 590 (- 97.15 (- 983 (+ 280 (- -13 (* 55.62 (+ 360 (+ 979 (* 94.55 (- 722 (- 88.8 (- 151 (- 1.62 (+ -29 (- 893 (* 527 468)))))))))))))))))))))))))))))
+(* 138 (* 831 (* 525 (+ 88.81 (* 663 (* 544 845))))))
+(+ 268 (- 236 (- 242 (* 901 (+ 81.78 (+ -18 (* 557 (- 123 (* 29.39 (+ 57.50 (- 372 (+ 938 (* 75 (- 783 (+ 77 (- 0.20 (- 386 (* 804 (* 340 (* -8 (+ 54 (- 294 (* 44.86 (* 795 (- 747 (+ 94.36 (* 249 (+ 422 (* 368 (- 147 (* 562 (* 755 (* 297 (+ 711 (- 260 (* 869 (- -72 (- 970 (- 298 (+ 70.85 (* 113 (* 787 (+ -4 (- 441 940))))))))))))))))))))))))))))))))))))))))))))
+(- 85.16 (* 723 (- 67.21 (* 26.33 (- 836 (+ 788 (+ 72.24 (- 10.24 (* 210 (- 965 (- 525 (* 29.0 (- 370 (* 65 (* 744 (* 877 (+ 733 (- 316 (+ 872 (- 89.20 (- 111 (- 44.26 (- 647 (- 410 (+ 80 (+ 29 (* 30.31 (- 869 (- -73 (+ 534 (- 866 (+ 413 (- -93 (* 408 (- 61.68 (+ 65.85 (+ 353 (- 573 (- 18 (- 276 (* 958 (+ 613 (+ 401 (* 204 (+ 257 (+ 515 (- 75 (* 226 6))))))))))))))))))))))))))))))))))))))))))))))))
+(- -40 (+ 472 (* 73 (* 58 (+ -99 (* 115 (+ 71.25 (* 70.57 (* 724 (+ 818 (- 771 (- 28.16 (* 734 (+ 285 (- 579 (- 30.52 (- 0 (* 871 (* 52.75 (- 349 (* 399 (- 660 (* 938 (* 601 (* 915 (- 182 (- 594 (- 50 (- 950 (- 37.39 (- 240 (+ 672 (+ 450 (* 273 (* 698 (* 218 (+ 958 (+ 46 (* -94 (+ 741 (+ 497 (+ 940 (- 522 (+ 84 (- 78.70 (+ 668 (* 146 (+ 108 (- 847 (+ 928 (+ 323 (- 16.79 (* 86.60 (* 271 (* 35 (* 646 (* 517 334)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ -78 (- 914 (- -94 (* 590 (* 971 (- 481 (+ 51.0 (+ 677 (+ 36 (- 62 (* -58 (- 37.88 (* 848 (- 945 (+ 371 (- 692 (- 572 (* 641 (* -66 (* 449 (+ 663 (+ 974 (- 80.39 (- 791 (- 2 (- 136 (- 555 (- 490 (+ -60 (+ 356 (* 432 (* 95.49 (+ 393 (* 237 (+ 326 (+ 496 (* 43 (- 25.35 (- 800 (- -38 (+ 601 (* 893 (+ 17 (* 758 (* 979 805)))))))))))))))))))))))))))))))))))))))))))))
+(+ 658 (+ 7 (* 51.62 (* 677 (* 313 (- 16.34 (- 346 (* 53.60 (* 824 (- 170 (+ 526 (* -52 (+ 468 (* 982 (+ 815 (* 147 (+ 692 (* 966 (* 700 (- 963 (* 375 (- 508 (+ 390 (* 484 (- 36.37 (* 281 (* 17.46 (* 208 (* 30 (+ 417 (* 234 (- 12 (* 85 (- 153 (* -86 (+ 244 (- -37 (+ 971 (- 135 (- 662 (- 840 (+ 861 (* 24.73 (- 341 (- 560 (* 825 (- 879 (- 707 (+ 61.99 962)))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 800 (- 980 (* 29.28 (- 993 (+ 305 (+ 739 (+ 956 (* 417 (* 466 (- -38 (* 508 (* 408 (* 589 (* 13.83 (* -1 (- 56 (- 67.78 (+ 939 (+ -52 (- -62 (* 689 (* 81.45 (* 757 (- 10.76 (+ 285 (+ 547 (+ -71 (* 151 (* 569 (- 197 959))))))))))))))))))))))))))))))
+(+ 257 (* 304 (+ 573 (* 536 (+ 70.34 (* 816 (* 71 (* 258 (- 645 (+ 476 (+ 9.68 (* 83.62 (+ 735 (* 334 (* 776 (* 641 (* 30 (+ 26 (+ 474 (- 831 (- 33.38 (- 77.96 (- 944 (- 38.86 (+ 334 (* 436 (+ 780 (+ 991 (- -96 (* 946 (+ 408 937)))))))))))))))))))))))))))))))
+(- 582 (+ 426 (+ 459 (- 94.40 (+ 997 (+ 6 (* 545 (* 619 (+ 51.78 (+ 782 (+ 92.44 (- 800 (+ -98 (+ 68.34 (* 412 (* 161 (- 41.32 (- 74.21 (- 120 (- -3 (* 397 (+ 600 (- 3.4 456)))))))))))))))))))))))
+(- 328 (+ 225 (* 42.87 (* 653 (- 683 (+ 517 (- 687 (* 806 (- 369 (- 492 (+ 74.87 (* 69.64 (- 811 (- 282 (- -70 (- 596 (* 65.31 (- 306 (+ 45 (- 785 (* 970 (* -64 (* 599 (* 40.86 (- 857 (+ 220 (* 68.81 (- 965 (* 9 (- -35 (- 62.43 (- -7 (* -4 (* 326 (- 51.33 (- 913 (+ -16 (+ 423 (* 61.30 (- 61.10 (- -100 (+ 7.96 (+ 900 (+ 47 (- 417 787)))))))))))))))))))))))))))))))))))))))))))))
+(- 703 (* 462 (* 3.62 (- 609 (+ 760 (* 89.90 (+ 117 (- 294 (+ 54 (- 974 85))))))))))
+(+ -5 (+ 908 (* 94.49 (* 448 (+ 673 (+ 203 (- 381 (+ 187 (+ 38.48 (- 475 (* 48.6 (* 58.82 (+ 828 (- 236 (+ 141 (+ 20.77 (+ 426 (* 991 (- 13.83 (+ 606 (* 777 (- 658 (* 821 (- 28.93 (+ 844 (- 472 70))))))))))))))))))))))))))
+(+ 345 (- 889 (- 723 (* 98.5 (- 40.27 (+ 334 (+ 256 (+ -34 (+ 50.98 (* 436 (* 789 (* 83 (* 185 (* 60.18 (- 294 (* 83 (* 258 (* 408 (+ 8 (- -74 (- 955 (- 61 (+ 47.64 (+ 374 (+ 552 (- 851 (* 12.17 (* 51.66 (+ 67.12 (- 751 (* 652 (+ 19.53 (* 824 (+ 57.97 (+ 993 (* 787 (* 529 (+ 381 (* 536 (* 587 (+ 497 (+ 550 (* 677 (- 906 (- 352 (- 665 (+ 690 (+ 229 (- 883 (- 104 (* -66 (- 26 (- 57 (* 99 (- 678 (- 355 (+ 528 (* 209 757))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 81.82 (- 605 (- 370 (+ 934 (* 16.96 (- -65 (* 94.97 (- 92.89 (- 9 295)))))))))
+(- 619 (+ 341 (* 461 (- 411 (* 25 (- 969 409))))))
+(* 89.33 (+ 849 (* 68.62 (- -58 (- 923 (* 81.25 (+ 383 (- 889 (+ 252 (- 113 (* -18 (- 442 (- 673 (+ 321 (+ 23.43 (- 85.98 (- 705 (* -86 (* 805 (- 857 (* 272 (+ 721 (- 135 264)))))))))))))))))))))))
+(* 844 (+ 194 (- 571 (* -41 (- 569 (+ 625 (* 581 (- -11 (* 539 960)))))))))
+(+ 411 (+ 55.5 (* 381 (+ 486 (- 16.32 (* 96.69 (- 1.84 (+ 408 (* 54.89 (* 118 (* 82.98 (- -34 (- 86.99 (* 62 (- 73.64 (- 541 (- -84 (- 58.60 (+ 56.62 (- 41.49 (- 592 (+ -91 (- 57.36 (* 416 67.0))))))))))))))))))))))))
+(+ 96.68 (- 241 (- 724 (* 696 (* 505 (+ 72.31 (* 559 (+ 553 (- 165 (- 21.30 (- 555 (* 52.5 (+ 647 (- 146 (- 947 (+ 31.0 (+ 299 (* 713 (- 228 (- 216 (+ 290 (+ 25 (- 97.54 (- 240 (+ 857 (* 701 (+ 34.8 (* 38 (- 21 (* 99.86 (+ 174 (- 531 (+ 737 (+ 386 (* 699 (+ 898 (- 563 (* 8 (- 99.95 (+ 636 (* 932 (* 204 (- 437 (* 956 (- 55.10 (- 617 (* 899 -63)))))))))))))))))))))))))))))))))))))))))))))))
+(- 52.11 (* 16 (- 509 (+ 571 (- -14 (+ 940 (- 96 (* 439 (- 9.71 (- 869 (- 35.43 (- 890 (* -13 (+ 256 (* 99.66 (* -55 (* -57 (+ -54 (* -58 (+ 919 (* 559 (* 200 (- 163 (* 665 (- -50 (- 449 (* -73 (+ 88.83 (- 99.27 (* 459 (- 79.82 (- 890 (- 17.44 (+ -19 (* 818 (+ 451 (* 46.60 (- 226 (* 892 (* 397 (+ 988 (+ 170 (- -40 (- 86.7 (+ 755 (+ 842 (* 64 (- 33.99 (+ 19.20 40.99)))))))))))))))))))))))))))))))))))))))))))))))))
+(- 605 (* 786 (- 283 (- 674 (* 637 (- 184 (* 563 (* 637 (+ 772 (* 925 (* 720 (* 944 (* 5.6 (+ 45.33 (* 597 (+ 810 (- 179 (- 941 (* -88 (* 537 (* 85.95 (* 301 (* 77.42 (- 8.66 (+ 147 (+ 802 (* 613 (* 234 (+ 111 (- 82.19 (* 85.78 (* 846 (- 66.0 (+ 672 (* 843 (* 296 (* 33.69 (- 964 (* 798 (+ 357 (- 455 (* 320 (- 882 (* 958 (- 935 (* 80.94 (+ 978 (- 840 (* 547 (- 499 (+ 79.53 (- 37 (- -26 (- 557 (+ 174 (* 40.89 (* 186 (- 988 (* 652 (- 804 557))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 92 (- 66.11 (+ 66.30 (* 123 (- 395 (* 528 (+ 30.97 (- 571 (- 313 (+ 957 (+ 270 (* 923 (+ 684 (+ 852 (* 581 (+ 479 (- 52.25 (+ 12 (+ 851 (* -32 (+ 52 (+ -95 (- 694 (+ 460 (+ 750 (+ 95.48 (+ 650 (* 726 914))))))))))))))))))))))))))))
+(+ 93 (* 80 (* 366 (* 95 (* 25.85 (* 649 (+ 538 247)))))))
+(+ 190 (- 583 (* 214 (+ 554 (- 385 (+ 57 (+ -66 (+ 987 (- 46.81 (+ 6.64 (* 47.53 (- 361 (+ 632 (* 659 (- 976 (+ 329 (- 798 (* 697 (- -11 (* 900 (- 314 (- 79.94 (+ 695 (+ 491 (+ 833 (* 58.40 (+ 702 (* 956 (- -21 561)))))))))))))))))))))))))))))
+(* 917 (- 172 (+ 492 (+ 30.2 (+ 31 (- 4.54 (- 106 (- 681 (+ 60 (- 86 (* 201 (+ 215 (- 173 (+ 742 (- 147 (* 98.16 (- 575 (* 33.94 (- 36.30 (+ 88.16 (- 3.12 (+ 67.77 (+ 229 (* 581 (+ 900 (- 29.42 (+ 560 (* 62.52 (+ 963 (* 899 (* 1000 (- 838 (- 341 (* 35.0 (- 82.59 (+ 703 (+ 386 (* 62.24 (+ 584 235)))))))))))))))))))))))))))))))))))))))
+(+ 305 (* 18.37 (* 863 (- 831 (+ 273 (- 929 (+ 55.21 (- 23.20 (- 303 (- 69 (+ 566 (+ 345 (* -43 (* 87.3 (- 496 (+ 96 (* 251 (* 228 (+ 217 (* 694 (* 969 (- 351 (- 613 (+ 220 (- 287 (+ 840 (* 25.43 (- 379 (+ 815 (- 647 (- 78.2 -34)))))))))))))))))))))))))))))))
+(- 596 (- 607 (+ 279 (* 876 (+ 291 (+ 0.71 (* 43 (- 521 (- 706 (- 855 (- 616 (+ 100 (* 651 (- 643 (+ 680 (- 17.58 (- 22.42 (+ 655 (- 441 (- 14.95 (- 96.47 (* 264 (- 46 (+ 735 (* 939 (+ 443 (+ 723 (* 408 (+ 446 (+ 565 (+ 219 (+ 454 (- 187 (* 504 (+ 20 (- 325 (* 19.91 (* 15.5 (- 86.52 (- -39 (- 647 (+ 59 281))))))))))))))))))))))))))))))))))))))))))
+(* 98.51 (* 476 (* 26 (* 680 (* 936 (* 376 (+ -39 (* -19 (- 4.13 (+ 493 (- 661 (* 508 (+ 94.65 (* -60 (+ 42 26)))))))))))))))
+(+ 46 (- 500 (- 3.36 (- -67 (- 492 (+ 75 (+ 58.5 (- 323 (+ 44.47 (+ 646 (- 833 (- 692 (* 55.56 (* 447 (+ 366 (* 580 (* 44.15 (* 837 (* 19.8 (* 695 (+ 42.15 (+ 90.55 (+ 864 (+ 657 (- 14.4 (* 53.41 (+ 921 (+ 612 (+ 89.4 (* 52 (+ 56.18 (* 527 (* 262 -60)))))))))))))))))))))))))))))))))
+(- -30 (- 162 (* 371 (+ 103 (- 74.94 (- 386 (+ 101 (- 20 (+ 934 (+ 92.79 (* 126 (- 89.82 (+ 816 (* 586 (- 426 (- 45.33 (- 90.42 (+ 54.33 (- 31.68 (- 706 (* 28 (+ 8.98 (+ 177 (- 203 (* 94.54 (* 958 (+ 832 (* -77 (* 88.17 (* 930 (- 634 (+ 348 (+ 98 (* 265 (+ 409 (* 693 (- 10.57 (+ 566 (- 17.48 (- 721 87.71))))))))))))))))))))))))))))))))))))))))
+(* 766 (+ -60 (- 390 (- 72.23 (- 877 (* 343 (* 67.53 (+ 323 (+ 609 (+ 728 (- 776 (+ 597 (* 82.3 (- 6.86 (- 27.5 (* 282 (* 90.75 (- 619 (* 504 (* 489 (+ 435 (+ 703 (+ 268 (- -14 (* 140 (- 535 (- 331 (* 439 (- 17.11 (* 91 (+ 791 (* -53 (- -17 (* 63.43 (- 115 (* 625 (- 170 (+ 7 (- 706 (+ 20 (+ 496 (- 637 (* 652 (+ 565 (+ 408 (* 911 (* 179 (* 13.21 (+ -9 (- 63.69 (+ 136 (+ 193 (+ 390 (* 729 (+ -50 (- 901 (- 624 (+ 716 (+ 921 (* 444 -2))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 491 (- 716 (- 82.18 (+ 854 (- 809 (+ -62 (* -23 (+ -61 (- 971 (- 744 (* 191 (+ 549 (* 720 (* 344 (+ 821 (* 29 (- 29.69 (* 740 (+ 522 (* 359 (- 803 (+ -25 26))))))))))))))))))))))
+(* 356 (- 526 (* 342 (+ 346 (- -68 (+ 75.21 (- 600 (+ 504 (* 60 (* 20.14 (* -91 (- 737 (+ 48.54 (* 812 (- 535 (+ 763 (* 347 (- 413 (- -15 (- 503 (- 376 (- 296 (- 306 (- 698 (- 971 (+ 502 (- -11 (+ 728 (* 275 (- 356 (+ 312 (+ 854 (- 113 (- 37.90 (- 957 (* 55 (* 90.97 362)))))))))))))))))))))))))))))))))))))
+(* 44 (+ 205 (- 415 (* 78 (- 916 (- 523 (- 529 (+ -52 (* 531 (+ 172 (+ 628 (- 91.7 (* 815 (* 584 (+ 41.24 (- 685 (- 28.50 (* 696 (+ 418 (* 629 90))))))))))))))))))))
+(* 206 (- 751 (- 35.65 (- 89.33 (- 517 (- 808 (- 57.87 (* 870 (+ 49.8 (* 700 (+ 85.32 (+ 527 (+ 23 (+ 217 (* 946 (+ 575 (- 773 (+ 410 (- 870 (* 572 (* 28.38 (* 479 (* 24.57 (* -87 (+ 234 (* 783 (* 28.85 (* 695 (+ 415 (* 429 (+ 524 (- 944 (- 819 (* 574 (+ 511 (- 271 (- 74.33 (* 32.33 (* 633 (- 311 (- -78 (+ 859 (* 236 (* 30.65 (- 200 (- 623 (- 455 (- 445 (+ 74.79 (- 391 (- 453 (+ 24 (+ 431 (- 517 (- 975 (* -5 (- 720 (+ 422 256))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 853 (+ 57.70 (* 68.10 (* 151 (* 94.62 (+ 870 (+ 980 (- 29 (* 81.27 (+ 140 (* 146 (* 95.86 (- 970 (- 783 (* 705 (+ 55 (- 39.59 (- 271 (+ 729 (- 767 (* 87.58 (+ 807 (+ 962 (- 842 (- 58.68 (* 293 (* 929 (+ -47 (- 97.8 (+ 389 (* 163 (* 96 (+ 544 (- 270 (+ 582 (+ -97 -47))))))))))))))))))))))))))))))))))))
+(* 775 (- 139 (+ 50.38 (* 302 (+ 506 (+ -84 (+ 401 (+ 258 (- 12.20 (* 726 (* 41 (* 633 (- 819 (* 12.89 (* 54.68 (- 657 (- 5.8 (* 343 (* 695 (+ 864 (- 371 (* 381 (* 515 (- 533 (- 139 (+ 297 (+ 818 (+ -45 (* -53 (* 74.37 (+ 187 (+ 22.34 335))))))))))))))))))))))))))))))))
+(- 782 (- 247 (+ 324 (- 143 (+ 2.27 (- 75.78 (- 96.76 (+ 0.99 (- 652 (- 510 (* 61 (* 24 (- 695 (- 30.4 (* -37 (+ 569 (- 453 (* 62 (- 142 (* 392 (* 45.63 (* 13.94 (+ 44.34 (- 166 (- 87.60 (- 120 (- -4 (- 381 (* 903 (- 163 (+ 654 (- 317 (* 72.3 (+ 964 (+ 10.43 (- 752 (+ 497 (+ 645 (- 300 (- 909 (+ 0.74 (* 14.47 (+ -41 (* 604 (* 531 (- -65 515))))))))))))))))))))))))))))))))))))))))))))))
+(* 52.35 (- 576 (* 99 (- 330 (+ -36 (* 822 (- 492 (+ 81.72 (+ 101 (- 65.82 (- 50.98 (* -46 (- 637 (+ 64.42 (- 675 (- -13 (* 287 (- -72 (+ 954 (- 192 (* 564 (* 309 (- -8 (+ 338 (* 69 (+ 70.71 (* 526 (- 26 (* 839 (- 24.32 (+ 614 (- 460 (+ 47 (- 90.90 (* 4.0 (+ 954 (* 123 (- 176 (- 32.64 (+ 92.74 (* 238 (* 409 (- 199 639)))))))))))))))))))))))))))))))))))))))))))
+(+ 107 (+ 812 (+ 7.78 (+ 148 (* 32.13 (* 124 (+ 39.65 (+ 96.90 (+ 602 (+ 742 (+ 49.52 (- 957 (+ 23 (+ 21.90 (+ -54 (+ 681 (* 699 (- 403 (+ 293 (* 103 (* 476 (* 258 (- 62.33 (- 14 (* 949 (- -73 (* 652 (+ 453 (+ 40 (* 713 (+ 812 (* 3.89 278))))))))))))))))))))))))))))))))
+(* 150 (+ 663 (- 44.94 (* 942 (- 72 (* 86 (- 631 (- 653 (+ 424 (+ 187 (+ 25.16 (- 441 (- 251 (- 231 (+ 55 (- 252 (* 117 (- 438 (+ 80.42 (* 127 (+ 46.97 (* 47.29 (+ 183 (* 349 (+ 14.26 (+ 519 (* 36.31 (* 928 (- -44 (* 182 (- 61.60 (+ 159 (* 39.72 (* 868 961))))))))))))))))))))))))))))))))))
+(- 51.85 (- 526 (+ 44.1 (* 493 (- 825 (+ 725 (+ 741 (- 5.56 (+ 478 (* 629 (- 5.12 (+ 61.1 (- 163 (- 357 (+ 183 (+ 75 (* 128 (* 52 (* 865 (* 746 (- 898 (+ 67.91 (- 39 (+ 63.69 (* 74.7 (+ 559 (- 956 (* 51.38 (+ 264 (- 594 (- 484 (- 322 (* 35.59 917)))))))))))))))))))))))))))))))))
+(+ -53 (* 841 (- 63.67 (* 471 (+ 93.62 (* 423 (+ 373 (* 319 (* 6 (* 713 (- 144 (- 733 (+ 903 (- 351 (* 849 (* 797 (- 667 (- 30.88 (+ 109 (- 964 (+ 914 (* 147 (+ 467 (- 620 (* 835 (- 842 (- 24 805)))))))))))))))))))))))))))
+(+ 664 (* -46 (+ 25.13 (* 60.22 (* 122 (- 80.70 (* 160 (* 46.43 (- 232 (* 114 (* 989 (* 219 (- 218 (- 796 (* 95.17 (+ 16.6 (* 53.37 (- 837 (+ 220 (- 87.13 (- 844 (* 52.57 (+ 665 (+ 30.20 (+ 601 (* 299 (+ 93.0 (* -15 (* 695 (- 92.98 (* 964 (* 619 (+ 412 (- 47 (+ -45 (+ 249 (+ 668 (* -31 (* 52.18 (+ 97 (* 59.40 (+ 868 (- 735 (+ 781 (* 454 (- 453 267))))))))))))))))))))))))))))))))))))))))))))))
+(* 487 (+ 87.5 (* 239 (+ 419 (- 580 (- 719 (* 236 714)))))))
+(+ 702 (- 985 (* 929 (- 13.8 (+ 44.22 (- 208 (+ 645 236)))))))
+(+ 586 (+ 973 (+ 395 (- 35.70 (- 412 (* 14.91 (+ 711 (- 565 (- 856 (- 860 (+ 38.85 (* 49.78 (- 538 (* 49 78.54))))))))))))))
+(- 651 (* -9 (* 59.4 (+ 748 (* -33 (* 41.52 (+ 823 (+ 461 (* 566 (* 68.97 (* 74 (- 728 (* 381 (+ 727 (* 136 (+ 941 (* 44.77 (- 58.22 (- 76.37 (+ 167 (- 44.31 (- 807 (* 879 (* 51.47 (- 227 (- 645 (- 965 (+ -72 (* 342 (+ 478 (+ 298 (* 703 (- 81.73 (+ 749 (- 960 (+ -55 (* 754 (* -49 (+ 18.62 (* 25.88 (* -68 (* -89 (- 4.30 (+ 78 (* 14.27 (* 261 (* 366 194)))))))))))))))))))))))))))))))))))))))))))))))
+(* 930 (- 571 (* 53.94 (+ 404 (* 946 (+ 39.3 (- 954 (+ 607 (- 752 (+ -48 (- -37 (- 27 (* 26.29 (* 796 (+ 518 (* 280 (* 430 (+ 376 (+ 891 (+ 18.13 (* 387 (+ 97 (* 284 (+ 806 (* 74 (- 592 (- 40 (* 51.22 (* 565 (+ 770 (* -91 (- 850 (* 731 (* 880 (+ 91 (- 17.84 (+ 295 (- 78 (- 718 (* 11 (* 786 (- 941 (* 29 (* 761 (- 627 (- 54 (- 744 (- 25 182))))))))))))))))))))))))))))))))))))))))))))))))
+(* 527 (- 611 (- 37.30 (* 450 (+ 415 (+ 112 (* 25.15 (* 456 (- 202 (+ 23.87 (* 82.13 (- 882 (+ 89 (- -43 (+ 317 (+ 106 (+ 648 569)))))))))))))))))
+(- 381 (+ -51 (* 560 (+ 550 (- 313 503)))))
+(+ 59 (- 32 (* 300 (* 74 (- 433 (+ 936 (+ 120 (* 188 (- -34 (* 172 (- 421 (* -15 (+ 521 (* 755 (- 104 (- 953 (+ 260 (* 300 (+ 559 756)))))))))))))))))))
+(+ 959 (* 28.53 (* 690 (+ 779 (+ 393 (+ -60 (* 385 (* 160 (* 890 (+ 667 (+ 256 (+ 982 (- -100 (- 823 (+ 772 (* 7 (* 55.21 (- 78.96 (+ 808 (- 826 (* 688 (- 429 (+ 139 (- 644 (* 147 (* 568 433))))))))))))))))))))))))))
+(+ 504 (- 456 (+ 854 (+ 876 (* 801 (* 17 (- 428 (+ 26 (- 302 (* 15 (+ 559 (+ 970 (+ 26.19 (- 775 (* 532 (+ 997 (- 647 (- 848 (* 949 (* 702 (- 203 (+ 452 (+ 733 (+ 261 (- 57 (* 795 (* 601 (- 610 (+ 656 (+ 967 929))))))))))))))))))))))))))))))
+(- 33.68 (* 25 (- 845 (- 42.41 (- 148 (* 512 (+ 72.90 (+ 45 (* -33 (- 697 (+ 192 (- 638 (* 533 (+ 657 (+ 893 (- -60 (+ 845 (* 374 (+ 804 (- 900 (* 82.0 (- 90.83 (* 101 (- -53 (* 29.35 (* 92.5 (* 94.8 (* 19.72 (+ 75.18 (* 89.26 (- 22.74 (- 31 (- 56.32 (- 812 (+ 12 (- 658 (* 61.64 (+ -43 (* 912 (* 499 (* 479 (* 48.29 (+ 403 (- 529 (- 601 (+ -14 (+ 309 (+ 503 (+ 140 (* 730 (- 421 (- 438 (- 46.81 (- 495 143))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 298 (+ 378 (- 829 (+ 211 (+ 988 (+ 49.85 (+ 285 (- 28.8 (- 844 (- 132 (- 3.69 (+ 30.69 (- 717 (- -88 (- 85.45 (* 548 (+ 766 (* 30 (+ 287 (* 824 (- 50.31 (- 703 (+ -66 (- 64.89 (* 194 (+ 872 (- 54 (* -10 (- 291 (- 881 (+ 670 (- 596 (+ 83 (+ 884 (+ 964 (+ 555 505))))))))))))))))))))))))))))))))))))
+(- 22.88 (* 701 (- 250 (+ 641 (- 578 (- 9.0 (- 645 (- 531 (- 906 (- 57.34 (+ 854 (+ 175 (+ 83.57 (* 11 (+ 414 (- 984 (+ -47 (+ 88.35 (+ 370 (- 940 (+ 19.96 (- 599 (* 631 (+ 27.59 (+ 911 (- 333 (+ 270 (+ 856 (* 990 (- 141 (+ 755 (+ 26.27 (* 611 (- 79.47 (* 714 (+ 21.76 (- -33 (- 522 (* 38.63 326)))))))))))))))))))))))))))))))))))))))
+(* 301 (* 259 (* 498 (- 777 (* 794 (* 562 (- -91 (* 52.46 (+ 746 (* 36 (+ -90 (* 578 (* -95 (* 769 (* 923 (- -4 (* 734 (+ 698 (+ 275 (- 505 (+ 851 (* 80.81 (+ 78.20 (+ 125 (+ 359 (- 74.86 (- 682 (+ 674 (+ 96 (* 439 (- 87 (* 169 (- 573 (* 392 (- 541 (+ 364 (* 500 (- 36 (* 356 (* 595 (+ 91.60 (- 62 (+ -10 (+ 916 (- 836 (+ 150 (+ 766 (+ -48 (- 97 (+ -95 (* 559 (- 108 (- 451 90.46)))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* 964 (+ 495 (* 458 (+ 91.38 (+ 65.37 (+ 282 (- 733 (* -27 (* 256 (* 664 (* 15.77 (+ 837 (* 854 (+ 806 (- -40 (- 767 (- 332 (* 251 (- 319 (* 541 (* 646 (- 892 (* 738 (- 169 (+ 126 (* 415 (- 2.67 (- 54.15 (+ 91.28 (* 181 (+ 430 (* 685 (- 99.60 (+ 435 (+ 766 (+ 634 (- 450 (- 397 (- 869 (- -95 (+ 81 (- 79 (+ 378 (* 227 92))))))))))))))))))))))))))))))))))))))))))))
+(+ 10.80 (* 59.97 (+ 64.62 (- 403 (- -17 (- 293 (- 253 (- 64.18 (+ 525 (* 389 (* 62.65 (- 32.75 (* -30 (* 597 (- -70 (- 281 (- 172 (* 921 (+ 357 (- 388 (* 464 (+ 359 21))))))))))))))))))))))
+(* 868 (- 90.81 (+ 356 (+ 966 (+ 925 (+ -4 (+ 585 (+ 896 (- 653 (* 66 (+ 825 (+ 754 (+ 17.13 (+ 836 (- 482 (- 591 (- 696 (+ 161 (+ 402 (- 105 (+ 424 (- 568 (+ 69 (- 425 (* 469 (- 188 (* 200 (- 12 (* 527 (+ 817 (* 426 (- 33.49 (* 36.38 (* 643 (* 39 (* 227 (* 65.96 (- 706 (* -65 (- -50 (* 68 (* 501 (+ 76.12 (+ 922 (* 348 (- 893 (* 171 (- 803 (- 46.32 (+ 14.21 (* -97 (- 979 (- 100 (+ 181 (+ 832 (+ 38.8 (- 343 (* 86.6 383))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 902 (* 663 (+ 0.67 (* 287 (- 629 (- 267 (* 225 (+ 475 (* 24 (- 939 (- 956 (- 980 (+ 453 (+ 917 (- 484 82.0)))))))))))))))
+(* 84.75 (- 553 (* 39.25 (+ 829 (- 76.56 (+ 453 (+ 341 (+ 467 (+ -35 (+ 65 (- 841 (+ 24.28 (+ 365 (+ 919 (+ 883 (- -42 (* 17.10 (+ 784 (- 2 (+ 128 (- 266 (* 475 (* 637 (+ 802 (* 57 (* 69.26 (+ 99.72 (* 630 (+ 633 (+ 995 (+ 35.37 194)))))))))))))))))))))))))))))))
+(* 139 (- 355 (+ 595 (* -50 (+ 49.52 (- 539 (+ 872 (- 453 (* 86 (- 451 (* 695 (+ 261 (+ 9.68 (+ 24.60 (+ 131 (+ 84.66 (+ 321 (- 19.48 (+ -50 (* 58.86 (* 257 (- 212 (- 36.50 (* 470 (* 57 (* 508 (* 9 (+ 361 (* 477 (+ 317 (* 32.55 (* 686 (- 242 (* 886 909))))))))))))))))))))))))))))))))))
+(- -76 (* 586 (+ 502 (- -12 (* 774 (* 201 (* 821 (- 34.29 (* 83.50 (+ 287 (* 947 (- 354 (+ 5.15 (* 602 (+ 658 (+ 96 (- 551 (* 422 (+ 2.86 (- 852 (- 24 (- -46 (- 393 (* 656 929))))))))))))))))))))))))
+(+ 556 (* 818 (* 819 (- 889 (* 93.37 (+ 18 (- 521 (+ 243 (* 954 (* 913 (- 26 (- 827 (- 782 (* 550 (+ 65.13 (* 727 (* 435 (* 77.28 (- 225 (* 45 (- 216 (* 343 (* -59 (+ 653 (- 290 (* 98.71 (* 13 (* 270 (+ 403 (* 87.80 (+ 39.52 (* 121 (- 222 (- 491 (+ 332 (* 986 (+ 354 (+ 973 (- 45 (+ 288 (+ 892 (+ 107 (- 839 (- 59.60 (- 342 (- 53.73 816))))))))))))))))))))))))))))))))))))))))))))))
+(- 39.52 (+ 2.51 (- 806 (* -97 (- 12 (+ 170 (* 715 (* 46 (- 12.0 (- 399 (* 63.7 (+ 19.96 (+ 14.21 (- 346 (- 12.95 (+ 9.97 (- 675 (- 34.92 (- 48.59 (* 876 (+ 14.36 (- 67 (* 267 (- 19.46 (+ 426 (+ 574 (- 148 198)))))))))))))))))))))))))))
+(+ 892 (+ 219 (* 517 (- 569 (+ 464 (- 91.10 (- 190 (* 439 (- 578 (- 607 (- 573 21.37)))))))))))
+(* 183 (* 667 (+ 848 (- 930 (* 155 (- 214 (+ 51.11 (- 166 (+ 973 (* 846 (* 242 (+ 901 (- 24.78 (+ 38.78 -36))))))))))))))
+(- 754 (* 794 (+ -36 (- 90.77 (* 538 (- -15 (* 909 (+ 509 (- 426 (* 442 (- 733 (* 141 (+ 822 (+ 421 (+ 333 (- 967 (* 199 (+ 673 (* 426 (- 492 (+ 524 (- 493 (* 601 (- 20 (+ -39 (- 82.12 (* 751 (* 501 (* 312 (- 252 (+ 31.39 (* 347 (* 954 (+ 972 (- 750 (* 654 (* 204 (- 28.89 (- 131 (+ 855 (- 59 (* 886 (+ 39.11 (+ 629 (- 121 (- 214 (+ 31.78 (* 9.14 (* 729 31)))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 818 (- 655 (* 180 (+ 659 (+ 77.71 (+ 82.74 (* -70 (+ 62.28 (+ 668 (* 492 (+ 745 (- 1.81 (- 25.21 (* 754 (- 105 (+ 62 (- 43.29 (- 874 (+ 445 (+ 497 (+ -38 (* 426 (- 129 (* 936 (- 936 (- 63.38 (- 540 (* 628 (- 871 499)))))))))))))))))))))))))))))
+(* 65.75 (* 231 (- 838 (- 265 (+ 489 (* 504 (+ 472 (+ 1.14 (* 718 (+ 60.57 (- 472 (* -36 (- 678 (* 782 (- 27.30 (- 394 (- -34 (- 161 (- 619 (+ 275 (- 322 (* 898 (- 116 (+ 223 (* 902 (+ 12.94 (+ 44.15 (* 322 (* 742 (+ 261 (+ 595 (* 537 (+ 874 (+ 40 (+ 341 (* 951 71))))))))))))))))))))))))))))))))))))
+(* 470 (- 256 (* 891 (+ 474 (+ 313 (+ 215 (+ 189 (- 992 874))))))))
+(* 88.60 (* 544 (+ 800 (+ 75.56 (- -27 (* 112 (- 163 (- 710 (- 463 (* 36.73 (+ 71 (+ 550 (* 248 (* 156 (+ 705 (- -80 (- 737 (+ 87.47 (- 41.21 (+ 82 (* 717 (+ 7.56 (- 955 (* 85.37 (- 558 (* 307 (+ 82.37 (* 823 (- 495 (+ 501 (* 609 (+ 98 (* 258 (* 396 (- -19 (* 623 (* 677 (* 828 (+ 43.2 (* 681 -9))))))))))))))))))))))))))))))))))))))))
+(- 631 (+ 639 (- 10.6 (* 739 (* 328 (+ 421 (* 119 (- 31 (+ -72 (- 432 (+ 965 (* 330 (* 694 (+ 8.70 (- -85 (- 693 (- 149 (- 197 (* 12.64 (- 351 (- 116 (- 163 (+ -95 (+ 51 (* 835 (* 110 (- 66.55 (- 554 (- 52.16 77)))))))))))))))))))))))))))))
+(+ 360 (+ 726 (* 64 (* 311 (+ 843 (* 136 (+ 901 (- 273 (* 405 (* 657 (+ 66.16 (* 768 (- 125 (* 124 (* 12.98 (* 297 (* 11.94 (+ 379 (* 25.36 (* 60.39 (- 934 (* 517 (- 776 (- 418 (- 65.62 (+ 262 16.42))))))))))))))))))))))))))
+(- 902 (* -19 (* 98.8 (* 39.97 (- 10 (- 751 (* 778 (- 904 (* 907 (+ 77 (+ 388 (- 409 (* 78 (+ 839 (+ 812 (* 650 (* -13 (* 0 (+ 377 (+ 802 (- 424 (* -32 (- 415 (+ 149 (- 129 12)))))))))))))))))))))))))
+(+ 463 (+ 402 (* 946 (+ 132 (* 93.17 8)))))
+(+ 795 (* 792 (- 927 (* 940 (* 856 (- 523 (* 906 (- 628 (* 877 (+ 76.11 (* 501 (* 78.6 (* 262 (+ 625 (+ 83.92 (- 172 (* 714 (* 771 975))))))))))))))))))
+(+ 29.23 (* 577 (+ 1 (* 435 (+ 96.21 (+ 733 (* 356 (+ 478 (- 795 (+ 755 (- 3.69 (* 237 (- 10 (* 321 (- 809 (* 88.96 (- 905 (* 81.25 (* 557 (* 474 (- 146 (* 948 (- 38.71 (- 642 35))))))))))))))))))))))))
+(+ 98.42 (- 538 (+ -40 (+ 823 (+ 415 (+ 905 (- 58 (+ 205 (* 80.56 (+ 887 (* 9.97 (* 860 (- 502 (- 82.78 (+ 13.63 (+ 447 173))))))))))))))))
+(- 77 (* -60 (- 763 (+ 18.35 (- 93.35 (- 64 (- 553 (+ 703 (+ 465 (* 768 988))))))))))
+(* 792 (+ 338 (* 818 (* 59.15 (+ 75.73 (+ 76 (* 879 (+ 902 (- 16.21 (- 768 (+ 526 (* 64.37 (+ 1.28 (- 925 (- 760 (* 597 (- 79 (- 749 (- 522 (- 896 (- 296 (- 26.92 (- 48.70 (* -48 (- 863 (* 905 (- 487 (* 691 (* 193 (* 757 (* 934 (+ 207 (+ 843 (* 9.17 (+ 526 (+ 664 (- 475 (* 808 (+ 98.72 (+ 768 (* 84.32 (* -96 (+ 211 (- 21 (* 24 (+ 40.67 (- 777 (* 58.83 (- 696 400)))))))))))))))))))))))))))))))))))))))))))))))))
+(- 315 (+ 301 (- 779 (- 716 (- 984 (+ 151 (* 788 (- 48.44 (+ 410 (* 81.77 (- 382 (* 904 (+ 637 (+ 77.66 (+ 957 (* 727 (+ 327 (* 99.78 (- 708 (* 92.19 (* 788 (+ 15 (* 835 (- 746 (* 368 (- 54 (- -8 (* 796 (* 926 (- 366 (+ 27.88 (* 769 (+ 187 (* 90.30 (+ 71.88 (* 697 (* 68.35 (- 68.52 (* 18.74 (* 30.46 (* 59.51 (+ 613 (* 712 (- 561 (+ 17.70 (- 364 (- 626 -84)))))))))))))))))))))))))))))))))))))))))))))))
+(- 946 (* 229 (- 541 (- 41.8 (* 535 (- 357 898))))))
+(* 487 (* 681 (* 702 (+ 898 (* 810 (* 20.18 (- 675 (- 563 (+ -31 (+ 1.17 (* 22 (* 863 (- 398 (- 553 (+ 392 (- -80 (+ 956 (+ 4.63 (* 11 (+ 65 (* 609 (- 221 (+ 424 (* 793 (* 23.16 (+ 997 (- 71 (+ 665 815))))))))))))))))))))))))))))
+(- 327 (+ 62 (* 569 (- 886 (+ 791 (- 33 (+ 327 (* 30 (+ 892 (* 64.82 (+ 24.3 (- 369 (- 35.40 (+ 963 (- 712 (+ 380 (+ 283 (- 638 (+ 45.6 (* 6 (- 118 (- 83.52 (+ 624 (- 762 (* 39 (- 457 (+ 395 (- 776 (* 840 (+ 282 5))))))))))))))))))))))))))))))
+(* 836 (* -25 (* 213 (+ 93.6 (* -87 (- 532 (* 121 (* 12.17 (- 352 (* 50.80 (* 786 (+ 637 (+ -58 (- 663 (- 575 (* 335 (* 409 (- 77.39 (* 845 (+ -15 (- 19.10 (- 693 (+ -45 (+ 457 (* 97.98 (* 86.83 (+ 12.9 (- 167 (* 173 (+ 293 (- 123 (+ 410 (+ 1000 (+ 33.47 (+ 993 (+ 690 (+ 270 (- 214 (* 726 (- 988 (+ 583 (- 6.91 (* 616 (- 137 (* 662 (+ 543 (* 582 (* 1 829))))))))))))))))))))))))))))))))))))))))))))))))
+(- 118 (* 964 (+ 133 (* 732 (+ 598 (* 11.4 (+ 732 (* 189 (* 998 (- 542 (- 717 (+ 916 (* 621 (- 245 (- 476 (+ 109 (* 48.54 (* 534 (- 978 (- 539 (* 958 (+ 586 (- 666 (+ 638 (+ 58 (- 607 (* 13.56 (+ 64.37 (* 39.58 (- 812 (+ 364 (- 125 (* 55 (- 734 (- 21.44 (- 970 (* 146 (+ 543 (- 914 (* 57.39 (* 824 (+ 210 (- 113 (- 734 893))))))))))))))))))))))))))))))))))))))))))))
+(- 13 (* 31.94 (* 573 (+ 4.76 (* 541 (+ 158 (* 16.65 (* 414 (+ 54.98 (+ -2 (- 415 (- 523 (* 402 (* 615 (+ 46.48 (- 55.86 (+ 511 (+ 870 (+ 54.66 (* 79.11 (+ 906 (- 79.0 (* 47.61 (- 38.44 (+ 634 (+ 635 (* 287 (- 335 (* 856 (+ 773 (- 66.6 (- 965 (- 683 (- 186 (* 300 (- -36 (* 538 (- 464 (* 383 (+ 673 (- 45.91 (- 78.78 10.65))))))))))))))))))))))))))))))))))))))))))
+(+ -42 (+ 673 (+ 184 (* 26.63 (+ 563 (+ 325 (+ 690 (+ -2 (* 630 (+ 188 (+ 649 (* 7 (* 858 (+ 656 (+ 84.44 (- 506 (+ 677 (+ 838 (+ -78 (- 429 (- 134 (* 41 (- 82 (- 651 (* 1 (- 220 (- 490 (+ -14 (* 96.82 (- 242 (+ 317 (* 284 (- 553 (- 242 (+ 888 895)))))))))))))))))))))))))))))))))))
+(+ 811 (* 650 (* 65.99 (- 582 (* 285 (* 767 (* 19 (+ 0.10 (+ 9.31 (+ 956 (* 330 (- 436 (+ 36.94 (- 587 (* 579 (* 937 (- 373 (- 965 (+ 160 (* 36.27 (+ 293 (* 595 (+ 620 (+ 486 (* -57 785)))))))))))))))))))))))))
+(- 210 (- 108 (* 557 (* -65 (- 9.4 (+ 232 (+ 186 (+ 644 (+ 53.76 (- 291 (+ 431 (+ 159 (+ 372 (- 95.95 (+ 33.40 (+ 117 (* 446 (* 79.50 (* 802 (* -34 (+ 622 (- 22.54 (- 300 (+ 705 (+ 450 (* -17 (+ 49.94 (- 77 (+ 598 (* 58.31 (+ 105 (* 593 (+ 861 (* 231 (- 273 (+ 482 (+ 376 (+ 993 (* 60 664)))))))))))))))))))))))))))))))))))))))
+(* 794 (* 702 (- 345 (- 121 (- 152 494)))))
+(- 696 (+ 84.10 (- -83 (+ 11.46 (* 41.66 (* 827 (+ 315 (+ -30 (+ 722 (* 927 (* 991 (* 450 (+ 49.20 (+ 85.88 (* 72 (* 418 (* 724 (- 494 (- -63 (* 914 (+ 319 (- 84.98 (+ 748 (+ 577 (- 824 (- 42.66 (* 229 (+ 72.35 (* 12.21 (* 787 (+ -90 (- 120 (- 34.6 (- 136 (* 38.95 (+ 633 (+ -71 (- 30.86 (* 458 (- 76.88 348))))))))))))))))))))))))))))))))))))))))
+(* 274 (+ 520 (* 88.34 (- 265 (* 714 (+ 159 (* 10.58 (* 466 (+ 385 (- 719 (- 280 (* 785 (- -61 (- 82.70 (+ 39.98 (* 431 (+ 999 (+ 899 (+ 77.97 (* -69 (- 405 (* 107 (- 58 (+ 336 (+ 7.17 (- 317 (+ 870 (+ 5 (* 382 (* 607 (- 653 (+ 908 (+ 14.41 (+ -50 (+ 23.43 (* 751 (* 414 (+ 30.8 (+ 749 (- 495 (- 516 (+ 83.55 (+ 38.27 (+ -40 (+ 537 (- 405 (+ 680 (- 676 (* 324 (* 300 (* 38.41 (+ 96.81 (+ 565 (- 532 (- 282 815)))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 423 (- 627 (* 391 (- 261 (+ 916 (+ 693 (* 55.36 (+ 88.94 (- 35.5 (+ 842 (- 826 (* 51.25 (+ -58 (+ 135 (* 2.86 (* 77.80 (* 746 (* 19.93 (+ 51.33 (- 483 (+ 756 (- 885 (- 880 (- 881 (- 280 (* 736 (- 11.88 (+ 171 (* 176 (+ -98 (+ 754 (- 147 (- 44 (* 479 (- 69.45 (+ 841 (* 152 (* 327 (- 568 (- 3.53 (- 222 (- 541 (- 528 (+ 678 (* 47.78 (+ 289 (+ 825 (- 933 (* -12 (* 291 (+ 355 (* 888 (- 45 6.17)))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 83.17 (+ 642 (- 576 (- 99 (- 215 (+ 201 (+ 26.31 (* 207 (+ 635 (+ 15.30 (- 918 (- 398 (- 837 (- 70.59 (* 992 (+ -85 (- 500 (+ 98.49 (* 523 (* 942 (* 454 (+ 51.19 (+ 32 (* 511 (- 152 (- 799 (+ 75.65 (+ 1.97 (+ 386 (- 145 (* 137 (+ 797 (- 299 (+ -98 (* 472 595)))))))))))))))))))))))))))))))))))
+(* 249 (* 75.21 (- -88 (+ 475 (- 128 (* 48.75 (+ 736 (+ 19 977))))))))
+(* 134 (- 376 (+ 112 (+ 555 (* 502 (+ 60.52 (+ 93.42 (- 568 (+ 993 (+ 71 (* 909 (- 15.52 (* 469 (- 924 (* 117 (+ 79.7 (+ 264 (- 593 (- 598 (- 12.70 (* 147 (+ 49.5 (+ 95.47 (+ 713 (- 75.1 (+ -2 (- 17.88 (+ 366 (+ 683 (* 57.12 (* 268 (* 462 (* 841 (+ 307 (- 921 (- -7 (* -75 (- 423 (* -97 (- 278 (- 12.27 (+ 510 (- 80.11 (- 379 (+ 505 (* 851 (- 507 (+ 745 (+ -68 (+ 824 (* 363 (+ -86 (+ 645 (+ 305 339))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* 699 (+ 692 (- 694 (- 448 (* 177 (- 969 987))))))
+(- 45 (- 49.73 (* 363 (* 424 (+ 800 (+ 533 (* 250 (+ 739 (+ 726 (+ 74.9 (* 84.34 (- 503 (+ 222 (+ 79.3 (+ 699 (* 979 (* 796 (+ 69.46 (- 608 (- 4 (* 649 (- 225 (* 609 (* 469 54.40))))))))))))))))))))))))
+(* 94 (* 129 (+ 187 (+ -64 (+ -64 (- 978 (- 47.72 (* 280 (* 92.43 (+ 762 (+ 386 (+ 951 (- -4 (- 932 (* 957 (- -80 (* 197 (+ 915 (- 167 (+ -94 (+ 348 (- 344 (+ 474 (+ 62.53 (* -68 (+ -14 (* -100 (+ 821 (- -5 (- 15 59.94))))))))))))))))))))))))))))))
+(- 50.24 (* 39 (- 128 (- 968 (* 986 (- 17.52 (- 749 (+ 297 (* 872 (+ 837 (* 52.91 (- 512 (- 687 (- 34.90 (- 846 (- 80 (- 97 (- 41.20 (* 867 (+ 992 (* 592 (+ 233 (* 994 (+ 999 (- 689 (* 653 (+ 73.14 (- 844 (+ 470 (- 21.2 (+ 534 (+ 257 (- 53 (* 49.22 (* 795 (- 632 (* 278 (+ 232 (* 376 (+ -77 (+ 507 (* 924 (* 409 265)))))))))))))))))))))))))))))))))))))))))))
+(+ -14 (- 692 (- 897 (* 285 (+ 867 (- 55 (- 925 (* 758 (+ 662 (+ 5.27 (- 727 (- 552 (* 172 (+ 92.80 (- 67.3 (* 603 (* 7.97 (* 50 (* 682 (- 666 (- 220 (* 216 (+ 14.57 (* 266 (- -56 (* 3.15 (- 879 (- -41 (- -91 (- 212 (- 295 (+ 853 (* 761 (* 454 (* 565 (+ 467 (+ 501 (- 757 (- 940 (- 896 (* 485 (* 984 (* 799 (- 512 (* 89.74 (+ 818 (- 690 (- 643 (+ 195 (+ 904 (+ 77 (- 986 (* 39 (* 879 (- 515 (* 303 (- 58 (+ 67.68 266))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* 756 (+ 935 (- 797 (- 479 (- -82 (* -38 (- 564 (* 506 (* 8.51 (+ 733 (* 92.51 (* 608 (+ 8.37 (+ 378 (- 927 (- -4 (- 780 (- 544 (+ 419 (* 8 (+ 616 (- 749 (* 88.42 (* 237 (+ 59 (- 49.47 (* 84.94 (- 895 (- 300 (* 69.30 (+ 23.20 (* 69 (+ 924 (+ 10.95 (* 5 (+ 992 545))))))))))))))))))))))))))))))))))))
+(* 895 (+ 343 (+ 368 (- 16.84 (- 393 (* 437 (- 633 (- -80 (- 956 (* 828 (* 585 (* 13.82 (+ 194 (* 703 (- 612 (- -41 (- 51.3 (- 974 (+ 753 (+ 771 (* 579 (- 923 (+ 448 (* 396 (+ 67.87 (* -13 (- 839 (* -10 (- 63 (+ 23.96 (+ 97 (+ 939 (* 49.65 (* 37.13 (- 579 (+ 900 (+ 68.57 (* 58 (- 5.26 (+ 92.55 (+ 487 (* 487 (+ 59.32 (- 457 (- 26 (+ 29.69 (- 427 (+ 790 (* 628 (- 256 (+ 468 (* 759 (- 34.26 (+ 63 (+ 648 (- 964 (+ 244 -58)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 14.16 (* 744 (* 836 (* 281 (* 603 (* 860 (* 797 (+ 14.47 (- 978 (* -16 (+ 692 (* 779 (+ 472 (* 660 (- 103 (+ -71 (+ 606 (- 176 (* 23.88 (* 283 (* 216 (* 126 (- 30.70 (* 957 (- 31.55 (* 529 (- -15 (* 540 (- -95 (- 139 (- 447 (+ 390 (* 286 (- -46 (+ 9.15 941)))))))))))))))))))))))))))))))))))
+(+ -92 (+ 186 (+ 7.45 (+ 21.5 (- 635 (* 0 (- -38 (* 45 (* 1.11 (* 998 (+ 853 (* 104 (+ 292 (- 50.53 (* 51.65 (- 929 (* 779 (+ 25.15 (* 44.6 (+ 596 (+ 308 (+ 24 (- 615 (+ 463 (+ 775 (- 542 (* 681 (- 856 (* 420 (* 145 (* 64.39 (+ 1.89 (+ 808 (* 65.34 (* -65 392)))))))))))))))))))))))))))))))))))
+(+ 23.18 (* 356 (+ 236 (- 328 (- 574 (+ 35.15 (* 655 (* 763 (* 89.83 (+ 44.76 (+ 151 (- 233 (- 923 (- 340 (- 517 (- 74 (* 50.75 (- 361 (+ 611 (- 976 (+ 930 (* 593 (* 334 (+ 357 (- 178 (+ 1000 (* 694 (- 554 (+ 25.80 (- 64.46 (- 510 (+ 532 (+ 229 (* 561 (* 60.57 (+ 897 (- 6.54 722)))))))))))))))))))))))))))))))))))))
+(* 896 (+ 73.29 (+ 993 (+ 237 (- 858 (* -100 (* 515 55.78)))))))
+(* 46.49 (* 105 (+ 282 (- 78 (- 61.40 (- 349 (* 386 (+ 558 (+ 672 (+ 33.74 (+ 735 (- 87.51 (+ 554 (- 784 (+ 549 (- 682 (* 247 (+ 98.72 (- 592 (* 392 (+ 44.68 (+ 842 (* 403 (* 98 (- -20 (- 376 (* 391 (+ 281 (* 235 (* 806 (- 490 (+ 284 (+ 927 (+ 82 (* 76 (* 92 (+ 36.5 (+ 62.28 (* 39.40 (* 435 (+ 35 (- 982 (+ 7.3 (+ 84 (+ 245 (- 70.75 (+ -84 (+ 31.98 (- 123 (* 59 (- 98.62 (+ 411 (- 761 (* 54 (- 535 (* 102 (* 301 713)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 533 (* 113 (* 143 (- 86.77 (+ 359 (+ 168 (- 764 (+ 995 (- 675 (- 177 (* 142 (* 223 (- 837 (* 928 (- 671 (* 507 (- 660 (- 554 (- 850 (* 338 (- 938 (+ 59.40 (+ 742 (- 83.93 (+ 381 (+ 471 478))))))))))))))))))))))))))
+(+ 259 (* 924 (* 819 (+ 653 (* -94 (- 636 (+ 58.26 (+ 27.0 (- 798 (- 242 (- -70 (+ 220 (- 609 (* 923 (* 346 (+ 1000 (+ -35 (* 40 (- -80 (* 87.84 (- 94.36 (+ 501 (- 62.39 (* 69.36 (- 899 (+ 56.96 (+ 982 (- 672 (+ 765 (* -4 (- 755 (+ 702 (* 1.64 (- 908 (+ 91.31 (+ 662 (* 26 (+ 56 (- 851 (+ 42.91 (- 225 (- 875 (+ -55 (+ 31.13 (- 714 (+ 290 (* 84 (* 84 (* 425 471)))))))))))))))))))))))))))))))))))))))))))))))))
+(* 571 (+ 275 (+ 596 (* 749 (* 78 (* 731 (+ 25.48 (+ 743 (- 718 (* 57.37 (* 267 (* -98 (+ 79 (* 714 (* 704 (- 774 (- 882 (* 102 (+ 532 (* 35.70 (* 32 (- 342 (* -65 (- 619 (- 966 (* 48.26 (- 91.32 (- 645 (+ 318 (+ 75 (+ 79.83 254)))))))))))))))))))))))))))))))
+(* 382 (- 866 (- 78.71 (+ 224 (- 6.77 (+ 332 (+ 210 (- 700 (+ 350 (+ 777 (* 145 (+ 245 (- 121 (+ 333 (+ 775 (+ 989 (+ 248 (* 748 (* 910 (* 794 (+ 74 (+ 205 (+ 568 (- 93.26 (* 664 (+ 243 (- 842 (- 39.45 (- -55 (* -43 (- 445 (* 84 778))))))))))))))))))))))))))))))))
+(+ 254 (+ 163 (* 229 (+ 668 (+ -92 (+ 483 (- 799 (+ 91.20 (+ 182 (* 55.25 (* 339 (* 60 (+ 113 (* 179 (- 473 (* -85 (* 479 (- 54.39 (+ 59 (+ 513 (- 691 (- 616 (+ 31.80 (+ 450 (- 375 (* 143 (- 655 (* 820 (* 440 (* 69.15 (- 822 (+ 767 (+ -99 (+ 254 (+ 24.84 (* 155 (* 484 (- 237 (* 164 (* 22.66 386))))))))))))))))))))))))))))))))))))))))
+(* 173 (- 71.6 (- 92.60 (- -92 (- 273 4.74)))))
+(+ 135 (+ 460 (+ 44.86 (* 67 (+ 20.62 (- 74.1 (+ -54 (+ 243 (+ 178 (* 949 (- 413 (+ 4.29 (+ 513 (+ 858 (* -75 (+ 993 (+ 610 (+ 571 (+ -73 (- 656 (- 86.6 (- 633 (+ 187 (- 753 (* -56 (- 835 (- 474 (+ 56.14 (* 27 (+ 925 (- 865 (+ -57 (+ 77.73 (* 967 (- 369 (- 72.87 (- 773 (- 586 (* 277 (- 595 (- 563 (* 74.38 (* 917 (+ 11.76 (+ -4 (+ 348 (* 615 (- 80.60 (+ -78 (* 77 (* 788 (* 125 (- 353 (- 668 (+ 38.18 (+ 89.66 (- 592 134)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 691 (* 587 (+ 376 (* 766 (* 470 (+ 57.33 (+ -99 (- 69.7 (+ -91 (* 237 (+ 455 (+ 44.98 (* 543 (+ 926 (+ 897 (- 576 (* 57.76 (+ 388 (* -17 (- 452 (* 425 (- 319 (+ 480 (- 974 (+ 42 (+ 752 (- 91 (- 342 (+ 290 (+ 244 (* 489 (+ 386 (- 44.0 (* -45 (- 469 (+ 23 (* 17 (- 79.48 (* 41.77 (+ -48 (- 340 (- 456 (* 991 (+ 74 790))))))))))))))))))))))))))))))))))))))))))))
+(- 424 (- 423 (* 117 (+ 740 (- 154 (+ 669 (- 388 (+ 76.59 (+ 346 (+ 975 (+ 767 (+ 253 (* 987 (- 82.94 (- 138 (+ 848 (* 46.12 (- 64.34 (* 49.59 (* -61 (+ 184 (* 742 (* 276 (* 616 (- 802 (- 622 (+ 30 (* -64 (+ 441 75.2)))))))))))))))))))))))))))))
+(* 515 (* 765 (+ 666 (+ 762 (* 835 (- -2 (* 699 (- 630 (- 32.82 (* 30.13 (* 911 (+ 610 (- 16.35 (* 868 (* 792 (+ 763 (- 110 (- 18.58 (+ 756 (* 77.82 (+ 759 (+ 80.57 (+ 603 (* 317 (+ 790 (+ 83.33 826))))))))))))))))))))))))))
+(+ 70.16 (+ 171 (- 17 (+ 87.28 (+ 717 (* -66 (* 98.91 (* 131 (+ 504 (- 563 (* 94.71 (* 118 (- 384 (+ 208 (+ 749 (* 966 (* 674 (* 78.26 (- 16.20 (+ 951 (+ 95 (- 10.89 (* 438 (- 17.96 (* 13.69 (- 88.24 (* 83.9 (* 48 (- 445 (- 648 (* 695 (- 671 (+ 741 (* 109 (* 17.5 (+ 651 (- 449 (+ 810 (* 253 (+ -4 (+ 22.16 (+ 821 (+ 688 (* 344 (- 628 (+ 824 (- 34 (+ 17.78 (+ -83 (- 334 (- 60.54 (- -3 (- 138 (- 921 (- 402 (+ 5.78 (+ 87.98 (* -2 (* 5.39 692)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(- 609 (+ 70.76 (* 271 (+ 984 (+ 274 (- 241 (* 271 (* -55 (* 738 (- 792 (* 716 (* 621 (- 104 (* 49 (+ 505 (* 430 (* 34 (+ 943 (* 853 (- 146 (- 20.27 (- 455 (- 493 (* 518 (- 627 (- 535 (* 64 (- 141 (- 187 (- 90 (* 91.7 349)))))))))))))))))))))))))))))))
+(- 29.68 (+ 476 (- 170 (+ 620 (* 201 (* 128 (+ -79 (* 803 (- 345 (+ 843 (- 78.78 (- 719 (- 4 (- 334 (- 76.11 (- 289 (- 958 71)))))))))))))))))
+(- 556 (+ 924 (* 559 (* 4.50 (- 12.87 (+ 172 (* 583 (* 733 (+ 90.96 (* 846 (- 29.64 (+ 524 (* 738 (* 34.75 (- 316 (- 37.33 (* 399 (- 564 (* -94 (+ 18.17 (+ 967 (- 508 (- 10.16 (+ 401 (+ 965 (- -52 (- 279 (+ 237 (- 532 (+ 773 (* 798 (+ 727 (- 225 (- 90.52 (* -63 (- 84.61 (* 501 738)))))))))))))))))))))))))))))))))))))
+(* 616 (- 14.18 (+ 580 (+ 20.43 (+ 306 (* 696 (* 852 (+ 572 (* -54 (+ 448 (- 15.9 (- 576 (- -62 (* 365 (+ 94.94 (- 564 620))))))))))))))))
+(+ 76.36 (* 66.26 (- 847 (+ 71.64 (* 308 (- 93.68 (- 732 (* 982 (+ 51.80 (- 268 (- 538 (- 40.22 (- 770 (+ 95 (* 378 (- 843 (- 33.90 (+ -8 (- 615 (+ 79.37 (+ 806 (- 364 (- 870 (- 70 (+ 940 105)))))))))))))))))))))))))
+(- 45.33 (+ 506 (- 970 (* 531 (+ 922 (+ 949 (- 615 (+ 720 (- 228 (+ 308 (* -31 (- 70.67 (* 531 (- 726 (- -77 (- 534 (* 104 (* 40.83 (- 64.38 (+ 678 (* 835 (* 43.30 (* 735 (- 802 (- 758 (+ 107 (* 713 90.14)))))))))))))))))))))))))))
+(* 655 (- 183 (* 63.15 (* 516 (* 544 (* 458 (- 254 (* 15.10 (+ 71.66 (+ 448 (- 38 9)))))))))))
+(+ -7 (+ 525 (* 90 (* 793 (+ 461 (+ 64.7 (+ 253 (* 215 (* 878 (- 3.95 269))))))))))
+(- 643 (* 295 (* 235 (* 534 (- 252 (* 121 (- 498 (* 169 (+ 256 (- 169 (+ 971 (- -48 (- 393 (+ 519 (- 372 (- 637 (+ -59 (- 951 (- 697 (- 927 (+ 520 (* 19.57 (- 170 (- 465 (- 122 (- 500 (* 440 (* 67 (* 904 (- 720 (- 97.55 (+ 164 (+ 200 (+ -67 81.22))))))))))))))))))))))))))))))))))
+(* 762 (- 184 (- 543 (- -91 (- 23.21 (+ 70.13 (* 319 (* 344 (+ 206 (+ 18.28 (* 448 (+ 702 (+ 975 (- 420 (- 455 (- 241 (- 87.24 (+ 93.38 (* 709 (+ 810 (+ 90.12 (- 200 (+ 364 (* 551 (- 265 (+ 606 (- 518 (* 216 (* 6.33 (- 908 (* 238 (+ 826 (+ 62.32 (- 646 (- 27.56 (* 197 (- 6.51 (- 82.70 (+ 58.62 (+ 681 (* 939 (* 804 (* 549 379)))))))))))))))))))))))))))))))))))))))))))
+(+ 355 (- -24 (+ 496 (- 55.76 (- 839 (* 245 (* 974 (+ 86.5 (* 720 (+ -27 (- 623 (+ 84.17 (* 137 (* 814 (+ 60.93 (- -54 (+ 41.81 (* 701 (* 502 654)))))))))))))))))))
+(+ 828 (- 508 (* 940 (- 905 (+ 899 (- 955 (+ 239 (* 177 (+ -97 (+ 359 (* 68.61 (+ 540 -63))))))))))))
+(+ 297 (+ 370 (- -80 (+ 451 (+ 31.56 (- 209 (- -41 (* 954 (- 121 (- 647 (- 847 (+ 22.82 (- 61.67 (+ 193 (- 711 (+ 92 (- 22.3 (* 842 (- 302 (+ 30 (* 427 (- -20 (* 733 (* 461 (- 69.44 (+ 43.33 (- 99.22 (* 840 (+ 13.64 (- 63.17 (* 259 (+ 20.82 (- 268 (* 662 (+ 44.21 (* 201 (+ 15.89 (* 38 (- 378 (- 59.56 (* 799 (+ 854 (+ 942 (- -46 (* 38.50 (- 801 (* 24 (- 375 (* 993 (* 932 (* 88.37 (* 157 (- 63.61 (+ -61 (* -96 (- 74 -53))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* 864 (- 139 (- 220 (- 876 (- 892 (- 325 (+ 7.93 307)))))))
+(- 229 (* 428 (- 656 (* 616 (- 479 (* 808 (- 257 (* 796 (- 841 (+ -52 (* 693 (* 434 (+ 669 (+ 778 (- 238 (+ 74 (- 92.77 (+ 908 (- 911 43)))))))))))))))))))
+(- 260 (+ 731 (+ 128 (* 53 (+ 49.21 (+ 109 (- 40.53 (+ 939 (* 897 (- 69.23 (- 103 (+ 171 (+ 31.23 (+ 42 (- 97.83 (+ 61.79 757))))))))))))))))
+(- 322 (+ 12.62 (+ 445 (+ 342 (* 336 (* 995 (* 520 (- 679 (* 104 (- 568 (+ -95 (- 456 (- 617 (+ 588 (+ 437 (+ 725 (- 610 (- 338 (- 103 (+ 644 (+ 870 (+ 43.60 (- 557 (+ 22.43 (- 140 (- 97.23 (* 34.36 (- 649 (* 406 (- 73.40 (- 32.54 (* 204 668))))))))))))))))))))))))))))))))
+(- 291 (- 56.40 (+ -91 (* 728 (* 512 (+ -22 (* 178 (+ 128 (* 991 (+ 41 (* 628 (* 273 (- 78.46 (* 565 (- 515 (+ 455 (- 16.68 (+ 722 (+ 176 (- 630 (+ 62.98 (* 946 (- 750 (- -6 (* 702 (+ 438 (+ 114 (* 292 (+ 764 (+ -32 (- 438 (* 56 (* 713 22.53)))))))))))))))))))))))))))))))))
+(+ 896 (* 935 (* 60.75 (- 947 (+ 758 (- 728 (* 73.70 (- 485 (- 872 (+ 71 (* 942 (* 844 (* 846 (+ 966 (- 594 (- 290 (* 664 (* 374 (+ 647 (* 9.92 (* 207 (* 72 (- 684 (+ 66 (- 47.16 (* 206 71.41))))))))))))))))))))))))))
+(* 108 (* 468 (- -20 (* 722 (- 311 (+ 585 (* 331 (- 360 (+ 439 (- 216 (* 946 (* 237 (- 256 (- 50.54 (* 429 (* 79 (+ -57 (+ 68 (+ 26.21 (- 738 (+ -74 947)))))))))))))))))))))
+(* 531 (- 42 (* 194 (* 747 (* 93.77 (* 231 (* 10.19 (+ 138 (* 654 (+ 220 (* 75.59 (* 138 (* 17.77 (+ -50 (+ -1 (* -9 (+ 501 (* 352 (* 668 (* 898 (- 833 (- 314 (+ 319 (+ 40.87 (+ 921 (* 62.36 (+ 353 (* 510 (+ 736 (- 282 (+ 829 (- 294 (- 67.50 (+ 67.37 (- 746 (+ 650 (* -66 (+ 84.76 (- 65 (* 612 (+ 589 (- -85 (+ 693 (* 899 (+ 493 (* 105 (* 44 (+ 81.97 (+ 875 (+ 49 (+ 779 (+ 169 (+ 12.0 (+ 893 (- 195 (+ 7.67 (* 542 610)))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+(* 959 (* 274 (+ 559 (* 93 (* 44.48 (* 194 (- 742 (- 853 (+ 414 (- 908 (+ 584 (- 284 (- 583 (+ 646 (- 38.59 (* 39.66 (+ 814 (* 31.21 (* 222 (* 528 (+ 219 (- 230 (+ 771 (+ 331 (* 180 (+ 46 (* 741 (* 644 (+ 15 (- 504 (+ 238 (+ 913 (+ 147 (- 465 (* -27 (* 9 (- 394 (* 74.52 (- 93.67 (* 727 (- 978 (* 967 (- 233 (* 59.56 (* 857 (* 790 (* 189 (- 63.43 77.26))))))))))))))))))))))))))))))))))))))))))))))))
+(* 52.56 (* 181 (+ 254 (+ 18 (- 627 (+ 13.35 (- 55 (- -56 (- 355 (- 921 (* 146 (+ 493 (- 684 (- 668 29.8))))))))))))))
+(* 317 (+ 309 (- 889 (* 345 (+ 789 (* 629 (- 55.45 (* 695 (- 38 (* 902 (+ 401 (- 944 (* 110 (* 538 (- 973 (- 68.59 (* 2.58 (* 50.10 (+ 610 (* 98 (+ 512 (- 151 (- 680 (+ 71.67 (- 62.9 (- 158 (- -84 (+ 749 (- 139 (* 245 (- 281 (+ 666 (- 41 (+ 886 (* 603 (* 211 156))))))))))))))))))))))))))))))))))))
+(+ 509 (- -98 (- 31.22 (* -35 (- 404 (+ 825 (* 186 (+ 391 (+ 315 (* 25 (* 414 (+ 67 (* 10.94 (+ 473 (* 36 (+ 691 (- -67 (- 68.63 (- 328 (* 40.38 (* 288 (+ 355 (+ 37.56 (+ 923 (+ 111 (+ -57 (* -88 (* 743 (* 888 (+ 687 (- 75.34 (+ 126 (+ 42.29 (- -83 (* -54 (* 412 (- 960 (* 517 (+ 20.56 (- 675 (- 12.70 (+ 788 (* 22.57 (- 93.93 (* 455 (* 151 (- -22 (* 508 (- 93.0 (- 53.26 (- 309 (- -61 962))))))))))))))))))))))))))))))))))))))))))))))))))))
+(+ 608 (* 29.58 (+ 428 (- 157 (* 758 (- 943 (- 296 (+ 42.99 (+ 277 (+ 813 (* -85 (+ 421 (* 349 (* 595 (- 905 (- 233 (+ 228 (- -32 (- 207 (+ 475 (+ -4 86.69)))))))))))))))))))))
@@ -0,0 +1,120 @@
++ 330 -33 156 84.93 306 750 286 593 522 882 557 133 534 40.92 230 919 906 538 219 81 975 122 757 399 278 -29 99 130 252 59.58 45.86 133 86.86 4.54 453 712 271 768 460 -65 362 310 433 746 72.27 85.76 577 88.68 90.27 513 -26 774 645 786 34.72 347 38.33 48.62 687 319 206 237 106 358 336 226 963 72 64 954 440 439 817 794 822 0.58 11.12 418 14.84 193 920 68 856 133 846 2.44 58 512 994 148 885 49.10 190 535 45.10 240 573 926 347 -39 1 607 465 11.71 138 39.82 267 4.97 19.69 431 837 719 366 42.6 -84 795 8 86.99 74.45 819 336 -6 693 95.83 355 925 68.64 715 61 757 97.66 478 22.10 36.72 617 318 -14 199 362 701 26.48 31.66 993 556 785 79.64 93.47 931 -9 7 422 446 472 949 621 -10 54.64 747 800 581 17.39 588 328 82.50 327 93.2 69.88 128 797 484 287 995 94.67 27.57 9.70 -57 725 200 52.43 673 698 49.95 700 90.70
+(192 187 331 481 274 29.62 280 518 813 340 -6 89 311 816 345 864 610 65 165 165 -51 26.56 36.41 447 559 92.60 60 65 218 302 742 539 202 359 70.1 346 304 788 306 728 92.7 747 36.46 761 85.92 120 53 89.78 209 277 383 79.62 602 970 330 201 4.87 960 -86 370 190 919 800 -30 97.39 -88 997 451 594 497 514 63.64 438 922 27.74 288 77.8 40 91 82.30 810 258 391 85 95.19 516 -6 698)
++ 767 500 8.70 858 749 60.54 796 754 2.38 75.63 80 11.88 532 92.3 207 266 49.44 61.52 565 555 934 -14 753 646 72.3 -12 584 78 -71 157 479 -56 801 803 159 229 95.66 505 29.86 70.83 22.87 22 95.61 18.30 550 306 -52 859 69 657 9 987 64.50 440 12.39 35.28 523 129 930 529 545 486 504 301 15 2.27 -10 594 66 637 616 0.55 19.46 996 465 415 807 387 22.78 986 622 598 21 180 68.2 508 213 656 23.99 711 286 103 14.80 14.93 93.58 937 462 57.56 762 104 351 803 532 781 12.47 393 850 556 63.41 69.48 23.84 2.82 -33 73.25 584 71 603 5.23 60.95 85.67 661 899 958 179 609 71.86 20.55 126 185 945 49.92 90.35 905 282 752 307 208 47.10 651 852 32.45 286 373 28.32 128 947 696 499 30.86 322 33.80 192 365 3 -85 11.8 38.1 665 858 794 53.27 39.94 489 7.42 33.96 880 626 65.18 197 992 707 58.83 41.87 -41 193 149 357 502 39.55 748 80.91 809 26.21 28.97 16.61 78.33 17.61 499 48.45 562 437 3 92.93 3.64 45.82 68.93 41.95 90 84.66 260 899 445 -6 430 918 993 35 195 4.52 9.92 52.12 44.33 406 245 558 700 80.70 33.14 623 830 15 415
++ 778 179 648 430 0.65 269 817 84.57 52.44 207 -64 289 872 372 312 372 270 50.31 7.83 573 -58 98.96 703 30.8 51.45 918 33.87 25.50 366 194 2.66 5.21 939 472 333 316 78.88 701 76.25 588 235 564 90.53 52.58 976 223 878 26.55 11.52 348 18.15 837 817 467 511 61.94 98.35 358 806 693 834 791 51.19 459 52.84 721 4.59 254 27.81 56 904 647 352 52 58.70 111 190 977 350 139 623 846 38.99 971 -96 37.57 434 235 716 103 742 -17 171 684 54.93 827 372 689 47.16 725 57.46 425 71.35 25.65 64.73 8.58 205 168 82.60 918 929 999 153 256 40 434 21.70 168 -47 22.86 694 746 868 636 715 275
+(7 347 985 259 969 142 709 59 421 648 507 329 436 835 41.38 -2 173 695 190 745 414 126 59 739 903 134 -6 10.57 862 -5 20.1 31.88 530 344 179 554 -40 107 432 722 122 -53 428 -47 116 24.72 582 226 541 99.49 351 562 76.83 734 887 905 292 103 302 730 384 944 649 493 -57 132 163 867 33.38 913 13.28 419 10 688 980 543 -48 105 843 891 -24 923 938 598 415 824 10 847 910 952 3.32 424 296 755 539 152 440 320 -72 89.87 692 668 289 431 972 29.38 90 36.56 712 896 548 80.32 759 24.11 363 838 215 870 716 847 367 318 -20 685 454 819 330 700 904 438 272 -89 110 555 169 932 210 359 851 85.41 -15 953 -68 511 740 836 461 183 139 198 587 685 395 -19 216 770 506 803 640 95 13 736 613 223 115 76.97 61 125 700 591 114 48 167 998 964 34.21 564 419 719 632 627 64.41 960 953 -11 3 872 491 523 -98 199 -29 649 -1 171 978 -63 -99 917 297 64.11 -60 351 693 852 607 910 623 529 195 819)
++ 28.31 45.66 942 -65 61 895 17.12 14.11 567 456 953 -69 38.96 49 88.9 993 0.63 61.62 902 79.81 95 706 24.63 39.5 22.86 -82 2.13 56.71 769 320 535 8.35 -34 76.2 10.20 790 770 798 501 927 312 322 208 36.66 732 626 74.74 -97 866 -32 38.48 65.60 16 235 367 165 49.59 373 88.49 42.98 66.93 18.99 25.79 784 524 817 904 19.31 423 237 77 17.39 705 51.87 491 632 206 416 -45 732 972 10.54 94 28.80 44 43.71 279 702 76.56 55.6 38.7 34.13 88.86 668 9.50 51.38 92.3 525 705 -80 631 346 27.78 983 36.61 359 886 279 260 245 538 47 68.85 744 117 94.64 13.20 91.74 845 486 934 39.88 733 149 58.44 84 502 771 284 66.50 445 -39 227 9.49 702 996 549 23.3 127 163 890 513 890 53.74
++ 209 295 906 719 399 47 60.69 692 313 362 38 2.39 751 70.45 645 6.43 17 40.11 -56 680 -75 951 40.72 33.27 931 67.80 233 47.62 14.13 699 -12 68.77 272 91 64.77 616 93 887
+* 285 77 41 351 48.49 525 25.36 477 29.37 781 853 449 710 32 42.44 57 -94 684 17 947 776 55 222 680 482 864 57.37 -42 76.63 174 916 14.75 775 524 663 212 37.47 543 996 70.54 521 -54 970 38.47 624 830 8.43 825 860 984 54.10 2.16 364 885 724 11.50 481 922 98.73 971 685 736 63.13 64 887 364 74.55 81.73 803 604 62.40 346 479 19 212 75.12 273 750 759 232 831 932 389 22.48 907 72.52 257 761 46 -6 60.71 819 58.15 764 517 859 -70 79.69 86.98 423 499 48.35 898 619 55.81 705 239 310 33.41 942 993 587 207 16.94 -63 609 879 526 508 81.7 84.0 36.18 48.93 856 254 63.3 92.54 867 -44 147 694 10.55 200 33.49 939 50.46 -96 96 750 108 764 235 19.4 28 185 2.90 -50 680 432 297 984 444 197 56.38 94.59 519 536 131 856 671 689 76.50
++ 382 269 -80 86.75 687 97.24 13.50 928 841 85.60 579 134 973 26 454 945 85.60 68 397 16.99 79 648 616 29.14 70.56 619 906 280 20.65 586 408 957 11 86.72 282 33.74 34.32 439 95.51 75 262 174 75.62 468 691 24.95 244 591 143 22.9 888 44.48 604 22.7 -22 133 825 -96 127 28.66 805 206 217 633 357 666 547 908 881 221 436 47 42 193 366 270 46 89 872 63.6 93.37 21.53 2.68 70.26 -62 77 363 386 422 574 407 40 957 370 29.10 59.18 963 267 844 95.5 375 717 -54 -86 61.86 774 91.58 -30 847 654 31.98 34 67.41 39 91.58 434 86.82
++ 21.85 33.32 47.91 936 578 -81 211 111 -98 827 41.31 77.80 787 50.89 95.57 593 63.63 947 142 790 654 35.60 129 84.15 209 77.66 883 36.53 312 71.88 89.44 50 135 -62 454 598 88.48 73.23 3.48 771 78.1 83.34 500 40.20 52.59 27.7 507 898 -50 881 596 317 34.26 639 132 28.8 736 663 302 23.35 349 152 916 299 917 869 223 530 72.63 928 459 14.94 771 477 636 232 -63 445 722 47.88 39.0 960 514 27.20 712 -89 -39 82.85 902 83.24 287 236 3.45 599 236 999 152 -3 54.8 399 783 21 581 -35 639 54 535 82.63 394 382 949 518 500 28.23 67.40 357 371 -90 276 18.93 919 174 116 71.22 42 89.41 19.58 2.45 966 58.80 5 672 27.4 839 822 955 444 82.49 460 218 429 321 876 28.1 93.0 12.48 210 83.22 -5 157 82 -76 122 75.44 62.84 109 498 49.44 755 822 4.80 88.30 872 58.90 422 30.41 438 238 87.68 515 728 15 528 -98 86 679 28.47 655 12.69 659 508 39.65 722 -85 691 454 542 856 638 36 37.2 10.96 173 3.37 11.45 55.21 453 12.18 840 23.5 355 23.3 181 10.86 636 948 491 91.30 205 91.89 545 334 40
+* 952 636 87.46 233 552 552 597 34.13 408 10 70.63 36.30 69.65 96.51 772 143 511 215 2 681 408 579 -1 45.2 -98 313 966 34.44 41.90 270 696 888 32.60 928 625 711 540 12.67 39.3 46.46 62.86 35.22 595 80.25 401 360 19.13 34.44 73.66 80.99 696 46.24 336 54.52 304 154 10 561 289 -19 43.81 53.23 295 80.27 19.87 5.71 87.5 62.60 93.70 4.57 957 73.88 827 752 780 938 25.25 787 337 68.8 904 37.77 121 451 39.25 371 79.66 443 402 477 40.27 264 959 43.98 47.66 52.19 -28 28.4 14.92 677 716 14.62 45.41 644 607 69.11 855 671 87 690 183 29.52 -94 83 64.5 22.82 464 315 876 67.75 728 47.19 339 62.96 43 99.29 633 688 26.63 32.24 51 -49 -37 245 2.9 820 -43 714 172 658 864 505 12.16 536 257 94.22 895 80.19 90.79 84.94 868 76 61.14 755 503 931 54 686 987 159
+* 604 59.30 332 5.77 876 65.20 248 637 916 78.57 373 39.49 503 884 55.43 410 1.9 662 21.92 80.67 96.74 990 25.54 978 -33 254 30.47 31.84 238 92.33 486 -61 60.51 110 11.96 224 6.61 65.12 35.23 798 464 460 666 150 804 374 296 52.43 437 832 818 660 50 623 90 197 692 9.98 6.14 90 890 227 255 157 481 102 549 36.37 101 -69 449 -43 360 -73
+(226 59.97 119 -24 848 772 63 115 923 84.66 56 434 146 895 41.55 977 781 995 771 -53 652 956 512 35 590 490 70 -63 596 69.70 64 903 995 456 13 556 416 726 827 105 679 494 24.12 311 488 688 683 604 350 623 -7 498 198 454 27 963 997 287 68.14 853 5 711 276 765 228 631 772 -89 636 811 178 -18 848 461 -70 919 -67 562 867 666 24 957 720 184 957 805 5 759 511 72 43 334 971 -41 96.57 241 986 245 806 899 71.56 41 244 514 447 78 16.79 192 27.51 440 -28 597 439 -51 954 952 24 470 835 344 576 529 170 633 712 98 910 512 799 219 250 716 420 585 52.35 91 894 692 511 734 73 452 70 85.4 221 453 134 115 738 50.22 -53 718 233 270 71.34 -62 677 538 4.75 426 631 508 44.55 699 706 906 467 837 181 327 71.72 789 532 191 56.36 624 56 876 203 51 87 3.59 58 794 539 -80 292 354 497 134 350 192 16 508 173 161 811 99 495 3.35 637 439 354 644 736 346 62 -14 185 -9 393 911 877 857 728 757 764 712 423 90 945 470 335 190 766 423 308 481 487 172 717 2.36 292 -13 584 105 293 54 719 560 75 364 623 836 -33 58.68 423 69.6 -27 579 27.41 662 780 -24 510 205 -11 581 -95 104 98 630 654 254 43 799 701 343 -6 76 863 319 -10 209 311 712 36.34 148 219 756 538 147 103 502 736 264 142 879 15.47 427 318 713 358 85.13 315 52 278 422 680 695 127 672 60 465 428 49.0 37.53 168 91.70 476 825 309 26 37.66 313 286 332 400 463 56.44 -40 818 691 190 571 388 669 25.87 967 -96 -91 321 94.76 16.72 983 408 727 100 337)
+(963 318 839 902 85.10 488 634 290 365 230 248 205 990 146 753 682 6.22 851 842 -62 61 590 224 217 481 374 -10 958 407 356 697 89.18 302 202 124 505 928 864 425 759 -70 149 742 689 274 536 133 261 744 482 166 155 611 149 439 365 535 864 97 929 535 98.14 815 -97 307 75.48 193 173 957 437 249 140 938 441 87 663 123 877 531 666 369 154 345 861 58.5 294 152 233 671 279 181 28.47 392 810 577 87.55 440 441 46.64 255 643 950 543 633 247 798 -32 480 554 483 -23 928 826 126 932 723 408 382 777 199 -93 802 94.45 629 876 286 666 144 747 612 868 670 478 4 -67 705 957 10 947 138 583 428 -60 36 732 567 938 860 152 846 754 31.37 97.47 253 823 30.47 11.75 811 -70 -59 1 428 88.60 47 556 489 117 42.80 432 181 277 46.70 29.3 367 290 788 562 152 160 320 12 765 61.9 344 685 857 71.7 -80 603 22 493 12.11 264 464 89.95 37.92 830 459 957 292 107 199 787 633 494 64 33.10 112 172 687 348 257 999 739 563 738 449 730 460 340 667 778 112 399 417 422 -90 532 928 26 245 378 60.14 534 575 -36 206)
++ 939 52.78 -36 99 348 12 5.36 941 448 32.32 371 174 862 88.8 579 11.0 641 170 975 171 43.45 55.22 -78 -86 949 967 865 511 118 837 239 64.47 779 288 96.35 627 71.9 908 59.53 47 -17 60.57 12.1 553 295 552 349 69.40 44.85 37.73 85.2 783 868 75.58 968 66 64.18 95.96 48.98 -35 644 996 848 -8 47.28 859 732 411
+* 682 62.0 81.60 96.63 328 638 219 94.55 49.86 969 271 442 72.7 443 69.41 496 0.80 725 979 937 389 44 369 4.35 12.61 330 88.68 752 44.95 39.53 3.99 496 97 341 92.84 691 489 897 7.28 75.2 56.34 139 5.54 708 86.96 996 757 -87 98 6 938 798 464 7.61 -64 810 198 76.54 701 362 40.66 793 82 -27 47.71 455 496 617 63.74 14.18 555 11.61 53.60 74.55 871 3.8 422 545 847 28.17 87 735 70.11 4.38 395 194 700 582 95.82 390 71.10 923 238 -94 54.48 8.4 33 939 669 78.25 782 776 131 2.85 9.71 643 365 516 315 53 8.36 84.84 692 976 62 8.41 227 10.83 391 334 323 87.49 30.83 64.75 634 365 845 507 -56 530 -36 591 458 295 436 63 30.2 949 421 639 17.47 423 246 45 30.96 315 40.67 122 94.24 337 54.12 365 15.85 399 323 761 10 155 658 260 210 15.9 74.3 342 0 336 323 83.8
++ -57 97.65 72.52 937 144 26.97 963 408 656 -83 974 825 792 836 913 265 53.33 25.83 984 681 34.3 280 866 18.73 62.47 18.19 439 -25 59.49 324 289 120 702 943 974 118 99.31 416 467 762 285 252 289 44.87 937 46 635 673 77 496 768 963 20 617 0 686 32.1 241 595 755 44.66 620 97.75 641 85.38 55.2 455 489 708 35 915 56.95 724 166 337 -76 938 875 379 -4 45.78 -29 463 413 38.0 834 43.43 125 308 99.37 365 862 897 765 97 937 427 18.50 -1 95.66 211 246 10.5 965 589 953 476 -35 494 95.89 66.53 945 21.51 38.5 65.69 72.56 800 121 52 158 628 111 125 976 68.71 856 348 76.33 660 113 982 1000 549 867 855 58.14 815 33.86 313 88.83 -48 162 54.56 196 579 227 798 87.75 -59 13.32 588 992 71 34.24 47.72 -34 161 837 594 926 1.36 0.87 895 964 840 -91 73.51 699 319 283 1000 298 -35 911 -15 897 992 274 923 947 398 -74 96.24 166 64.95 78.42 206 675 50.61 32.41 295 264 82.94 648 682 969 489 -77 666 436 270 16.68 205 28.84 92 259 482 64.84 151 92.59 264 221 506 725 758 356 589 59.40 123 19.1 75 550 -3 -89 23.19 83.4 82.88 93.24 -66 68.39 87.52 18.73 641 -20 286 97.0 90.93 162 513 91.75 5.80 106 47.40 895 15.74 32.0
+(101 123 153 272 130 238 663 3.16 298 223 147 178 544 938 479 913 -26 104 73 90 97.10 595 190 -100 881 508 266 81 405 146 523 150 859 1000 894 -56 110 465 328 790 6 37.14 -98 517 968 -44 612 198 -40 285 913 653 318 167 158 81.40 743 850 93 771 46 191 536 -62 2.44 822 313 238 831 838 -67 771 943 794 274 24 179 188 605 449 51.96 49.66 554 105 784 166 436 -64 494 280 33 870 599 789 844 890 153 951 31.28 635 509 -58 183 829 303 3 261 2 212 46.51 972 24.33 597 633 646 60.95 399 607 414 507 516 186 -65 473 453 77 977 100 483 501 169 951 586 840 506 740 -93 556 598 38.56 677 37 303 245 30 92.43 229 236 932 478 401 71 670 655 772 -100 87.37 295 -17 50.37 85.80 574 485 441 807 596 198 299 684 654 836 107 150 767 645 705 848 -73 398 596 134 72 73.52 699 276 732 364 311 252 546 53.23 322 482 493 94.27 406 14 862 770 -8 479 585 42.70 104 642 13 704 538 911 971 659 701 -48 669 315 479 782 194 190 28.52 589 757 14 -10 225)
+* 299 813 430 785 861 753 20.20 160 423 422 594 256 33.76 832 276 516 49 76.43 879 45 400 81.97 1.28 137 755 -81 408 -18 572 68.25 689 72.51 529 645 77 24.1 802 981 -43 12 448 49.9 100 0.50 36.67 758 96.1 65.2 -88 879 970 892 418 9 97.75 58.8 191 370 476 438 589 -53 796 314 155 560 9.98 45.86 960 37.47 722 789 45.14 10.52 56.79 368 843 96.25 621 411 582 22 574 396 15.54 22.25 729 30.33 390 815 22.2 560 163 348 770 64.23 823 946 190 657 570 377 2 13 -70 689 73.55 440 41.75 468 909 732 131
+(771 697 86.10 89.86 31.87 42 -56 717 775 803 -20 741 -14 -42 456 -11 939 603 -82 497 576 104 782 356 49 539 673 608 378 441 888 717 325 3.94 866 64.57 495 450 599 66.21 823 34.94 613 403 948 881 252 74.34 -9 476 832 440 946 145 771 997 91.59 350 369 638 824 767 -41 416 -19 390 742 587 976 514 342 952 -84 651 741 808 62 693 -17 809 26 534 168 659 436 487 817 254 64.73 -19 884 966 426 34 472 686 920 13.84 826 142 51.52 165 265 766 -35 596 909 748 376 685 842 773 -43 197 127 240 779 35.61 938 511 107 612 76.52 224 758 991 19 349 -44 757 21.25 943 57.90 211 275 289 902 100 174 699 813 931 143 804 144 138 306 722 851 707 127 95.73 21.71 474 449 16.55 -7 360 851 334 525 98.65 494 -98 642 266 695 594 546 966 958 43.82 166 78 309 315 285 709 6 512 23 198 37.17 378 123 161 60.85 426 987 234 787 21.1 541 945 -28 -3 485 663 34 158 622 416 844 213 219 -23 617 749 761 10 801 800 6.72 667 647)
+* 982 164 827 321 110 46 617 726 28 867 65 898 934 636 144 779 77.26 447 82.59 46.61 51.22 -81 -62 62.90 496 83.42 956 -22 296 -92 753 29 519 320 10 58.81 27.60 936 83.54 30.14 463 90 706 658 221 163 232 694 12.29 13.32 922 -37 75.64 168 124 2.25 50.88 575 75.8 44.64 54.31 477 971 984 508 155 920 343 15.62 97.16 223 360 836 89 985 662 484 -45 587 895 293 14.25 -17 -30 223 513 140 13.1 100 840 761 629 683 -99 99.40 522 477 47.29 831 50.88 607 18.32 875 146 20.48 544 494 395 232 -5 12.99 44.91 665 39.95 175 -66 626 90.77 791 -29 63.34 702 166 355 678 438 -88 399 2.37 892 -48 571 582 -74 24 42.53 230 -79 54 46.5 98.76 13.79 401 96 436 78.71 869 644 53
+(494 31 339 982 994 845 -17 416 750 181 905 902 841 296 56.43 610 733 92 416 302 -25 318 236 37.51 760 899 926 73 525 -41 930 263 312 946 261 214 11 609 230 782 977 56.59 277 987 379 987 355 88.28 570 -1 81.11 119 400 883 977 25 56 240 33.80 750 161 94 4.56 458 -4 4 73.10 80.92 558 945 152 88.8 561 89.38 230 603 9.14 931 578 66.23 -15 12 404 798 93 392 120 -36 126 423 927 147 551 31 44.71 505 390 33 857 366 278 868 14 370 530 -73 43 295 763 672 453 655 577 49 660 873 2.56 639 787 845 90.49 -31 -33 868 614 699 925 79.59 -81 686 778 27 550 855 24 509 103 526 436 244 257 343 604 89.66 367 377 523 553 269 226 864 829 47.68 742 703 10.26 396 908 38 865 844 974 239 394 7.99 866 554 -1 6 -90 282 -47 456 686 -93 -97 -47 273 657 935 832 439 84.1 135 255 147 113 179 920 801 -35 -70 359 298 137 228 979 477 429 550 26.10 821 501 900 605 633 60.12 -37 32.71 945 196 67 195 120 193 255 84.86 866 908 847 935 818 -68 793 854 601 954 434 203 331 609 -84 60 949 367 839 79.7 303 739 126 738 938 65.30 673 762 89.57 45.43 823 443 138 880 226 758 19 303 459 462 66.66 540 73 58.57 542 673 405 -98 939 54.97 230 59.93 704 493 -94 170 266 840 173 811 348 995 681 28.13 79.68 169 304 15.40 117 185 587 833 -81 432 793 754 412 23.81 71 340 446 824 513 915 226 231 812 516 45.60 178 407 33 70 675 395 -3 927 824 261 -67 72 57 649 82.91 733 488 489 912 773 471 284 493 134 576 648 791 874 835 -14 256 89 126 688 487 279 285 336 255 -18 535 660 455 861 238 56.29 80 -13 679 271 402 870 702 555 998 107 597 4 984 139 534 464 505 136 67.66 29.92 825 2.54 765 443 946 97.88 920 799 662 16.17 718 -6 698 939 -59 874 249 25 -84 46.46 75.85 821 490 60.62 93.46 966)
++ 244 215 928 64 904 83.5 63.32 18.49 93.80 21.28 687 93.80 554 183 460 485 252 222 486 205 406 349 383 48.5 344 19.84 668 83.45 525 46 348 64.89 65.96 95.73 193 84.18 21.76 363 908 181 940 3.97 903 -27 260 734 992 69 44.43 94.76 459 188 848 901 71.24 29.26 419 315 622 816 348 596 76.25 56 49.42 18.53 48.88 674 620 -29 119 880 79.82 69.28 363 50.21 661 150 97.70 12 397 70 29.56 84.17 84.81 170 58.29 258 780 -20 712 747 -99 -67 746 734 943 540 101 579 65 2.16 976 325 289 401 56.47 79.92 493 711 87.84 89.10 -74 561 312 76.88 44 672 127 594 95.49 89.99 416 582 201 53.99 867 785 6 -93 0.25 53.5 981 988 288 65 34.79 141 -57 335 983 353 20.79 536 457 18.30 155 74 79.62 71.79 323 251
++ 46.96 53.6 903 519 -47 86.81 4.74 837 730 773 393 4.6 534 57 470 27.49 388 10.33 886 265 608 48.19 16.99 662 84.34 431 70 486 338 -82 50 793 871 685 3.62 20.19 547 435 725 15.56 109 951 108 72.41 964 86.26 375 589 179 18.84
+* 38.9 33.81 18.24 643 699 796 -75 727 81.19 154 387 155 39.30 998 309 -46 12.55 435 958 19.50 873 71.44 80.13 768 774 35.62 669 567 834 518 222 652 -18 20.60 831 740 468 275 495 858 503 57.85 250 13.24 691 641 226 969 62.16 254 -6 759 365 541 83.63 591 873 63.58 295 -3 95.6 34.24 62.59 -64 88 11.46 269 69.39 72.78 593 54.20 152 25.9 650 95.69 49.57 681 55.17 -33 763 717 171 553 412 303 458 83.8 144 382 798 982 21 -88 598 44.7 320 872
++ 139 41.38 296 338 704 26.63 14 4.80 812 30.50 999 11.55 805 819 -72 49.82 -10 384 470 285 449 38 696 79.5 71.56 211 254 41.43 812 119 434 -11 -22 -49 29.34 82.11 679 60 346 25.31 496 253 450 286 97.49 34.47 95 459 96 223 739 571 123 855 -63 416 798 -41 103 56.7 218 987 202 70.74 796 60.6 899 703 -33 -63 -62 14.86 823 763 811 39.88 -42 43.50 39.55 580 610 47.8 177 -40 13.35 19.67 498 687 967 150 67.9 -56 445 375 -21 174 821 180 814 15.13 23.78 44.66 930 74.25 244 330 28.88 422 854 946 43.16 75.84 43.20 78.27 8.39 360 46.39 825 -83 79.93 992 366 90.22 84.4 371 534 90.21 467 56 328 968 453 0.56 10.33 980 475 27.0 241 96.12 895 99.53 303 73.18 14 48.22 -59 53.69 850 21.66 73.59 -35 207 71.79 782 617 584 658 2.6 791 909 8.58 58.56 577 26.86 80.80 92 733 127 252 136 269 394 3.37 462 221 445 858 108 741 138 848 6.11 221 60.29 794 635 869 588 578 -13 8.83 53.40 49.63 371 204 248 -42 291 348 98.15 52 -5 76.77 79.75 459 785 87.10 24.41 -47 75 75.11 87.32 370 637 671 84.38 567 700 132 686 24.92 -82 56.29 853 604 -27 578 68.90 93.58 363 54.67 8.37 520 627 817 354 5.17 776 808 274 810 459 28 47.44 12.86 315 914 464 -81 92.42 745 754 478 251 227 577 246 287 205 17.24 66.94 49 95.74 78.56 95.40 119 85.31 137 167 14 72.38 56.61 432 99 943 37.72 98 75.91 824 22.37 50 357 836 827 192 866 49.56 -96 845 98.94 259 74.89 179
++ 950 705 68.63 516 805 290 648 840 11.10 649 78.23 683 554 495 359 20.68 95.47 59 64.23 30.84 -30 781 66.37 805 -32 489 982 -7 122 889 62.77 420 552 227 117 94.20 -72 318 771 30.23 7.50 233 297 937 834 62 68 60.29 693 96.99 729 124 783 797 679 48.62 34.8 255
+* 56.27 127 182 187 45.15 809 -62 725 839 54.60 32.72 430 62.66 88 924 -81 613 131 52.13 48.65 409 117 79.86 928 107 651 157 908 100 197 936 91.72 57 338 761 444 40.8 93.17 700 0.75 176 209 545 619 72.71 905 856 20.53 528 231 750 806 11.33 313 180 448 4.58 94.95 893 431 529 -43 686 15.29 2.51 -10 915 38.42 93.45 -87 6 33.66 70.9 54.80 646 317 345 201 364 -56 501 23.92 224 461 273 7.48 958 57.42 430 975 11 337 864 33 42.48 -55 525 67.49 551 487 999 459 547 657 -66 907 429 670 274 71.15 536 35.91 478 720 562 9.91 772 81.22 210 577 764 221 175 469 99 33 970 -14 697 682 52.78 14.88 74.28 681 642 84 22.91 777 413 60.9 507 365 6 69.6 735 93.66 374 570 106 59.4 71 274 30 83.74 369 339 490 54.53 264 -8 568 -12 -93 954 522 9.91 16.3 4.19 84 586 420 849 813 86 32 538 179 997 494 938 -57 -49 416 556 3.42 123 927 500 687 12.25 119 21.26 33.71 368 932 77.40 603 815 277 609 901 7.44 972 481 294 199 -34 80 772 76.52 87.31 568 788 48.11 109 98.0 33.80 203 19.1 949 -26 91.63 571 90 576 285 481 532 28 590 666 -86 145 -41 25 -64 162 731 174 596 12 46.31 59.4 0.20 61.61 760 812 770 83 6.79 35 83.19 788 260 67.43 598 817 25.33 36.73 9.84 29.83 601 -17 993 28.82 475 62.36 20 723 590 79.88 938 319 376 86.10 645 53.34 717 0 507 29.3 24
+(657 65.18 261 594 404 407 74.81 217 48 60.15 293 904 890 221 113 109 225 386 914 24.78 645 91 30.80 777 965 779 504 361 60.45 820 410 902 50.32 179 326 645 3.25 30 66 171 61 464 17.61 110 787 217 185 922 79.23 -81 462 13.37 688 897 287 932 561 136 155 788 17 -76 -44 361 819 60.18 47.88 33.82 854 479 -15 40.32 411 231 754 280 805 531 635 354 327 769 556 284 553 868 506 222 805 36.70 604 635 728 -19 368 643 616 592 101 984 27 448 416 615 584 114 43 11 325 67 114 774 826 630 833 104 203 959 408 92 567 189 95 7.56 881 1.45 497 31.71 17 679 577 58 327 674 394 331 779 447 536 636 193 38.66 641 27.19 79 16 876 163 330 -19 729 825 173 -32 42 -24 70.36 46.66 166 160 949 358 913 584 934 890 8 376 881 727 -76 884 288 729 189 -20 807 413 656 80 589 198 303 456 844 350 790 188 374 532 68.60 801 500 464 998 955 -90 976 973 26 295 798 483 978 33 627 626 587 371 35 619 557 3.97 4 854 874 3 863 870 25.31 132 593 925 727 303 157 606 778 455 687 64.87 966 703 133 798 548)
++ 851 33 946 698 607 29.10 464 52.57 -69 700 696 673 9.7 833 102 58.76 15.60 555 942 76.8 196 501 483 143 643 161 26.68 384 63.22 -29 17.87 906 420 78.45 300 38.41 -30 305 246 650 -31 302 169 217 -96 321 64.96 63.8 738 202 464 724 80.45 900 996 151 239 15.87 -41 5 278 661 63 497 248 616 6.65 479 58.52 62.69 245 950 402 35.47 84.18 320 74 922 695 14.93 20.60 784 -56 208 32.15 541 17.8 10.2 146 33.8 698 558 930 3.87 31 453 15.48 76.39 581 59.0 346 864 961 274 247 399 803 -50 659 38.18 35 149 90.40 86 147 617 440 411 934 317 13.51 71.66 532 40 23.8 688 75.85 -91 142 17.92 698 756 861 -49 73.24 29.92 340 522 650 538 599 898 56.13 739 73.88 382 91.33 691 68.81 68.76 -97 303 226 415 76.19 -61 949 2.14 611 57.98 14.6 66.78 388 274 61.12 232 716 379 288 49.72 261 109 944 993 58.30 492 73.2 626 334 79.96
+(791 595 870 42.91 487 172 909 92.47 832 220 6.92 379 974 6 785 541 403 260 69.60 825 235 450 416 42 -96 120 911 810 689 5 738 209 429 470 -76 778 646 8.55 217 630 611 646 809 809 952 233 -85 45.53 548 399 85.32 92.35 317 223 820 873 640 339 260 299 413 165 208 -75 60.8 25.62 54 150 969 397 603 291 582 922 59 483 27.97 27 985 -87 89 133 844 377 569 573 53.17 404 -48 400 380 302 967 370 973 70.20 987 595 931 66.68 78.42 43.52 726 274 7 30.50 -22 973 501 986 -9 122 497 453 339 832 390 420 -17 -82 829 -78 122 100 858 42.58 817 -59 254 42 764 272 652 478 72.1 162 139 938 39 787 867 39.10 559 915 417 52.71 939 424 327 941 51 615 533 28.37 485 334 69.8 864 375 731 359 -46 245 515 560 361 169 60 -40 273 549 184 886 230 747 981 128 858 29 288 112 938 99.45 556 40.58 996 536 138 309 592 708 33.37 42.58 898 520 598 893 72 854 618 -18 384 83.0 68.95 610 286 521 -55 227 470 -81 968 506 547 9.25 182 -60 385 9 981 806 32 363 509 668 102 75.14 175 62.55 964 635 862 767 966 252 913 413 256 964 33.18 -82 621 59.61 824 -34 55 954 837 777 -72 754 137 -62 -58 985 149 843 529 593 580 491 925 -78 904 319 11.71 964 171 735 91.36 14 922 524 243 97.50 507 895 931 617 399 602 869 329 629 816 387 983 -37 605 417 73.3 865 461 408)
+* -95 96.17 152 381 827 -84 219 182 993 870 270 788 81.45 54.97 96.67 3.49 915 846 185 50.24 891 725 197 69.42 865 21.65 -61 446 357 83 503 283 8 996 81 69 112 513 168 555 915 -51 14.4 25.28 227 486 40 157 1 70.76 92.9 775 -58 784 822 67.66 202 353 3.9 10.69 622 47.96 431 62.2 75 917 34.61 2.98 273 67.47 61.31 307 42.97 209 2 846 52.77 68.91 925 254 107 791 28.76 698 33.86 477 32.26 17 311 191 220 528 71.26 14.2 531 985 -78
++ 246 922 788 1000 906 43.89 840 -53 838 736 562 252 875 25.9 52.87 19.5 57.50 898 708 614 323 98.37 849 804 678 374 688 407 775 0.33 910 739 417 79.44 -38 241 74 154 84.47 263 188 154 729 87.70 90.34 861 348 384 10 59.71 221 689 86.13 11.29 -31 77.57 541 9.22 8.9 -51 896 53.69 382 535 850 136 988 878 938 -81 14.9 630 86 2.85 766 886 107 696 680 25.31 833 15.5 517 -49 76 56.58 47.31 52.33 39.11 97.47 997 259 186 77.87 20.46 0.79 633 719 15 60.45 841 12.16 962 71.58 35.12 146 757 11.1 9 24.43 182 819 -56 93.41 -24 735 71.84 75 687 69.39 435 36.49 636 240 84.93 69.25 884 605 77.29 48.16 130 69 722 69.83 267 678 649 860 687 830 852 642 966 960 735 192 48.27 522 675 967 6.42 90 184 668 153 221 6.46 559 561 971 68.28 670 816 85.68 50.2 833 18.46 64 865 243 101 90.68 25 567 23 386 401 24.55 391 596 -3 72.93 144 98.21 93.18 246 50.30 900 86.80 76.28 162 396 35.2 587 400 794 411 685 779 19.74 769 670 -65 818 84.49 331 72 67.3 28.82 739 99.87 36.8 402 409 227 27.25 426 472 804 66 589 98.67 799 2.98 835 360 87.97 90.95 -67 114 50.39 29.77 10.42 364 42.71 24.88 85.54 -74 67.9 992 693 76.7 86.6 693 39 315 71.94 80.3 710 14.86 537 745 333 -21 800 885 593 306 697 895 810 93.38
+(-67 945 318 934 308 661 517 -41 731 834 634 251 549 622 -85 -22 713 -67 790 -59 580 -53 72.91 -94 71.95 709 757 108 833 166 639 582 60 918 381 432 848 205 96 546 907 777 83 507 666 125 -40 278 947 428 890 520 911 363 629 181 928 87.67 339 24.84 -22 211 -19 16.99 958 493 748 -8 254 384 914 808 932 -25 44 410 209 840 993 995 76 276 724 875 186 384 366 985 488 538 86 549 653 838)
+(70 -79 424 533 45 294 149 47 347 29.19 87.67 672 -19 112 705 -78 896 26 679 620 37.95 16 770 5 489 610 175 250 186 227 54 765 785 481 874 452 404 546 558 649 348 922 306 651 283 324 81 128 417 799 785 178 272 834 -35 575 806 49 563 756 921 209 788 787 483 464 852 275 176 560 698 994 922 114 982 411 355 329 783 37 456 646 838 54 459 645 704 4.78 830 532 65.36 191 416 566 405 176 352 176 730 894 20 831 944 590 353 791 51.79 32.73 469 233 104 -78 440 4 53.96 892 -91 754 -50 736 376 430 74.57 229 226 260 740 -60 731 833 665 513 63.98 985 50 750 210 471 962 59.62 832 506 244 997 442 863 183 926 458 48.41 578 657 775 803 78.81 854 453 82.80 342 506 947 381 974 61.11 -28 192 145 14 426 883 407 806 374 477 -34 739 975 64.86 188 114 102 923 713 825 967 410 629 404 240 238 -82 866 894 990 269 935 23 796 17.27 82 430 373 400 -61 44.38 167 93.75 86 272 749 287 432 424 205 553 141 932 22.0 335 80.99 107 -74 741 39.78 129 509 564 871 -76 966 40.60 286 111 592 640 273 608 -86 363 718 937 557 -83 966 646 97 867 794 205 364 479 744 516 52 288 509 809 686 416 -74 66.92 514 773 648 669 11.18 9 414 683 216 610 277 829 21 956 44 495 390 23 549 283 723 -47 545 88.99 588 196 51 -82 911 523 43 309 80.8 782 456 769 394 795 75.12 548 791 232 908 130 932 423 523 678 385 223 900 76.37 772 890 95.52 470 15.33 6 78 355 309 201 242 945 9.27 894 -14 788 400 764 606 55.47 694 -49 254 75 385 806 -99 349 80.24 669 -25 500 903 617 81.69 957 276 7 247 935 384 526 819 656 709 406 521 10.73 917 938 461 221 655 825 249 6 75.19 668 544 684 871 46 553 849 70.58)
+(981 124 317 799 344 489 110 463 430 509 851 457 796 315 816 172 83 960 243 889 268 680 558 53.3 75 589 716 67 -41 645 110 14 4 -40 890 280 284 -64 34.93 337 -51 770 379 182 399 133 86.79 922 827 32 685 -87 125 87 -15 61.23 307 -35 26.42 64 20 -80 93.44 647 13.95 983 16 283 439 168 442 313 427 331 71 519 -86 955 315 -67 49 186 765 -70 890 439 370 81.92 147 811 -73 899 679 524 305 291 618 842 348 42 939 -7 716 319 884 568 2.40 31.92 99 130 880 489 624 823 381 244 393 34.84 786 -93 383 162 167 822 959 166 519 -67 901 42 23.72 441 745 858 633 462 626 973 804 4.28 197 497 241 498 345 397 371 25 492 239 668 3.96 307 592 904 -46 827 2 88.22 704 71 785 90.20 139 978 517 402 29.45 170 747 -29 903 369 281 837 800 894 429 81 93 -84 921 704 535 39.31 38.3 981 532 653 313 846 423 283 477 68.89 937 354 274 587 211 0 85 636 653 730 876 285 177 960 389 -17 958 374 642 -83 41 -8 42 697 686 192 488 276 583 149 905 162 369 605 882 474 507 280 623 443 469 821 363 758 487 920 -95 902)
++ 214 832 11 57.96 3.54 941 97.18 196 941 944 26 996 102 38.69 536 573 89.8 91.22 742 21 68 71.23 145 224 540 58 781 193 84.74 561 830 659 713 71.60 984 810 64 885 478 132 808 55.25 80.68 435 212 806 236 962 53.8 355 -3 702 89.80 216 -41 559 736 35.11 192 76.93 16.30 49 87.10 10.44 601 422 600 140 39.27 203 15 682 159 614 24.32 53 521 180 284 36.19 622 177 758 61.82 52 61.50 29.50 118 -5 16.39 29.36 58.83 211 63 115 -27 489 705 3.12 60.15 -23 490 220 -30 455 11.44 11.96 903 66.53 606
+(85 393 716 690 592 482 669 -90 749 227 366 899 248 37 862 50 313 741 491 140 140 18.87 6 485 883 982 319 -60 870 83 5.93 872 136 951 -97 847 7 427 -88 -40 555 771 77 -75 214 -11 216 340 900 931 590 529 494 398 979 165 270 619 703 321 20 685 914 949 478 327 77 -79 120 76.80 620 51.15 438 936 788 885 394 361 118 23.6 13.14 976 139 614 947 472 295 350 426 -78 763 -72 -28 379 217 202 329 239 665 548 917 852 582 549 8.69 996 -6 722 803 897 852 933 288 949 929 916 -20 770 585 669 535 396 -63 34 912 -84 67.9 511 427 -95 26.8 -88 46.88 659 519 557 500 576 40 29 804 517 824 100 305 635 947 687 373 649 733 289 775 97.91 -57 -86 30.73 943 95.65 383 472 529 641 536 538 545 54 219 583 354 926 0 681 609 -13 58.28 -34 23.93 621 845 97.38 73 943 471 -63 594 932 646 567 327 350 447 716 45.45 84.50 667 124 386 548 638 552 149 231 865 55.89 931 316 696 -2 83.23 889 858 90 516 912 -66 106 481 -54 21.43 956 212 849 124 -55 -37 827 403 608 648 311 417 -100 96 842)
+* 752 368 8.79 623 554 16.90 42 491 432 115 321 21.2 701 37 548 63 61 944 542 38.59 -36 51.23 5.9 910 59 477 -24 264 72.28 -65 474 850 -62 4 909 557 26.73 404 95 41.75 225 10.65 997 -83 19.87 32.34 710 742 62.1 3.69 872 360 91.5 184 832 395 137 107 678 545 -52
++ 913 924 708 20.45 76.24 85.91 2.18 53.98 191 27.65 20.71 32.73 548 815 206 357 48.10 329 131 52.22 40.96 16.47 553 6.72 703 508 85.52 78.63 -67 347 48.22 45.42 32.19 125 110 630 627 523 72.93 41.33 0 516 917 200 515 78.64 775 121 809 -73 -75 11.70 4.24 47.55 845 549 52.25 222 473 627 -41 561 981 948 548 393 854 642 140 173 924 95.37 14.20 24.99 337 -76 38.41 30.22 97.79 36.17 -31 12.62 571 37.24 61.9 522 -77 399 125 4 347 98 24.48 628 203 7 312 46.86 745 744 387 775 171 -47 671 931 4.85 56.74 462 27.86 -85 503 632 581 723 360 220 74.9 37 80.0 39 73 -42 88.67 62.59 136 588 962 796 794 10.91 479 428 607 637 338 885 587 981 68.9 68.14 -72 270 649 458 548 287 699 57.13 523 71 5.33 661 39.7 437 414 332 22.73 67.22 103 75.32 169 358 4.83 -32 148 87.77 70 277 219 787 70.32 610 78 870 271 15.71 342 344 61.44 309 3.79 140 996 68.47 723 99.56 446 117 288 92.70
+(881 232 941 699 154 724 88.85 716 204 480 2 8 144 -16 67 117 903 2.37 916 861 512 665 848 162 30.72 15 752 155 546 33 824 710 915 424 51.49 4 592 972 487 539 178 19 938 496 354 499 252 263 751 810 386 602 547 88 335 81 48.68 744 -52 700 567 979 753 906 29 47.83 933 275 383 522 636 986 871 2.42 68 707 260 725 276 80.32 70.34 927 217 610 538 248 93.48 867 292 276 -50 131 357 607 861 -80 297 634 553 419 787 339 956 27 44 969 548 792 777 5 536 562 138 -87 450 556 432 960 328 593 817 637 455 453 94.34 851 860 827 -51 184 836 50 -51 483 425 63.76 871 125 975 603 644 134 237 91 959 21.99 567 552 67 130 646 537 403 119 868 996 796 -8 856 48.79 575 302 152 383 970 732 28 343 780 680 13 597 -18 240 154 553 462 63.53 938 406 -45 575 760 95.62 420 60.55 682 211 595 372)
+* 23 22.1 807 698 41 919 665 592 172 869 27.29 150 213 392 30.81 -53 43.23 753 878 32 112 33.48 372 61.50 80 345 475 146 204 257 884 142 327 55.81 48.29 120 -89 618 4.99 411 708 90.62 428 339 -87 897 319 174 44.9 38.71 595 757 130 23.7 33.0 28.86 10.40 559 531 8.18 52.62 89.0 491 38.31 106 43 47.67 359 2 744 375 47.10 -26 59.23 47.26 72.14 364 15.52 757 750 34 582 91 16.83 349 218 545 188 81.21 915 711 979 883 171 75 625 370 327 825 836 -67 936 493 65.53 865 358 341 350 574 279 6.26 234 38.69 97 33.53 82 68.75 365 27.67 491 340 175 303 128 35.12 281 580 115 411 44 -15 -48 78.89 719 14.67 -59 -25 64.75 38.82 43 129 48.18 419 30 -58 53.99 497 61 -63 653 576 77 29.32 43.28 355 430 174 959 220 90.78 396 91.61 242 778 34.56 76.97 93 240 805 307 60.89 32.1 36.67 -18 88.21 627 488 90.34 681 828 32 891 541 221 169 49.41 791 13.33 -91 94.47 347 273 1.30
++ 938 39.25 515 769 75.83 54.73 8 487 454 50.52 517 655 59.12 211 3 17.67 468 159 446 579 -16 251 954 69.2 62.74 448 6.1 42.55 890 3 92.55 671 175 213 135 732 971 247 785 829 379 924 554 284 870 85.25 546 86.51 88.58 40 553 -52 95.47 840 267 47.62 86.72 449 -23 200 356 66.63 5 969 687 880 380 172 18 113 638 225 18.23 17.51 84 635 50.79 987 322 78.73 63 19.26 285 -23 61 454 730 890 65.44 -53 91.26 495 883 62 60.29 75.92 215 95.56 66.27 894
++ 491 878 395 68.67 97.96 814 660 665 191 51.33 184 38.14 873 403 81 -45 516 356 298 45.28 575 638 57.23 90.96 747 81.53 501 -96 191 907 749 -4 77 90.2 74 -92 20.27 226 90.39 88.63 431 780 586 181 538 252 50.28 238 74.48 243 364 898 88.68 346 1 678 839 62 12.45 841 7.67 744 658 43.73 991 29 311 217 78.21 662 19.83 77.42 10.40 248 990 8 753 67.52 80.40 835 333 278 90.79 444 249 787 67.79 743 111
+* 294 -31 813 245 457 265 85 292 46.10 668 34 999 56.20 279 55.78 707 244 723 52.45 139 463 505 -80 327 98 755 86.78 310 877 343 509 59.3 19.5 767 508 987 645 449 89.89 19.16 516 31.84 305 60.1 610 232 33 184 354 23.35 99.66 503 919 25.67 10.52 31.96 82.96 63.35 -48 14.25 19.61 -59 269 111 741 925 695 27.80 579 184 938 383 958 561 401 -83 700 506 309 -53 376 123 998 383 840 346 427 545 399 295 444 407 303 570 705 977 522 93.66 228 444 83 260 -91 706 533 732 671 249 924 547 61.98 95 91.26 709 363 917 89.83 556 631 589 34.80 35.22 756 39.40 39.15 83.71 45.98 447 73 123 -50 519 249 108 549 -29 980 81.93 363 630 62.18 497 631 661 224 53.71 92.40 418 921 6.47 87.10 -55 776 793 912 148 -3 59.51 57.43 639 806 508 112 287 682 88 21.45 22.17 365 714 73.83 60.81 856 411 829 879 102 99.99 676 2.60 26.67 415 854 588 81.6 432 404 460 23.27 513 270 563 73.51 218 -88 444 -89 658 358 -75 94.52 46.62 468 941 29 171 93.95 60.90 62.51 962 418 52.44 79.74 25 481 917 419 97 765 468 707 43.13 785
++ 26.46 367 117 53.85 -32 814 -50 91.87 46.28 83.89 287 46.19 215 189 403 7.77 393 976 96.70 906 620 829 118 256 -64 20.54 799 87.96 50 427 3.49 37.68 928 85.3 193 299 779 551 2.40 68.36 27 22.45 59.99 8.77 509 210 1.97 491 117 -24 58 25.83 36 31.46 59.51 467 561 838 -97 373 481 699 334 278 76.61 147 431 53.38 71 279 145 70.65 154 -69 -80 14 31.74 -74 109 -39 377 457 406 335 767 826 34 845 76.62 33.40 47.69 931 -12 32.51 482 324 864 19.41 945 39.82 35.41 20.25 11.27 -26 75.27 686 952 179 254 53.12 36.24 479 570 816 206 43.26 989 426 39.90 -14 67.25 308 900 55.70 19 60.58 69.94 703 -19 -46 25.47 520 511 865 416 66 -54 401 75 12.64 33.75 205 108 69.5 660 938 562 75 256 205 59.55 778 365 382 67.55 35.54 711 83.82 68.52 1.30
++ 921 731 12.89 422 59.55 373 851 64.16 291 514 478 178 611 57.33 243 70.73 343 553 -73 64.32 25 162 569 58.9 88.3 484 58.40 728 131 -4 49.49 23.56 171 54 -25 951
+(69 75.25 149 31.24 596 286 874 165 787 926 46.94 876 84 692 808 969 599 806 21 392 682 173 52 281 112 89 954 571 37.27 276 93.15 94 274 244 431 858 84.40 478 328 215 634 500 465 340 275 855 124 576 -40 452 7 69 844 338 400 -11 950 549 347 334 877 484 36.85 78.38 810 553 900 -22 892 567 1.0 507 53.12 236 204 366 693 127 855 488 312 927 827 -40 529 613 -81 326 540 -60 366 -89 111 232 382 626 209 241 659 5.70 -100 603 694 663 363 92 19 92.12 617 703 68.75 79 528 -67 415 580 507 440 806 369 674 57.50 68 567 851 9.44 612 53.31 588 787 580 466 693 606 950 29 726 178 328 552 68.83 83 160 432 104 761 985 -50 747 88.73 296 31 457 707 987 737 222 808 87 799 746 91 138 82.5 537 68.75 759 -64 85.31 2.68 225 455 277 81.48 8 499 697 45.96 375 941 83 694 8 796 804 924 908 874 421 -99 237 269 76 981 201 -87 879 226 793 971 529 844 724 -12 978 946 231 975 801 507 632 153 868 55.21 679 259 180 776 612 588 439 639 935 450 16 607 110 385 643 409 85.65 679 654 327 930 770 112 255 68 772 572 674 871 825 156 -7 618 121 404 371 863 645 -13 508 31 633 -81 778 1.63 963 670 466 69 777 945 295 -37 425 408 441 60.2 863 84.24 79 129 693 783 695 65 803 459 717 602 511 -100 25 -82 28 211 -92 279 15.15 -84 997 -91 -18 530 206 747 474 532 443 880 501 619 189 241 29.79 569 -47 746 408 342 760 943 314 862 43.58 883 74 767 486 953 959 451 62 357 100 559 249 718 31 428 649 -40 505 832 36.86 12.62 365 85 248 761 368 968 594 -27 3.12 657 508 611 565 639 -72 218 90.49 563 474 -93 -76 549 218 961 136 527 772)
++ 89.88 879 43.14 925 71.80 399 60 265 360 755 28.47 75.79 -76 553 24.68 248 82.93 72.15 928 556 893 525 977 63.67 20.56 963 670 -10 40 45.15 123 223 348 80.64 343 64.62 49.31 207 929 82.75 116 428 897 840 68.52 977 6.88 541 42.22 9.67 73 -62 -51 -98 402 173 872 100 253 354 79.39 908 933 390 -24 -15 934 655 276 44 51.80 94.21 861 71.72 65.71 156 86.16 402 788 764 934 459 909 396 24.25 166 22.35 -37 228 482 65.86 333 161 901 443 403 493 6.42 36.7 -90 331 483 301 825 663 22.83 253 231 866 650 77 178 264 938 12 27.54 80 74.72 326 27.75 809 473 493 228 53.83 -95 823 758 815 726 83.85 0.58 62.13 82.47 219 405 70.79 547 65.94 -95 160 9.12 672 623 454 475 912 566 643 29 375 43.35 553 997 28 39.73 822 665 -83 766 659 21.43 212 926 367 762 72.61 492 -51 834 820 304 605 12.66 830 84 87.76 786 -21 66.54 604 89.84 625 851 118 224 66.51 237 631 606 99.85 401 727 383 69.0 84.0 253 162 468 -16 15.11 750 80.15 33 65.34 598 293 359 960 18.32 36.62 715 33.55 42.78 14.38 807 109 315 460 12.98 288 811 -86 291 0.93 114 362 606 902 61.61 132 491 10.49 556 301 636 78.96 993 -37 298 556 778 92.68 311 546 39.70 -6 246 389 466 621 875 -12 186 254 63.44 302 526 14 22.55 -78 992 342 969 62.92 444 129 726 561 65 33.45 28.22 152 81.65 130 225 162 572 110 678 577 208 344 277 14.55 310 446 15.67
+(20 2.50 976 716 448 16.71 341 7 73.23 373 213 264 911 18.91 916 243 54 826 151 573 731 810 683 -13 138 978 391 737 227 955 325 51 803 325 88.24 47.48 66 727 893)
+(828 998 293 99 399 -63 165 77 907 216 -87 328 104 673 190 491 78 -69 163 37.66 732 24.31 253 656 27 734 751 786 -81 732 761 -6 183 807 328 732 264 39 477 20.69 46 606 674 594 68.22 -80 461 351 75.16 -44 472 986 102 336 343 857 870 29 -63 890 466 186 254 73.47 -79 115 53 480 933 160 52.68 884 462 994 30 234 966 274 26 -15 50.91 654 643 33.62 226 476 781 757 976 496 587 -85 633 49.64 -4 109 175 731 704 4.58 640 926 313 748 170 254 151 588 671 422 407 919 31.52 -24 357 811 856 26 934 995 64 35 687 310 79 43.48 237 822 169 81.83 949 265 142 29 602 718 757 130 353 990 373 70 544 -78 950 877 -74 19.47 981 250 707 96.41 382 41 134 251 50 175 3.80 185 980 287 897 757 204 354 6 -76 317 561 189 -17 182 92 521 729 51.34 948 222 789 247 258 -56 449 -5 281 81.21 786 171 238 905 578 976 903 362 7 23.49 -27 998 499 -81 579 364 439 989 262 1 547 523 387 573 344 177 680 47 653 -35 38 844 293 436 582 -70 202 21 746 313 945 -75 675 409 873 367 592 -15 21.17 20.90 833 757 110 -97 901 20.61 -58 376 275 20 85.4 -76 124 6.6 255 244 -93 985 115 494 931 228 484 60 706 476 627 650 354 1 82 519 258 5 308 965 28 985 574 729 443 496 702 539 424 214 -52 -53 95.37 100 38 24 -48 840 421 -78 123 341 -36)
++ 22.26 44.63 45.15 151 412 952 10.84 93.30 -81 850 116 585 206 889 518 103 109 283 307 191 81.37 73 307 554 211 525 94.3 555 80.49 17.11 808 97.96 184 763 5.71 512 60.53 900 941 979 222 920 346 91.79 966 218 948 73.83 231 626 558 -40 131 352 586 32 298 45.16 92.64 890 55 380 30 279 740 75.57 404 46.57 83.47 562 768 -94 439 110 0.68 2.62 43.20 727 97.94 575 67.46 89 81.96 -64 298 87.14 879 40.59 24 59.13 14.11 532 833 7.25 689 -82 211 867 33 458 589 25 594 120 445 88.40 -38 81.13 701 99.28 680 1.3 -87 86.44 249 -12 225 0.79 995 949 371 37.75 942 735 443 84.99 130 36 4 195 923 530 97.52 302 0.96 333 -56 14.42 620 212 108 14.4 909 75 33.86 19.89 712 18.40 381 267 151 236 23.6 562 527 24.35 48.91 753 472 340 52.47 712 307 3.92 -21 86.61 578 820 64 23.71 24.35 453 2.88 11.39 17.93 610 24.77 483 495 127 140 82 67.32 52.82 76.50 394 724 756 11.24 192 -92 632 950 66.26 27.34 446 57.36 928 256 60.99 730 197 926 -100 38 200 623 77.6 759 96.38 -47 -55 -24 590 109 921 324 85.36 -61
+* 531 503 165 22.43 88.94 829 75.71 40.58 266 54.20 508 -62 219 54.76 644 620 33.34 77 858 15 638 2 -97 810 26 400 62.27 135 -86 309 83 951 972 34 685 704 696 8.86 2 15.64 876 20.98 75.98 153 8.78 319 67.50 87.11 896 649 -63 643 710 774 503 916 9 18
++ 843 85 23.8 62.7 501 698 33.85 834 307 183 446 362 665 627 470 -40 494 -44 122 92.30 757 614 75.75 421 50.84 434 74.69 787 346 48.20 2.28 589 445 145 659 85.22 67.97 89.18 90.3 846 50.2 885 156 6.39 42.50 179 22 216 501 469 13 146 967 256 271 367 680 15 750 -21 21.94 43.96 905 38.75 292 667 15.60 883 968 873 397 153 633 75.67 401 907 427 38.96 301 346 509 151 79 3.22 521 73.33 198 808 7.8 837 44.49 250 61 758 -63 -28 692 950 26.66 979 72.58 306 938 63 805 43.23 117 96 76.99 935 -50 26.74 826 450 26.37 659 26.67 933 265 805 135 59.41 78.69 136 68.1 84 -82 121 218 513 101 70.86 4.13 84 480 87.98 303 769 12 58.5 316 54.17 815 758 740 307 56.63 730 86.32 198 882 659 76.47 722 753 711 19 195 -62 820 664 347 28.43 27.56 -20 66.40 327 473 64 53.66 910 9.59 57.19 10.7 146 492 851 112 13.21 63.28 69.9 491 69 43.2 59.97 42.82 835 253 551 533 692 20.63 44.71 200 38.67 192 -86 943 679 245 332 385 739 411 594 192 603 550 261 700 813 5 -18 323 882
+(201 44.39 59.94 264 262 718 374 723 20 52.66 56 775 21.80 95.8 117 627 530 905 384 537 484 365 737 936 16.21 -6 344 856 87 447 117 60 863 77.47 150 34.51 602 235 126 38.37 895 744 123 485 444 -74 62 750 106 526 659 544 642 547 949 157 546 617 201 103 62.82 564 247 299 716 822 503 622 659 548 783 963 587 -2 -38 845 675 223 675 64.17 570 450 16.6 526 348 135 19.29 -65 301 14.8 696 405 739 735 986 311 464 155 390 76 67 420 720 40.53 448 745 520 421 679 433 35 -72 -71 -9 327 -24 739 83 92 844 426 39.35 435 720 210 532 8.39 893 593 349 26 451 398 227 808 -22 746 224 288 -50 -70 -52 890 484 153 812 1000 12 379 393 381 946 340 104 83 482 561 43 323 25 -45 695 581 57 63.3 711 673 -87 983 164 115 396 223 569 912 45 44.94 494 84.88 768 50 628 549 675 798 -95 515 151 767 679 91 45.26 548 522 742 782 813 774 -80 59.71 143 -76 399 768 -15 885 70.30 -95 106 45.62 885 68.28 87.84 526 -59 413 672 90.79 373 -50 303 209 162 411 455 47.57 25.97 415 856 167 698 541 883 657 559 489 678 49.55 90.55 893 34.26 729 351 569 833 572 971 -50 943 764 865 729 29.94 44 964 85 589 922 398 377 580 668 370 551 774 58 686 542 343 250 214 303 594 369 691 578 -32 519 189 197 855 56 935 86 721 -23 954 853 982 181 65 993 98.63 758 46.32 962 775 965 -45 340 40 -83 25.46 115 534 273 579 629 453 106 165 984 558 109 -25 73.32 844 718 204 118 86 90.33 -53 496 83 4.21)
++ 501 884 79 350 558 64.35 111 941 75 14.78 210 522 69.90 311 379 54.46 822 42 43.16 -91 215 808 103 835 -44 22.68 44.99 601 827 75.34 406 89.14 65.73 403 -31 563 420 49.3 711 326 -78 70.78 -80 41 265 567 98.55 745 77.68 231 607 50.40 91 40.71 88.33 7.73 67.34 55.91 -10 23.39 923 859 24.98 31.85 232 80 65.4 227 354 -27 339 603 838 -8 17.10 584 150 549 774 832 24.56 -1 182 858 892 575 901 37.53 84.60 -28 178 94 577 99.47 347 967 574 839 203 83.45 658 202 829 791 383 522 96.16 293 249 302 86.63 16.3 490 3.1 27.38 50.23 923 173 910 22.35 304 57.21 443 990 439 62.49 198 208 652 529 490 916 692 908 412 387 -94 798 54.18 98.77 707 121 440 466 691 559 717 685 583 749 85.3 189 93.40 30.93 52.14 188 362 66.42 533 511 71.36 239 467 554 5.47 619 37.10 845 150 -76 20.93 37 663 798 954 48.89 -89 969 535 973 140
+(-39 93.64 772 -11 -73 217 919 195 -69 386 923 820 505 249 30 58 280 510 379 186 546 177 26.4 7.36 748 912 882 274 937 963 941 599 -39 559 865 303 234 69 119 -17 925 414 633 66 994 299 5 304 49.69 -97 414 716 96.35 147 91.29 930 688 822 742 531 -31 36 519 257 549 466 -49 126 783 943 -33 132 4 195 944 936 -10 704 82.20 242 -37 928 234 903 178 161 144 160 906 -91 273 991 332 138 65.85 616 434 1.95 646 129 943 334 547 481 806 829 691 44 83.99 62 428 704 343 781 64 177 801 841 206 964 936 76 273 772 800 506 500 513 44.34 745 303 146 264 530 386 -34 222 567 470 62.37 91 254 219 579 226 95.60 -69 206 793 94.31 856 296 968 566 199 544 -86 95 -48 244 714 654 728 221 11.60 -66 64.14 555 334 403 39.91 922 -56 69 280 12 951 464 2.59 172 -73 -8 593 15 -98 457 202 85 291 457 84 140 890 456 296 69 785 288 305 133 679 615 522 54 838 601 911 436 786 356 774 253 823 345 10 653 847 471 16.78 777 84.90 883 -43 430 348 875 164 893 101 837 907 829 216 596 80.26 21.26 480 372 220 670 330 341 304 9.43 613 336 379 593 62 631 586 61.72 156 107 71.74 933 958 582 6.28 105 353 -36 -56 -41 910 720 245 -97)
++ 487 779 -96 131 27.10 393 933 27 51.0 73.10 417 341 226 62.26 11 903 -31 -5 35.28 13.8 779 606 181 17 402 304 501 243 774 330 880 990 12.16 267 535 72.10 66.42 716 78.37 560 991 801 395 71 143 861 191 48.16 62 41.2 760 159 196 141 128 48.59 328 86 896 45.57 110 84.2 56.91 155 160 35.1 18.92 163 3.5 444 65.37 76.59 732 506 31.92 26.15 45.53 74 853 92.88 580 788 163 859 210 728 97.97 351 471 755 39.50 57.80 931 60.84 577 206 921 -62 80.99 463 313 846 40.26 294 289 897 469 114 736 362 18.15 269 615 756 507 549 114 502 67 770 412 593 -53 121 652 13.47 778 33.96 23.29 89.70 79.56 765 215 41.29 267 28.82 71.53 910 919 41.72 694 73.90 476 664 401 388 65.5 103 -72 648 58.75 13.62 97.36 436 554 31.87 688 30.55 804 232 366 -62 566 412 182 37 891 490 578 705 475 339 944 860 344 56.0 475 754 98.88 235 52.94 17.38 300 -56 -93 -47 30 62 822 -72 368 944 -53 78 443 76 993 62.24 375 833 37.78 299 385 60.6 8.74 64.64 909 180 774 865 270 411 917 907 181 167 58.11 143 446 581 250 674 99.39 501 541 -14 332 647 454 12 80.43 35 130 61 78.93 850 243 -65 529 310 159 683 665 942 67.25 -92 34.63 122 279 574 914 44.12 80.63 534 19.68 412 750 828 11.74 971 452 875 187 642 761 69.80 509 66.19 825 171
+* 921 -6 812 37.73 52.85 89.24 208 642 917 291 192 633 4.99 446 697 777 901 606 87.23 27.55 98.89 294 808 86.54 348 13.42 89.74 711 57.80 65.67 448 130 183 -71 413 23.47 890 54.26 97.25 484 463 64.73 405 792 760 909 -21 868 74.73
++ 638 4 356 64.3 941 555 88.17 536 752 292 50 852 15.70 192 31.15 374 43 82.99 -23 97.13 512 968 870 45.3 32.52 653 819 85.34 36.7 275 613 259 456 482 703 93.71 67.65 27.72 498 60.16 50 43 603 886 393 79.82 -64 90.51 100 9 45 97.76 184
+* 32.89 464 759 764 68 899 -88 10.12 758 592 178 996 88.13 489 413 -4 1000 2 851 -56 386 263 18.15 -87 44.19 87.67 150 123 156 233 85 90 -13 123 831 361 27.50 61.14 970 316 984 469 732 788 142 146 105 252 329 93.29 908 993 5.6 776 639 728 68.89 959 26 -28 907 439 280 467 638 161 711 45.53 45.95 202 26.61 99.12 536 83.68 589 332 87.97 491 -19 284 63.59 50.94 18.64 11 633 97.90 200 984 38.69 948 185 840 667 293 876 13.97 76.53 76 560 87 652 371 474 466 324 974 246 52.15 91.10 92.47 846 475 95.31 113 39.20 236 334 135 744 467 734 362 682 63.24 670 434 96.50 593 -92 443 252 24.16 949 670 3.22 98.72 875 8.19 791 847 60.27 340 77.62 3.20 887 45.11 27.18 -19 62.80 53.31 266
+* 94.51 22.13 210 58 482 833 736 1000 69.76 25.81 80.33 517 863 130 -74 97 851 532 970 48.10 864 402 708 482 952 482 78.67 502 626 768 654 -89 263 66.74 555 97.74 29.90 -49 362 80.23 974 388 10.24 -25 -8 852 11.40 46.90 687 62.4 60.98 297 62 14.14 265 843 522 82.64 29.35 971 993 264 629 270 40.42 -71 93 384 891 385 76.95 562 608 91.94 44.25 956 192 197 85 459 -67 88 -20 95.80 353 12.66 868 919 469 26.84 73.25 85.63 232 205 400 89.5 8 511 52.25 183 84.27 140 255 232 75.55 20.46 803 76.77 40.47 83 4.65 86.8
++ 5.95 130 32.32 512 181 84.34 43.94 295 531 671 2.56 65.58 542 147 48 252 503 -90 5.9 17.39 911 210 837 70.8 615 998 624 859 871 850 302 81.94 691 317 56.18 784 310 11 40.8 656 31 860 198 348 594
++ 62.17 76.66 969 89.56 32.16 302 426 191 16 147 18.93 20.99 -76 861 360 483 460 32.35 43.12 57.36 817 43.32 982 45.59 573 419 370 73.89 231 303 187 615 85.21 274 342 6.10 120 668 81.36 691 65.5 803 11.8 99.70 895 25 272 243 303 6.95 951 655 363 361 92.59 382 -12 996 804 53.0 339 48.99 24.44 -44 797 -71 95.12 577 67.12 31.42 13.55 263 73.52 222 14.73 756 455 296 468 13.20 670 722 674 27.53 46 963 66.34 976 677 862 52 74.5 396 231 57.80 269 886 49.77 208 71 41 208 88 1.30 777 570 -17 270 370 58.76 822 318 44.66 288 867 66.43 967 864 279 504 371 59.89 288 13.97 75.27 123 91.53 927 756 14.12 387 777 69.57 -31 853 308 212 66 713 646 -61 94.3 361 -72 12.72 32.80 726 308 73.57 73.74 214 524 25.29 225 377 26.77 -14 988 5.7 87 319 649 30.0 77.39 184 37 98.24 319 534 69.73 93 234 359 49.43 73.36 502 501 637 -86 24.51 472 155 878 515 882 502
+(303 676 30.22 54.15 214 831 454 870 616 71.36 846 412 824 -11 803 891 103 128 488 894 362 546 842 872 527 171 -10 81 930 810 73.50 876 907 829 343 684 857 -13 677 657 590 22 209 205 206 581 732 731 -84 528 489 549 50 896 551 653 980 614 639 527 182 626 799 -94 558 503 742 513 362 891 934 779 316 453 101 894 649 712 195 519 715 342 81 975 728 859 8 320 791 682 836 24 -52 129 -8 -56 470 59 786 508 531 3.79 59.16 521 519 521 621 754 -60)
++ 19 59.72 929 25.74 589 418 196 990 57.47 845 139 88 -92 473 512 -11 663 958 938 47.64 41 17 282 235 938 48 55.65 -24 725 806 120 68.43 47.17 442 965 873 -9 24.90 205 814 26 841 81.74 222 602 172 912 -31 371 194 715 415 285 21.36 692 -89 402 985 563 481 66.47 54.32 9.50 426 98.15 792 39.50 61 815 967 812 753 74 4.41 213 185 451 867 78 707 486 84.27 571 87.44 -23 60.37 644 66.29 24.84 39.47 51.39 336 76.92 734 211 -74 66.88 787 438 486 -74 634
+(215 239 884 288 744 938 541 577 72 97.35 -35 458 7 86.0 483 95 44 208 84.13 13.55 199 282 -4 660 475 -90 374 832 95.78 -23 189 -71 573 229 884 240 413 24 331 493 161 101 147 -59 732 640 556 72.1 113 333 80.69 72 468 552 371 98 216 529 314 -47 282 979 -89 110 -8 413 88.51 561 841 666 93 51.17 37 780 -15 190 837 171 -87 506 6.10 -5 721 -76 90 669 18.52 23.32 358 531 608 954 784 238 363 420 808 476 578 907)
+* 168 589 584 61.17 372 970 43.21 27.75 77.66 756 83.87 882 -37 63.32 255 281 13.24 86.74 94 7.55 611 304 818 513 504 533 905 77.36 112 364 662 53.14 902 98.0 415 198 28 91.98 12.36 493 779 990 684 91 663 361 318 8.48 98.49 6.80 598 56 185 645 248 650 99.42 -41 95.97 741 33.76 69.80 458 575 661 742 63 170 435 720 9.27 14.35 906 69.40 -70 2 790 298 14.16 960 421 676 385 677 93.96 479 775 59 704 76.97 74.4 611 189 29.0 34.49 67.10 635 764 78 65 97.72 70.70 159 3.25 -75 257 345 779 310 681 865 724 622 268 41.70 214 83.40 82.38 41.95 821 89.53 930 630 523 47 632 509 474 48.67 676 23.45 351 462 944 592 5.66 79.18 90.74 21 8.40 424 10.71 304 227 0.60 64.59 90.44 84.81 7.85 493 -4 82.47 289 667 233 21 707 503 504 411 13.48 947 276 -43 949 221 924 579 955 51.55 553 66.71 357 36.54 775 820 32.6 -85 47.27 793 920 23.52 907 180 451 39.16 373 247 787 947 547 913 899 47.75 496 395 256 658 618 772 6.54 598 28.42 678 216 943 6.10 720 699 706 923 155 308 798 647 599 839 684 -1 -61 26.98 94 17.97 579 175 540 861 184 167 80.6 88.10 78.7 330 774 799 483 58.84 487 232 -11 -21 71.97 30.48 257 94.12 881 848 3.67 467 406 12 25.75 59.69 60.67 627 866 787 -100 -38 536 250 804 108 748 839 9.31 -22 86.15 90.56 44.44 910 652 193 29 84.89 64.89 531 813 851 456 96.49 808 960 55.70 52.16 722 409 49.83 59.65 906 14 221 62.68 124 504 864 72.73 67.51 994
+* 452 811 52.68 617 28.10 81.87 62 161 997 77.0 24.51 187 115 141 333 487 230 593 52 0.64 958 918 106 568 945 439 331 6.91 863 33 901 30.75 109 921 987 948 914 462 63.16 333 855 159 92.46 750 59.12 81.88 807 43.94 53 -82 188 9.73 368 330 95.98 166 144 117 301 82.62 950 29.72 865 27.46 91.16 33.52 243 904 362 1 169 62.15 88 28.65 27.28 20.75 858 422 894 776 745 275 522 22.25 723 65.69 81 54.53 190 899 413 359 24.97 436 629 209 640 85.83 50.12 66.60 98 94.97 233 787 203 537 612 448 120 604 188 591 65.91 952 945 8.18 21 27.64 2.85 412 -4 853 29.25 19.85 748 -93 392 420 384 597 498 614 -96 91.99 239 623 73.93 983 853 43.88 334 782 32.76 51.36 136 65 84.21 -2 86.95 -44 753 399 703 173 12.1 301
++ 45.17 634 3.97 75.64 27.42 410 67.17 590 894 760 693 11 29.45 971 713 7.0 85.50 314 194 94 12 635 94.93 312 -6 109 -4 966 10 612 101 817 -34 19.89 -98 196 769 857 755 34.76 548 907 73 181 829 209 93.85 17.44 -49 728 16.75 878 85.47 360 711 97.89 17.27 212 84 66.6 97.79 588 851 38.97 83.16 -68 68.33 67.94 955 44.95 59 69.83 873 221 89.94 238 258 36.53 337 9.9 419 38 44
++ 682 81.10 -66 116 -14 789 62.64 772 250 81.5 63.39 361 213 161 792 248 825 661 966 951 19.66 508 743 16.49 -43 743 350 237 379 61.60 373 504 386 89.33 77 602 600 554 -4 937 674 697 624 -48 696 758 50.92 24.68 55 -8 47 612 -90 460 657 756 40.54 294 -49 99.41 76 485 295 78.44 35.84 533 12 317 723 120 -17 276 81.83 158 522 85 920 59.35 632 371 -11 938 96.94 950 97.8 149 47.4 114 797 772 84.35 90.4 975 535 170 236 915 320 70 258 313 27 948 610 231 855 630 2 330 86 54 682 88.60 547 -85 310 76.83 798 41.9 80.86 414 613 53.17 8.58 463 -74 66.82 288 861 9.63 18.76 266 185 17.73 43.87 73.95 782 18.34 332 422 57.46 228 71.78 185 743 478 49.44 641 95.27 410 86.29
+(216 598 784 305 733 215 460 214 544 473 402 139 989 64.0 420 463 684 889 853 732 202 736 365 636 285 68 251 659 764 215 81 444 139 233 487 -58 293 79 279 532 238 932 82 484 633 940 711 156 119 701 59.23 -37 1.17 856 180 -71 523 906 897 450 46 156 122 59 319 775 597 63.55 39.51 125 830 679 675 65 301 829 291 215 739 96 453 -99 831 463 442 366 388 -72 151 329 549 134 15 114 580 431 793 432 130 83.77 220 634 557 829 421)
+(-85 276 197 530 165 966 283 256 305 -11 949 773 808 264 543 344 817 947 969 181 960 706 207 129 567 930 536 611 13 -70 878 791 268 237 88 49.21 327 95 64.6 299 705 317 694 676 588 916 430 171 74 -53 51.52 182 124 -91 163 324 908 440 18 423 623 212 694 536 -77 934 245 861 614 145 393 371 867 240 81 512 23.85 938 15.36 405 558 -65 778 770 548 888 395 845 -46 125 373 808 241 552 742 567 334 39 677 476 703 219 12.25 -96 316 116 473 95.4 128 864 136 18 32.83 982 184 128 244 701 843 644 411 266 911 -19 259 -100 595 82 3.66 671 164 136 466 -61 190 970 88.28 259 998 610 109 267 170 66 581 79 172 55 924 526 30 621 285 672 75.3 289 19.30 300 902 744 655 73.84 148 282 -71 563 906 987 1 266 844 487 300 735 -92 131 852 -79 -12 180 366 995 -7 840 375 951 -34 579 743 -63 662 503 399 595 96.54 551 463 586 455 32.73 884 5.84 301 27 -23 35 963 776 645 515 964 -51 186 395 -29 346 125 684 751 37.0)
+(612 74 887 508 551 383 59 391 742 85.4 156 561 565 889 854 531 725 221 268 -56 492 826 154 360 157 653 62 955 505 913 854 210 845 533 260 61.12 130 32.23 42 822 678 83.29 718 153 -95 727 396 769 791 775 803 -26 58.93 314 987 210 870 -100 198 725 407 45.88 59 951 2.20 2 273 408 238 -82 485 796 626 572 713 710 623 242 985 -82 543 594 443 383 890 28.23 -29 -48 119 -3 926 567 877 998 33.19 446)
++ 158 346 -61 948 99.99 617 87.50 305 46.75 35.79 471 897 99.57 -64 665 681 75.5 692 39.20 870 860 671 82.98 218 63.64 35.65 86 514 642 98.56 98.19 7.77 87.91 746 606 0.63 888 838 67.11 545 236 58.75 640 586 91 533 78.93 847 905 77.26 95 208 88 14.71 77 86.65 -17 191 24.43 457 34.4 90.68 265 821 811 58.36 888 83.94 870 429 8.14 240 813 994 175 944 -84 421 610 979 876 48.13 786 891 50 982 916 442 142 37.95 711 56.83 32.79 90 139 63 -100 56.55 403 -70 3 99.80 898 1.37 284 104 84.26 542 891 62.48 514 77.68 702 604 23 913 65.8 233 20.86 94.4 84 489 527 89.11 565 41.65 505 66.43 326 965 314 186 419 457 -17 86.61 818 42.25 390 919 104 -66 269 171 -82 707 939 231 644 90.36 444 246 510 583 102 75.40 92.52 62.96 394 32.45 69 45.31 993 766 305 15.34 347 190 19 914 980 646 465 31.41 3.79 536 415 419 287 25.69 766 666 68.15 67.34 49.51 -36 1.57 262 297 155 -97 308 22.46 387 683 206 15 329 374 789 35 36.79 365 804 971 823 520 29.11 541 86.47 -53 79.28 710 36.15 48 115 201 910 556 27.91 388 273 784 213 169 983 53.76 900 63 67.31 529 868 938 886 301 219 669 904 -30 177 12.16 736 -56 76.84 995 54.38 65 17 -16 28.3 891 942 302 7.54 798 77 882 26 91 52.98 73 190 63.93 239 271 519 1000 279 192 45 18 -2 582 -84 72.82 455 99.48 71.66 825 94.30 99.65 688 24 66.89 116 447 677 177 33.97 829 110 633 50.44 3.50 826 561 425 580 766
++ 431 85.62 155 584 59 856 -18 71.34 632 957 358 796 136 53.36 548 333 232 635 996 135 985 56.98 32.29 99.4 2 944 27.54 165 79.86 103 909 69.95 214 5.96 -35 511 217 43.4 444 103 68.6 46 62 60.73 206 40 421 16.85 549 68.43 6.13 16.8 133 315 5.57 441 779 713 62.40 441 556 390 602 915 816 792 30.66 773 252 835 434 217 11.92 617 95.95 769 855 745 183 -85 62.29 29 88.75 37.62 737 -89 860 890 99.8 33.96 546 64 187 35.84 359 34.42 802 285 7.54 303 893 771 702 964 832 157 682 6.68 99.28 -28 34.28 83.56 -85 33.72 21.32 84.55 790 -59 729 48.33 854 770 956 26.25 98.97 987 932 57.49 620 125 87.81 75.62 587 54.33 345 934 735 133 632 371 41.34 61 278 636 14 948 46 914 934 894 205 992 834 784 13.98 86.25 333 382 570 64.7 72.55 67.5 -36 727 93.9 698 610 826 40.6 26.66 51.12 586 871 15.77 38.84 15.71 388 22.19 37.59 83.41 552 81.20 638 97.74 970 91 52.81 -37 28.66 711 43 111 379 923 197 104 86.1
+* 258 682 67.15 537 26.81 -51 -32 718 76.92 363 431 82.35 8 344 59.50 -60 78.13 683 78.92 52 628 4.66 853 31.9 497 218 308 162 -82 52.9 585 65.37 82.16 232 756 61.80 753 451
+* 787 47.80 324 156 243 838 67.4 710 -5 734 527 239 551 73.43 41 782 38.96 274 426 871 -87 547 190 869 756 -21 839 334 78.59 65.44 11 0.66 98.88 724 2.97 979 301 638 740 11.44 971 31.79 78.99 70 946 755 -90 53.34 328 911 -4 949 97.23 221 360 -7 995 946 580 58.39 698 -48 99.90 47 46.68 344 535 950 24 512 9.67 962 616 906 437 73.47 -56 107 492 982 338 -9 246 623 67.61 -28 818 95.85 816 898 125 95.70 5.47 452 1.25 74.77 219 93.92 22.25 145 73 16.80 18.77 20.81 971 528 771 26.29 637 38.57 436 59.25 813
++ 380 313 109 612 12.88 987 895 56.39 689 439 79.1 122 343 677 407 -49 382 9.14 42.1 282 504 945 83 508 27.45 605 974 11.36 835 30.44 835 554 881 691 361 446 815 10.98 801 818 655 83.91 41.25 7 454 918 335 27.74 209 73 161 246 853 375 85.47 56.42 22 798 151 15.63 564 86.82 101 582 407 70.47 49 808 77 416 815 521 302 675 10.95 -56 899 627 535 242 92.38 144 73.89 583 77.1 56.15 872 66.45 691 22.28 268 45.11 36.85 59.35 846 81.89 58 94.96 450 75.43 14.86 453 869 76.60 679 822 625 184 842 827 35.97 824 58.28 803 37 828 806 86.29 0.68 67 -65 288 764 47.40 374 42.64 969 -70 181 18.81 423 537 54.98 48.48 448 539 -40 81 75.15 624 97.16 65.74 331 891 215 99 97.85 386 -11 297 160 54.93 92.16 469 48.47 872 65.84 -76 36 48.21 87.42 774 201 99.71 97.31 39.53 668 918 297 1000 -60 931 329 470 140 673 110 16.21 245 46.35 86.21 -50 42.27 538 66.85 9.41 576 272 957 351 26 738 620 55.83 403 985 21.52 -21 701 10.45 62.12 805 489 698 88.96 293 676 33.34 907 657 0 60.79 210 647 896 669 199 57 188 -94 119 712 215 615 557 675 221 54.29 13.35 66 709 86.63 269 693 66.29 874 465 839 68.61 33.46 52.46 -90 72.40 869 652 266 795 421 571 635 42 838 472 58 328 55 -38 5.1 718 509 579 83.20 910 971 11.43 51.52 93 900 643 284 74 738 311 711 117 908 7 29.18 157 666 481 200 32.42 66.8 981 722 616 68.50 57.48 451 9.57 85.6 69.67 461 607
+* 83.3 737 50.4 73.92 765 776 32.35 99.77 917 823 27 667 65.64 756 39.27 826 84 548 504 2.68 281 557 46.57 766 809 249 95.33 67.87 91.32 333 40.58 852 972 831 317 433 487 47.22 70.82 65.6 169 187 758 243 707 280 811 670 463 0.6 64.29 456 238 62.80 8.2 893 991 -87 325 992 32 709 212 535 24 900 792 862 19 93.28 976 14.74 -70 12.98 694 324 448 64.73 5.76 406 562 546 48.53 91.33 818 827 51 833 996 372 -6 67.61 50.17 854 242 323 53 451 820 538 699 391 575 273 479 -38 620 159 369 -29 -98 82.30 194
+* 101 38.74 889 261 633 647 -71 173 385 513 399 518 53.33 225 29.78 5.45 409 405 68.47 31.62 279 770 556 515 990 288 582 81 44.58 583 705 -51 480 9.13 491 97.6 455 -91 877 13.62 967 537 95.44 -3 182 700 6 873 42.23 669 651 188 69.30 249 278 -58 86 915 615 667 356 535 73.49 29.57 88.10 270 406 139 60.25 915 261 250 12.42 39.16 78.77 82.34 809 455 853 16.82 -67 159 -57 189 43.12 591 635 27.6 86.83 123 230 73.55 12.4 720 11.21 46.49 999 51 30 99.17 821 445 777 135 81 179 32.83 -67 0.72 30.12 969 84 373 327 360 819 117 -12 18.95 909 131 64 696 91.60 68.81 973 90.29 89.13 60.86 86.46 953 97.9 -51 74 64.76 745 512 73.48 52.42 -53 925 -87 14.70 26 130 690 13 649 191 43.43 11.87 4.34 64.46 637 31.60 892 902 418 974 478 18.24 487 218 722 765 13.52 874 625 814 -89 869 136 336 -83 49.35
++ 656 994 -24 584 776 68.67 134 868 983 264 44.14 -60 659 24 -66 625 512 113 47.14 597 5.74 46.69 452 171 95 426 98.13 -6 248 705 554 -35 -65 315 800 22.49 92.1 996 270 997 724 575 653 67.54 21 84.48 99.97 588 -76 32.70 87 629 533 53.44 137 84.25 312 59.31 363 84.91 723 394 909 4 23.44 149 600 6.30 77.46 507 910 132 116 347 119 950 481 497
++ 91.13 71.19 35.53 64.30 7.23 857 562 76.32 56.30 50 525 903 685 571 455 12.14 818 717 16 772 901 24.30 993 -89 -1 30.93 46.95 924 -88 16.68 77.31 673 348 85.13 740 746
+* 66 404 900 389 132 801 248 145 76 -24 854 394 970 822 772 43.68 58.59 723 606 344 606 -15 347 40.42 882 894 808 526 5.20 585 11 28.91 -31 166 451 33.82 940 890 211 973 699 789 135 73.10 707 -69 83.82 568 9.81 96.34 205 278 -61 49 581 177 12.80 633 13.36 209 919 109 810 736 760 -23 16.3 21.90 601 658 814 215 221 895 14.43 622 524 7 78.69 597 37.16 689 254 60.49 801 890 384 86.3 833 475 655 78 886 -26 25.49 944 401 55 71.99 90.5 8.31 70.61 269 909 74.77 570 90.14 75.67 -61 39.86 -80 450 12 22.58 820 929 220 -41 510 93.87 526 71 0.99 83.3 969 752 935 803 600 50.43 674 2.96 41.34 -49 728 -58 335 71.97 862 998 911 9.0 983 655 401 797 331 73 80.56 80.31 61.27 13.13 20.41 196 699 348 377 300 48 218 -82 421 678 459 675 56.13 17.89 13.29 274 402 363 820 4 56.46 31.44 436 277 48.59 -29 30.25 521 781 128 351 53.26 556 956 58 17.27 9 64.43 290 94.28 424 737 54 88.65 460 854 555 21.80 619 -85 26 9.68 42.3 587 368 -11 107 73.8 936 911 -13 923 52.31 80.81 811 70.30 73.26 758 71.48 113 216 57.99 19.89 868 274
+(17 -47 62 372 547 10.26 341 939 297 485 253 414 -79 115 471 641 476 883 310 335 -18 232 959 97.76 609 -62 533 539 80.37 807 122 18.56 914 997 886 145 146 1 525 295 792 580 708 867 719 814 826 627 343 264 119 306 28.31 22 222 899 727 182 236 452 405 300 178 110 692 705 301 36.11 429 785 427 537 723 693 487 642 527 411 -61 937 10 568 677 20 340 626 235 477 -3 596 553 96.96 831 225 675 564 759 17.49 752 838 44 698 350 89 901 663 772 85.2 -6 588 57.17 268 131 -45 673 315 696 566 -11 332 607 713 968 11 121 869 157 119 760 788 59.45 851 640 83.8 813 242 875 179 256 952 412 957 -46 50.59 963 512 -20 470 317 864 -9 50.92 889 907 472 40.60 171 442 202 91.77 999 274 333 61.31 390 -36 330 562 756 996 -93 878 349 816 219 17 665 55 612 29.38 495 126 811 82 384 35.65 928 90 274 91.63 631 238 262 505 142 254 340 14.12 684 641 38.44 631 59 493 781 8 123 718 447 845 13.39 224 520 726 997 86 83 151 244 61.4 901 202 861 349 578 824 212 698 19.93 995 433 698 373 437 268 880 91.23 839 893 284 71 876 22 368 978 606 134 571 726 202 841 358 727 768 6.20 595)
++ 808 480 995 302 855 455 572 -19 296 464 50.16 565 536 888 156 886 21.94 983 192 105 549 994 321 234 657 691 610 606 168 705 23 -89 4.4 70.14 57.34 256 -2 79.11 9.17 813 191 521 476 421 230 730 692 63.49 69.49 11.65 365 91.46 520 -76 -29 924 39.0 245 970 897 123 91.54 42.64 377 41.86 29.94 47.17 46.21 563 23.18 80.86 87.63 538 393 6 98 167 10 914 28.33 433 921 648 50.70 -12 220 726 947 40.33 69.23 753 941 473 45 37 -93 138 666 853 822 34.28 431 938 191 59.86 136 46.1 534 227 35.34 216 601 657 43.21 281 486 6 -77 84.81 497 81.76 284 879 -24 175 32.13 472 353 59.66 479 348 1.55 898 547 44.62 458 218 932 442 -12 708 424 -50 52.37 17.92 92.57 98.82 43.46 5.97 126 898 862 954 70 386 925 826 225 2 74 78.55 21.29 224 798 335 57.7 80.26 153 703 813 401 91.96 12.54 588 422 59 910 70.1 7.61 495 756 4.79 952 447 98.11 396 888 -78 333 58 656 689 71 779 133 91.49 93.18 323 23.33 68.18 427 283 586 47.30 95 22.39 61.40 92.50 50.52 451 342 12.28 -96 389 503 85.80 68 440 20.65 256 25.29 -89 255 40.3 800 861 528 848 311 480 547 55.61 539 958 43.92 155 405 782 777 76.26 906 40.57 441 616 48.50 979 -10 945 420 9.71 501 771 841 50.69
+(548 957 31 380 304 682 655 -38 119 308 952 644 832 868 717 893 964 -59 740 253 439 110 84.22 395 -79 434 501 58.16 49 152 554 713 826 622 153 291 391 74.27 343 583 645 931 890 909 691 796 758 425 227 121 73.52 -61 73 38 393 195 49.54 21.96 11.89 649 934 402 838 18 -37 -95 987 869 -11 259 570 137 31 160 172 582 69.3 9 626 504 -25 805 462 428 624 1.5 605 153 261 533 702 937 695 425 368 57.65 98 92.39 794 961 237 33.4 305 616 848 170 603 357 246 87.54 61.60 55 483 363 654 802 430 614 38.63 441 589 403 924 882 308 913 456 202 874 -19 85 46 641 376 295 304 531 9 888 397 -90 736 586 607 502 354 840 576 4 766 -48 953 813 346 12.55 10.91 489 -71 774 53.1 863 616 809 973 873 626 226 41 330 362 722 661 91 579 758 938 -62 571 -82 451 680 117 51.84 19 39.87 113 998 346 693 -19 289 653 702 33.19 16.14 -27 960 410 498 116 132 556 303 501 46.81 275 669 635 271 636 217 445 447 810 562 254 263 762 968 571 268 811 54.16 632 503 363 57.16 29.92 960 779 2.66 275 556 476 95.53 426 -36 585 211 590 367 421 791 946 144 287 951 784 824 388 850 689 250 781 30 312 880 148 926 649 -96 933 17 815 971 -13 -76 859 702 618 -32 -10 236 29 322 582 569 27 13 384 612 451 -42 314 -52 323 1.89 925 592 279 534 977 865 745 384 572 2 904 285 713 900 746 67 -33 286 9 765 408 918 424 11 545 -75 639 955 -19 447 39 646 427 57.59 634 40.34 156 357 548 91 654 268 748 464 71.76 812 715 24 731 464 767 957 -18 799 295 234 94 944 58.32 980 143 48.13 464 909 280 43 100 -98 800 61.13 -9 -20 344 265 724 29.2 944 255 143 373 425 12 949 748 326 343 428 99 6.87 162 99 332 432 511 125 47.69 122 68.29 365 87.45 826 32.32)
+(527 515 -86 626 459 -27 641 551 523 194 701 872 323 85.31 120 791 954 350 901 350 512 -91 3 721 371 736 398 -82 812 694 812 552 -27 69.95 102 872 44 855 59.20 -52 504 794 951 76.59 287 462 90 786 27 -68 64 -57 147 32 59 74.98 437 733 176 982 773 310 18 688 160 196 687 75 47.20 110 502 583 45 551 -88 -60 953 250 8.52 447 142 646 973 954 333 336 871 80 345 39.82 12.5 503 928 -86 743 587 741 21 699 532 7 103 755 346 20 716 97 327 872 55 499 991 930 661 902 450 311 184 29 666 119 755 848 480 522 10 464 60 899 81.34 239 185 693 38 845 78 490 355 121 681 390 107 686 478 187 780 233 385 904 -36 78.21 103 233 922 202 -53 -34 391 788 25 857 780 920 835 92 547 -7 -88 94.11 -58 38.25 71.10 -69 229 647 343 350 486 265 732 379 583 879 90.85 791 660 515 961 224 -3 352 713 -15 217 853 643 830 815 955 930 593 287 884 673 929 -26 330 931 342 51 524 402 715 85.25 844 6.49 82.67 49.34 4 274 973 909 367 7 495 522 80 127 734 305 297 567 818 500 230 828 251 824 433 345 575 360 657 469 1000 848 392 -42 969 448 768 958 47 404 -98 785 269 770 780 596 995 511 623 6.65 30 85.59 569 198 425 63 710 366 -58 -95 753 957 799 182 582 331 116 404 628 -82 589 769 625 327 377 35.48 832 958 37.87 709 451 349 142 308 -72 53 35.54 580 108)
++ 302 86.96 465 -39 743 977 35.13 40.58 335 42.86 82.58 54.2 850 -48 290 32.55 632 0.62 215 257 643 199 57.21 377 71.70 807 647 649 936 15.24 165 978 853 -70 542 703 161 19.68 297 939 884 680 866 12.47 450 12.35 680 556 93.91 854 638 18.3 334 939 50.67 789 979 75.96 75 30.46 987 243 889 -56 207 19.77 36.40 48.23 51.34 98.87 116 599 58.61 36.6 78.63 247 28.34 316 39.65 442 649 233 71.94 539 56.14 65.45 -84 36 71.32 705 639 81 227 930 28.99 944 345 -16 414 95.69 92.66 552 130 190 81.65 702 846 -45 53.92 62.67 73.74 347 94.93 681 22.85 111 858 987 52.60 390 638 14 427 5.15 934 24.11 205 16.45 856 41.59 270 432 46.19 74.67 66.14 662 6.83 -77 91.79 588 55.64 551 73.31 422 58.28 206 65.16 57.33 541 468 974 25.83 505 950 30.37 2.23 797 176 779 64.68 381 138 79.1 911 80.67 95.70 506 478 15.50 436 746
+* -16 521 560 79.6 2.83 937 31.47 11.42 347 36.17 34 916 -48 -44 823 76.3 93.65 86.14 31.17 -70 78 123 947 848 317 614 769 918 37.77 595 733 63 -99 6 511 -47 63.40 46.73 212 40.39 629 317 166 581 -26 817 837 -90 665 188 946 16.32 32 18.16 -85 85.65 636 134 46.74 897 173 879 59 641 987 340 13.49 74.17 904 417 424 24.65 56.36 10.37 -9 823 854 737 83.12 10 893 574 965 195 691 615 863 778 492 32.21 427 889 753 578 485 108 306 540 287 -89 172 -43 26.95 877 77.46 220 -40 919 190 72.61 179 28 84.54 59.54 50.4 859 -67 499 88.17 23.83 976 156 463 90.36 818 529 425 71.7 966 369 95.8 -92 49.86 76.94 418 242 51.15 83.54 432 856 28.81 91.12 5.18 175 411 617 396 87.64 890 83.63 17 34.64 75.14 51.85 43.43 958 283 975 93.59 270 206 613 610 40.99 18.63 475 0.53 952 987 462 571 4 74.98 40 51.64 -98 64.14 74.45 46.6 31.38 54.85 34.63 97.36 -33 425 520 647 29.30 50.54 467 209 373 175 68.20 -25 661 45.68 71.98 776 298 585 68.79 -64 765 139 694 66.98 471 788 308 408 887 233 19.20 -89 12.73 81.28 811 84.91 331 282 -21 77.22 84.12 778 865 -73 1.41 912 67.4 982 40.31 836 910 57 35.57 417 10.46 190 55.32 485 -77 426 9.61 962 -44 60.45 42.63 948 36.77 175 713 59 55.83 2.61 236 21.97 604 42.97 20.14 121 71.52 486 458 377 33.59 29.92 526 78.63 957
+(790 977 710 815 318 230 768 332 81.60 57.16 395 779 501 280 14.45 153 854 539 285 77.50 -62 -46 -45 89 316 720 85.97 71.13 179 190 397 -69 40.44 242 984 57.20 716 198 163 258 718 399 741 24.66 474 240 503 -66 498 38 317 630 850 371 511 590 647 158 122 111 536 392 649 385 675 -98 458 190 635 380 105 321 175 585 -37 108 37.87 891 387 462 845 188 173 739 99 930 36 707 50 439 468 99 426 -35 49 98 212 11.56 62 552 236 456 24 255 88.71 772 249 7.91 950 846 -39 450 292 133 31.54 10.99 619 724 626 710 78.53 6.61 438 496 30.54 975 721 93.99 991 548 456 -34 951 40 721 -86 165 -52 824 267 85 448 398 481 728 473 364 370 763 327 47 506 -97 649 449 211 660 147 -23 664 536 307 -80 668 278 223 246 426 322 86 325 889 185 799 832 877 97.77 446 186 73.91 980 989 651 231 349 66.14 376 -82 54 367 971 566 784 778 958 851 -28 86 824 912 925 419 778 606 347 20 578 693 884 -78 990 251 966 625 106 580 57 128 208 298 -48 576 522 104 -11 952 266 2.43 3 606 483 981 746 602 -7 32 44 928 91.32 832 99 203 994 579 -4 682 43 926 909 967 512 -42 -38 584 398 641 938 968 85.17 824 750 177 464 835 276 796 162 566 461 96.42 187 21.7 868 446 128 29.11 555 84 433)
++ 57.50 43.64 -55 641 20.79 11.31 114 397 84.30 48.95 7.13 55.63 896 77.34 98.16 267 68.30 35.87 276 20 2.10 -76 473 943 1.81 666 32.98 614 690 46 795 27.12 11.3 -75 361 478 831 200 515 369 535 74 932 362 198 651 33.55 834 344 752 955 678 750 80.5 60.59 615 58 -59 241 425 338 751 -90 30.86 580 654 782 555 461 328 598 22.13 768 463 9 25 584 10 19.35 650 681 -50 40 521 550 492 808 689 21.55 951 48 89.90 88.98 23.29 776 788 10.56 49.36 77.95 54.32 899 637 38.51 21.95 609 750 280 404 29.14 449 665 292 343 317 13.64 979 783 42.82 67.46 881 326 -38 231 20 118 93.75 725 270 480 247 875 505 344 854 127 68 923 648 717 841 27.55 69 841 456 243 431 27 67.84 46 57.21 57.87 148 53.44 35.48 79.82 4.0 17.6 64.74 633 975 148 259 364 18.73 5.32 90 32.47 769 196 867 535 19.3 688 29 679 76.57 32.31 744 -21 -96 952 999 2.3 396 24.37 -72 61.43 21 64 332 5 607 -53 715 72.84 665 62.41 69.72 501 756 -82 89 686 114 0 63.98 21 223 97.9 73.87 96.85 23.99 962 906 41 142 -29 5.2 285 3.48 236 901 776 136 48 86.31 8.4 168 414 265 61.91 687 86.12 93.81 164 426 569
+(716 305 773 624 612 50 401 495 800 575 128 268 -63 136 345 132 292 856 657 742 407 97.37 531 88.35 721 419 779 231 777 471 -5 838 64.73 155 799 157 580 426 -5 95 724 522 29 53 688 206 8 137 857 209 284 71 430 703 481 161 949 245 729 13.66 -58 806 177 564 96.25 -65 850 803 333 473 552 289 426 507 259 891 87 629 478 402 56 676 737 881 525 715 804 945 402 622 194 -28 858 38.81 965 211 636 483 528 590 527 124 73.71 751 430 -75 830 861 98.56 456 459 609 -20 22.72 6 743 592 486 32 950 787 907 -87 847 114 938 738 38.47 359 170 10.15 595 959 230 802 990 -31 12 3.61 393 889 481 866 -6 794 461 370 164 833 968 891 163 195 838 322 17.25 -8 766 952 661 57 172 542 46 856 70.70 835 423 262 956 36 891 98 104 805 750 351 883 44.95 819 334 959 709 847 169 9 967 358 920 54.62 18 -62 808 258 398 177 17 67 71.64 844 25 464 -20 850 298 363 614 564 546 549 927 -71 554 716 743 896 739 717 72.26 59.39 -11 -40 788 357 449 446 12.29 966 857 448 981 78 913 777 578 417 155 695 432 788 950 630 570 593 5.48 642 916 688 403 271 727 258)
+* 859 93 167 750 542 61.0 114 873 899 336 70.28 26.94 945 55.20 332 78 941 -90 721 45.38 787 941 26.83 26 10.26 21.53 580 68.82 294 941 592 538 718 60.3 300 613 242 828 724 71 208 335 318 90.60 93 398 98.68 48.44 467 215 942 60 519 861 124 71.91 30.62 278 996 102 917 90.16 57.46 6.74 824 932
+* 48.56 271 34.34 65.41 201 98.95 771 901 940 72.25 522 83.65 78 24.80 343 211 828 916 28.40 372 876 31.74 -46 289 803 945 363 33.3 114 925 711 106 981 60.37 312 87.6 75.34 -16 900 -81 860 71.6 26.37 287 -73 -38 548 626 57 279 1.55 202 13.71 -61 18.55 1.10 410 942 736 82.95 737 19.24 13.81 51.53 665 299 325 558 939 385 50.68 389 599 182 99.88 58.72 304 334 -27 655 434 216 666 415 141 34.94 952 145 945 37.71 929 -79 5.12 64 420 82.17 993 319 8.0 62.85 46.87 902 61.31 928
+(-18 708 67.36 268 -42 646 479 15.31 239 866 404 12.87 409 706 384 60.76 327 426 481 362 968 807 238 699 200 316 574 503 34.62 906 885 248 14 170 523 467 563 448 320 726 762 290 133 37 889 55 551 63 273 325 16.29 199 237 880 748 4 -75 67.43 81.62 664 908 134 786 96 37 75 16 676 502 862 334 894 756 372 787 20 845 -95 252 750)
++ 28.81 286 83.13 875 688 773 -43 52.69 93.51 821 45.86 402 158 57.23 526 62.23 717 87.76 435 72 570 35.30 795 528 -69 895 65.11 921 66 839 889 281 204 24.17 320 489 368 557 512 31.23 66.88 180 103 218 683 259 -96 951 648 233 92.28 927 49.5 356 60 873 86.17 430 75.76 143 382 925 499 53.23 -59 15.71 642 878 -53 232 959 54.72 0.48 606 629 687 309 555 23.53 73.70 680 96 549 772 5.54 -16 49.6 40.15 682 82.26 170 37.23 13 -95 421 718 422 220 931 96.59 369 92.73 80.41 28.48 14.32 745 74 272 665 109 702 903 66 924 35.20 137 -62 -83 156 70.22 47.67 710 69.56 317 34.90 23 595 741 698 651 210 737 144 943 426 33.13 28.26 46.6 642 285 985 61.53 50.18 65.19 671 850 40.60 683 507 50.77 107 510
+* 78.49 841 867 834 46.23 923 7.83 776 61.56 81.58 80.31 718 467 895 37 62.28 12 325 143 -44 -84 64.31 793 22.84 21.28 1.67 224 69.43 26 574 385 46.25 981 307 17.85 89.89 545 348 -94 92.49 22 96 826 552 534 -70 49.98 348 635 615 42.22 659 469 35.16 850 865 697 0.28 52.83 75.40 907 68.70 99.18 68.76 49.72 196 -53 667 25.66 71.93 279 332 -23 276 96 728 -33 39.23 634 542 -21 45 49.34 27.74 425 862 983 741 636 12.22 655 250 307 270 931 -90 88.7 10.58 929 -41 67.86 800 680 -63 32 683 833 80.67 516 389 823 89.91 93.10 46.18 44.93 245 548 3.73 191 48.46 961 80.83 84.64 96.34 98.76 70.77 594 133 15 319 544 243 93.73 344 782 7.1 786 498 99.96 34.71 679 718 31 758 463 906 75.50 69.15 87.86 55.57 397 888 18.80 883 798 25.1 110 66.46 63.5 69 808 62 718 16.62 803 940 395 75.55 25.87 74 884 192 397 755 128 -82 906 906 24.20 14.70 504 97.77 4 91.36 -55 56.23
+(254 87 553 -32 58.16 187 616 810 977 480 591 424 278 25 123 640 -26 71.55 18.56 30.94 -49 745 44 920 374 321 15 620 700 209 516 71.84 807 764 626 69 826 429 61.88 48 143 634 -42 626 799 495 568 -43 -5 223 667 45.5 762 698 77.13 785 481 301 976 44.0 529 973 138 11 691 771 349 580 397 413 -95 657 195 610 509 399 171 474 86.50 -19 828 583 -42 988 562 82.15 -88 579 1.97 139 63 317 90.36 537 649 161 201 634 817 243 -21 139 653 604 170 639 670 567 59 396 677 72 -33 83.87 463 662 197 17.17 573 292 468 -43 793 437 893)
+(795 139 231 197 -92 887 814 588 407 63 13.21 998 281 496 86 139 785 971 856 782 -3 480 727 124 312 30.44 261 43.1 439 172 666 727 8.89 228 85 355 43.59 637 640 310 187 326 993 338 823 789 293 870 164 340 456 40.24 -84 249 208 722 383 311 -9 52.25 44 168 211 11.1 286 254 351 8.0 846 214 662 491 506 50 -13 193 762 271 394 778 727 120 466 337 312 65.9 553 870 131 73 167 901 54.81 17.49 757 488 412 787 507 947 28 1000 237 854 306 -56 316 656 922 468 508 24.1 626 65 221 197 334 420 37 52.1 143 1 689 129 618 815 -42 24.25 57.91 -82 -31 -84 974 580 25.91 723 664 639 910 807 463 149 671 796 62.21 626 295 776 639 308 6.85 485 816 18.60 451 682 458 865 428 474 30.48 5.58 139 -42 -53 18.95 339 -21 735 -35 997 645 11 934 609 42.35 8.49 850 209 6.14 318 889 29.19 7.97 685 143 720 52 648 872 864 750 922 166 60 688 476 571 51.15 633 121 673 30.39 40 91 827 748 851 414 631 880 772 730 147 880 699 68 76.22 346 925 461 23.84 933 737 -41 678 834 161 976 871 510 501 400 772 955 64.73 706 349 43.59 698 818 325 668 483 472 999 236 354 93.80 -85 -97 42.8 428 751 287 -59 634 485 96.45 -24 245 53.80 56)
++ 69.30 929 88.23 10.19 71.77 80 18.52 20.65 946 70.45 4.4 100 899 859 140 46.4 75.63 67 58.83 62.71 213 952 507 914 936 48.61 -33 695 473 1.74 36.38 33.6 763 36.14 48.15 -6 539 183 4.91 69.63 786 994 181 34 679 191 74.13 177 46.85 98 484 742 654 5.21 270 690 345 57.68 609 24.63 441 8.95 645 28.74 219 115 911 43.94 32.45 11.14 983 832 437 116 286 961 952 52 954 520 12.44 358 572 75.68 8.35 750 644 93.58 40.75 437 370 38.26 45 80.64 81.94 110 472 718 412 18.21 436 390 96.19 191 38.66 977 360 477 44.71 176 80.15 453 91.71 878 56.71 71.68 666 621 44 322 24.37 582 25.64 794 40.82 568 26.82 428 721 4.82 766 108 500 350 47.21 45.67 832 -100 488 49 164 34.62 491 2.87 590 851 293 571 32.39 208 596 841 132 97.51 27.32 21.83 49.16 723 913 59 734 31.9 206 12.54 38.93 470 53.94 683 56.55 0.80 89.68 284 292 709 689 172 -36 591 935 307 868 -7 80.42 632 63.63 883 485 39.1 10.44 183 185 406 609 931 909 -44 321 4.69 33.53 27 74.64 784 880 302 34.83 926 -13 888 89.59 251 92.54 575 0.1 562 43.50 467 83.20 86.43 139 58.48 40.37 13.23 950 37.30 994 478 961 59.61 223 29.73 72.40 524 239 2.11
+* 28.28 -65 21 7.20 80.21 846 336 50.30 190 74 -61 81 463 533 31 182 64.70 64.0 305 94.32 322 12 50.77 36.3 68.32 65 289 21.99 814 369 -67 780 75.38 94.4 62.52 1.11 245 548 35.33 964 59.63 665 -40 57.97 61.68 438 147 967 -62 136 805 28.81 3.85 -29 231 820 73.60 228 974 23.21 23.29 88.26
+* 273 174 381 16.24 358 750 203 178 75.67 889 49.54 35.24 886 443 56.73 37.93 -20 213 61.43 941 824 29.88 411 306 77.60 16.66 -1 37.55 786 539 395 698 880 27 502 724 19.90 2.60 881 31 217 146 82 760 44.28 33.82 629 223 812 -54 544 99.85 944 63.9 679 159 29.70 681
++ 71.29 24.38 885 3 108 869 346 28.60 60.99 470 552 357 47.18 753 30.70 7.90 387 35.88 386 214 925 72.77 649 609 534 123 895 -43 934 679 51.59 266 434 364 163 71.17 76.6 50.69 506 936 502 428 304 442 447 900 893 956 65.54 41.66 87.37 14.87 125 22.56 30.98 305 444 397 370 205 903 10 881 343 256 602 -6 14.91 529 717 72.9 49.63 397 80.13 448 802 83.1 55.38 888 18.80 -70 26.37 364 510 491 485 6.0 120 750 665 4.0 73.77 34 544 73.20 528 80.32 92.69 867 3.85 42.88 416 916 804 804 540 393 201 791 58.27 128 226 963 0.97 125 317 747 805 55.29 45.50 575 348 74.62 407 920 100 147 905 19.70 38.65 840 196 928 891 407 117 510 720 80.37 -81 223 32.90 769 823 31.35 206 989 518 170 270 32.28 88.59 58 163 92.44 962 70.14 25 4.47 476 587 913 36 33.14 747 18 389 507 39.46 666 738 699 726 265 940 409 47.67 786 741 73.40 869 6 806 721 520 892 133 29.78 61.38 959 115 42.0 998 46.64 912 296 793 77.70 415 662 409 805 421 14.1 262 586 7.51 540 357 90.15 262 37.64 552 43.62 565 606 -34 855 71 937 269 232 552 150 90.30 1.51 416 117 375 113 486 278 491 220 21.8 165 926 33.65 662 804 909 432 80.58 267 552 31 238 562 98 143 710 801 288 710 457 95.82 -32 35.25 576 66.36 95.94 -44 -19 -8 638 466 89 87.96 607 549 603 711 306 70.1 42.32 26.13 818 926 155 534 437 -53 708 40.91 45 69.22 8 58.95 38.55 725 37.68 882
++ 97.8 644 709 714 601 322 -58 705 145 888 932 -46 131 245 147 69 366 922 914 3 443 70.39 50.86 46.61 768 52.10 -16 287 -72 40.14 64.98 92.28 11.30 855 201 217 23 56.74 -49 292 95 21 888 755 21.1 67 12.25 960 142 822 29.74 126 580 516 824 25.39 -27 298 627 75 36.79 609 96.47 789 568 97.5 851 77.12 23.29 845 13 418 57.79 263 608 38.5 879 14.65 14.77 -89 589 52.73 96
+* 743 699 99.9 44.97 279 704 56.61 150 376 48.15 22.52 416 89.98 73.97 -13 85.65 516 529 396 3.19 -90 50.64 -88 884 389 802 401 67.61 798 40 27.23 621 280 54.20 162 478 85.79 676 -40 86.51 232 78.82 919 187 549 13 640 18.6 326 43.38 72.25 -37 840 -79 38.74 640 916 435 -73 420 583 906 24 870 390 49.51 604 272
+* 10.50 406 34.71 305 -48 4.59 55.94 71 470 56.65 87 473 316 84.54 141 56.46 646 39.82 1.84 861 122 42.64 44.17 837 276 900 596 652 95 235 478 971 904 89.75 51.57 93.34 479 792 306 674 692 253 57.94 446 69.57 140 283 945 14.25 689 113 339 -5 807 565 577 -26 90.11 224 931 369 22.36 19.40 54.0 323 39.68 288 104 17 904 773 745 432 917 196 -15 397 23 117
+* 60.61 480 254 -20 689 276 930 322 747 653 917 77.68 420 84.14 90.75 105 91 214 384 204 85.12 31 -92 49.69 617 750 23.0 770 818 41.47 714 433 684 646 -26 795 89.59 48.81 61.39 -98 -78 764 513 795 41.13 99.90 223 243 69.70 600 553 269 842 9.30 15.92 887 204 45.46 45.25 45.75 44.10 482 64.7 871 848 28 643 64.71 952 48.48 59.2 941 392 844 346 41.83 680 18.29 37.74 991 848 46.66 24.93 904 64.14 272 52.37 695 84 891 429 69 49.54 7.54 333 3.51 -25 60.43 475 606 18.44 31.81 922 -48 404 80.70 76 541 817 2.58 537 927 88.44 87.17 51.24 796 84.68 76.23 15.48 860 583 97.83 666 476 443 45.59 69.1 684 55.91 80.96 647 365 735 7.31 518 103 511 718 -41 15 42.26 54.36 6.59 690 34 57.50 63 104 349 284 816 869 924 7.56 821 17 18.45 850 665 562 37.83 11 477 10 81.22 132 -37 73 125 722 518 25.47 774 26.88 759 227 948 561 65.21 492 801 53.99 36.20 838 27.61 37.3 733 397 230 115 412
++ -74 17.88 571 20 86.6 442 416 919 94 601 487 603 694 235 678 35 -48 32.43 824 21 790 93.93 36.92 95 965 625 31.8 71.74 800 59.83 523 43.41 31.19 368 76.15 272 -9 168 214 647 83.99 51.36 110 15.19 423 96.80 89.81 540 508 74 167 16 888 69.98 45.48 216 478 963 623 792 166 217 51 237 962
+* 59.30 34.12 938 892 527 100 536 414 87.86 194 29.51 64 12 846 862 -22 -82 582 14.94 847 487 727 466 915 990 13.81 650 141 9 23.45 37.51 38.11 95.21 826 890 380 68.98 730 23.62 571 816 126 394 502 50.51 108 16.85 39.57 77.67 -52 111 919 400 76 641 584 659 102 637 11.34 273 76.64 904 -32 211 4.58 25.32 -89 216 366 78.48 901 87.66 573 38.81 11.97 28.15 326 126 625 72.5 -4 229 99.88 738 314 89 92.75 158 57.14 -4 36.65 9.74 380 50.32 49.3 86.5 39.97 348 271 78 26.17 891 31.97 112 284 24.16 13.15 26.65 992 82 270 643 544 315 898 27.87 23.84 54.64 274 585 958 482 48 421 473 237 837 713 -51 78.39 28.98 68.91 68.74 87.18 328 18.19 685 544 18.0 225 398 292 276 54.90 23 302 699 -40 214 -59 88.61 580 734 13.35 689 480 8.77 65.52 592 683 337 315 10.76 410 69.22 512 -43 293 398 175 233 21 134 617 794 242 15.91 753 83.18 39.94 425 76.67 705 701 243 16 975 56 82 35.46 753 92.46 838 0.71 665 85.65 45.68 467 42.23 41.68 966 16.18 234 802 49.53 749 55 859 604 623 79.75 60.78 730 31 562 863 97.89 887 446 -90 669 902 540 67.64 939 25.25 19.48 933 871 993 44.1 991 627 6.21 8 815 184 7 198 662 805 66.4 595
+(117 294 11.80 69 243 909 -9 62.24 778 843 355 483 86 847 936 467 123 186 943 583 -36 258 463 437 90.94 57.99 848 -10 305 689 909 838 257 836 184 -26 13 663 82.46 875 54.54 72.4 970 70.10 63 529 -21 235 756 7 79.72 641 306 321 822 142 122 623 201 432 99 -91 962 341 90 88 448 77.21 510 146 406 850 574 216 489 294 834 289 314 69.47 783 74.74 50.44 518 60.56 185 774 994 452 -7 777 99.55 415 444 489 682 23 717 460 566 540 980 882 667 231 33 790 771 58 724 363 977 781 425 981 897 220 571 990 -36 19 353 636 190 482 738 407 91 -22 284 704 830 850 739 690 834 295 197 279 743 869 255 723 203 339 -87 785 46 560 812 443 746 -23 256 -50 1000 22 193 630 0.39 989 5 369 103 156 819 9 22.51 55.73 508 595 49.84 -52 11.47 141 -86 998 693 367 75.65 793 522 90 666 60.91 648 389 618 33 82 633 534 34.95 137 14 -56 335 -55 15 494 132 845 371 347 -36 50.40 940 269 361 895 -66 -47 706 918 -36 668 536 206 772 155 387 941 933 805 16.61 307 402 442 697 93 172 573 564 557 215 966 600 385 916 881 191 366 627 601 290 1 655 293 948 108 630 59.95 156 662 452 -13 974 957 441 575 481 837 684 80.12 296 -73 959 410 -66 613 631 325 711 596 18 624 300 641 950 697 617 79 385 626 518 246 868 828 306 721 389 456 168 21.39 360 830 780 956 -46)
++ -14 297 23.78 674 328 135 531 777 23.67 45.13 519 579 0.11 286 510 -46 525 825 628 21.91 745 958 213 349 263 735 990 523 740 869 403 74 980 35.7 79.7 25.80 6.23 42.42 731 67.71 868 158 80.45 -1 52.61 400 86.72 694 67 82.66 124 990 39.73 294 332 41.58 496 42.80 386 363 59 25.21 846 830 766 761 30.0 32.36 14.6 753 -58 836 710 33.32 986 698 369 362 29 87.86 42.91 122 520 11.90 570 697 867 69.83 42.66 197 91 576 2.81 548 209 501 607 63.99 30.1 862 -24 84.47 26.24 12.21 92.88 6.86 407 893 423 860 508 791 385 748 -84 99.16 50.29 80.89 855 171 1 36.16 15.48 -11 897 91.79 623 485 611 362 67.23 815 979 310 67.32 309 298 447 941 4 -60 -41 320 733 71 534 327 89.16 51.95 359 665 475 30.99 430 629 606 33.43 86.62 347 5 17.75 85.56 882 787 655 36.39 705 253 -75 295 585 610 66.5 266 113 280 166 5 29.22 461 63 705 185 208 395 91 632 624 71.98 409 985 639 6.14 815 248 -9 840 -97 -74 940 190 491 -26 776 672 36.24 126 79.72 197 632 45.73 260 219 92.62 89.95 3.22 838 638 770 834 564 34.96
+(723 48 732 29.52 736 12 310 952 512 58 310 25.11 88.29 11.18 628 -10 60.80 234 779 455 61.33 461 -35 -5 571 684 447 513 641 890 957 392 510 41 34.55 815 -99 3 509 303 656 60 55.50 70.13 465 276 -45 712 555 834 212 192 79 -72 -45 239 173 872 507 274 67 446 73 999 978 573 813 743 255 -35 60.4 524 222 125 14.86 -10 -81 647 800 84.95 681 145 162 266 956 168 984 900 58 -51 826 900 41.90 274 799 674 680 830 823 298 584 852 470 67.76 79.90 -83 590 994 681 575 658 295 54 385 235 22 748 965 735 172 912 499 694 161 445 273 842 693 966 -86 -39 145 9.26 307 193 759 92 930 563 211 84.51 200 1.6 -97 813 679 803 -92 654 981 -57 0.30 408 436 883 920 288 154 728 -82 483 188 639 72.15 360 27 344 40 777 339 -16 -74 712 641 455 -32 790 117 559 310 928 599 -29 991 132 5 265 129 28.45 150 115 608 561 493 249 240 425 297 115 363 394 782 -6 841 766 880 17.85 690 787 882 110 842 667 949 64.82 467 81.17 107 75.98 290 -3 760 114 136 246 224)
+(97 791 227 327 509 581 418 -22 604 678 64.32 599 140 28 984 502 793 892 -29 49.52 899 217 239 901 159 83 55.78 143 114 446 495 266 589 27.96 958 73 667 23.18 358 148 599 647 297 248 7.28 466 3.57 120 961 558 256 259 38.41 418 303 -58 496 363 771 -43 969 822 174 702 299 146 236 121 829 593 15.37 118 72.60 864 791 750 307 337 720 46.43 21.40 -94 374 613 72.12 557 867 43.22 674 277 262 545 752 599 74.73 341 593 -96 813 438 569 975 328 431 460 764 8.39 352 387 734 882 475 417 837 465 565 224 -88 900 764 319 797 135 868 733 491 707 676 969 519 53 913 556 414 98.76 224 329 -26 660 956 573 270 743 556 -43 77.90 967 390 295 249 40 21.64 646 396 -2 371 802 141 880 56 885 -41 -76 1 71.13 956 6 291 -68 475 320 402 715 66.35 -79 390 246 351 316 134 351 748 92 155 -86 469 782 884 21.63 -41 140 -90 96.43 986 249 234 541 -28 196 -75 655 360 45 552 456 959 263 505 977 430 847 369 29.90 -32 243 912 40.37 77.67 706 678 72 415 500 877 855 718 549 498 792 162 250 926 561 82.96 43.30 265 311 13.34 -14 606 226 447 82 860 381 434 235 180 44.5 787 -45 738 55 829 696 427 245 31.47 657 161 87.83 415 658 296 462 976 885 -14 34 392 274 51.92 13.26 422 867 943 843 38 -11 224 786 -74 757 762 805 487 881 90 -58 368 837 474 177 2 295 98 342 137 705 205 106 974 79 470 -9 338 745 457 888 67 937 392 258 873 99.20 691 398 912 335 175 600 698 485 629 427 703 26 369 248 325 -91 68.76 998 728 577 492 439 981 82.99 531 268 258 6.62 998 63 485 956 896 988 362 365 272 23.45 579 749 476 89.59)
+(574 752 35.9 965 9.29 738 461 97.70 590 301 368 900 15 -74 584 60 991 84.9 460 389 878 378 512 138 334 736 378 436 525 629 778 146 299 887 727 1.39 588 409 129 97 745 795 277 19.68 356 65 1 203 138 452 -74 39 -14 3.74 98.16 291 13.19 0 848 246 851 -73 111 938 293 644 -47 395 350 588 646 -52 267 377 -32 108 401 417 54.99 -1 567 692 764 883 457 353 686 -28 204 469 221 807 122 959 91.94 92 106 186 258 449 125 906 -22 78.71 264 112 450 792 902 813 303 129 654 -35 659 752 280 460 681 388 916 537 757 276 76 246 100 574 180 471 28.77 193 644 330 764 734 154 215 238 920 694 66 87.1 851 268 173 -3 676 759 358 263 356 274 140 749 336 89 477 77 42 733 862 519 -18 863 72 480 259 -51 604 135 158 741 18.13 266 645 953 -89 9.53 -68 800 593 199 97 861 915 3 715 929 891 815 629 351 228 805 477 703 79 971 53 19.12 934 -79 103 728 200 223 492 74.96 144 -44 205 666 35.98 204 909 93 352 959 75 297 486 11.91 742 684 975 -47 612 56 4 512 5.90 227 824 702 411 485 371 -82 909)
++ 117 457 24.29 569 511 55.56 463 541 30.62 889 16.41 72 90.32 493 593 385 945 517 866 58.64 374 632 345 68.98 16.53 44.5 572 638 849 42 266 28.42 493 73.65 48.87 98 559 248 667 802 12.24 201 768 249 -8 591 48 284 75.94 54.19 67.30 319 -96 894 39.34 189 56.38 575 32.51 691 18.10 698 64.0 -99 706 558 26.25 34.33 660 39.67 96.11 993 72.56 37 31.63 93.98 451 81.12 219 376 -1 9.77 236 981 18.70 165 45.42 45.50 925 653 443 752 21.19 67.23 67 95 -66 58.8 487 795 42.31 488 55.42 16 0.96 66.2 4.81 833 624 71.59 30.26 663 68.90 -62 434 316 22.88 68.64 70.16 482 617 779 35.84 703 80.65 798 98 574 97.5 143 375 863 205 23.35 28.90 630 40.51 823 25.73 672 850 449 23.41 217 944 966 76.77 315 871 624 398 -81 19.40 20.24 28 702 771 365 335 464 813 83.49 26.36 44.84 776 -100 820 347 87.45 843 16.36 57.75 292 580
+* 46.97 -16 316 7.49 833 136 17.71 544 882 19.15 721 71.22 68.68 372 815 99.21 21.29 772 50.51 88.47 412 210 362 944 980 98.95 88.97 46.77 622 423 350 367 92.45 389 544 792 654 201 281 625 249 635 695 575 -9 -92 804 931 39.45 928 307 76.76 30 741 34.30 0.60 171 90.36 943 858 451 598 68.45 59.85 38 55.34 503 208 82.44 149 791 44.84 35.28 51.49 112 985 61 -3 799 49 66.32 947 519 72.36 665 23.44 239 253 324 647 -87 379 1.64 276 518 713 29.5 695 585 229 874 24.25 595 846 343 639 686 327 77.11 843 60.45 474 28.49 -93 18.4 75.56 175 698 48.39 94.26 322 663 870 801 868 10.5 42.15 85.21 834 118 51.99 357 310 633 780 35 167 444 570 -33 785 90.28 743 803 37.9 81.56 39.18 674 58 901 133 291 340 930 640 617 968 66.15 66.8 138 237 334 21.72 14.73 689 -91 577 96.97 571 893 455 79.1 918 139 77.21 25.73 738 886 329 154 883 16 938 971 161 13 624 30.65 502 94.20 758 32.61 188 37 -10 921 -3
+(297 97 903 399 217 -64 874 336 -86 890 123 985 915 993 18.78 55.63 -70 762 49.3 173 951 814 79.93 193 -17 948 136 531 3 -7 88 819 22 134 757 798 138 238 291 -69 101 51 87.30 887 275 572 917 897 -94 81.79 903 184 406 -18 90 -52 480 926 -17 402 477 597 297 -24 566 121 993 144 218 60 942 331 43.76 431 121 789 54.50 28.31 823 -71 540 925 592 580 106 505 62.61 -87 424 449 742 352 57.97 60 254 799 -22 185 458 935 318 890 202 -13 565 -27 559 906 103 112 798 161 -50 -92 452 887 679 757 357 -1 328 450 336 50.60 752 336 699 53 527 754 373 176 206 149 962 878 588 473 652 655 629 49 692 692 928 381 75 451 40 444 58 786 315 487 761 808 197 488 644 225 894 314 314 358 128 26.57 375 82 344 376 139 345 995 240 9 655 828 698 926 313 -30 855 771 29.21 998 117 80.35 -72 -12 855 402 298 -60 407 121 -62 653 25.33 26 196 247 65 -9 733 42.85 387 705 294 832 581 918 27 184 342 469 794 54.5 -97 -81 359 432 246 194 976 109 698 115 448 -47 181 640 162 314 89.48 580 838 771 14 245 -69 714 415 93 -56 34 122 -14 643 116 435 643 570 348 47 -45 850 322 123 47.84 816 551 909 66 167 65.41 596 640 10.71 84.85 667 408 853 934 915 218 69.2 28.56 12 377 308 -20 374 249 334 -8 41 68.77 491 645 221 -51 691 -60 207 196 469 55 108 907 21.80 605 850 175 671 -46)
+* 135 736 965 36.88 969 862 944 446 653 940 31 26.88 30.20 219 58 44 24.7 599 516 121 403 75 455 452 91.24 518 32.44 998 194 56.95 908 25.28 86.96 16.4 4 846 817 41.36 532 801 238 7.27 118 629 709 58.41 430 55.14 683 56.82 771 30.35 161 95.20 -78 32.82 430 710 84.85 38.17 737 81.28 -45 -37 80.4 46.6 884 52.25 92.86 277 55.49 440 -35 54.82 881 928 903 813 44 480 36.23 739 880 298 995 412 69.17 645 673 45 466 914 147 16 79.69 169 -90 43.80 67.88 573 113 988 662 48.86 32.84 41.33 86.36 96.0 595 67.63 2.10 452 232 36.81 321 205 31.8 854 91.70 84.16 917 156 20.29 -16 87.94 10.1 222 646 8.38 777 83.32 595 383 424 36.7 66.99 67 279 860 568 409 307 -78 295 -62 86 88.80 72.77 749 236 -91 514 -89 93.97 29.99 913 875 466 55.35 306 802 28.16 886 391 370 330 144 97.0 512 431 66.39 617 71.53 399 617 652 82.77 749 -11 81.77 239 972 20 669 72.66 36.94 647 747 22.36 69.6 924 24.57 653 -45 947 39.31 25.66 474 976 28.56 42.88 486 502 49 345 470 23 98.82 171 -22 524 68.31 87.80 90.24 31.83 8.2 857 886 712 983 881 150 593 717 414 11.62 226 -27 102 40.77 72.93 369 1.58
+(598 108 81 233 244 166 865 460 72.83 370 921 -85 567 524 -26 944 497 173 222 539 608 21 79 919 993 85 691 50.98 493 626 27 402 610 410 80.52 993 841 110 632 17.85 814 390 243 673 643 229 600 336 141 331 -34 53 51 518 -78 29.52 87 461 777 55.62 38 31 404 6.34 412 698 80 339 24.65 264 733 475 997 19.38 957 435 529 447 392 931 98.23 434 754 85 890 798 615 549 885 418 448 -52 658 495 27 663 612 910 129 92 181 153 -59 68.15 647 898 893 245 986 469 16.62 167 448 27 682 116 220 513 874 767 333 699 759 995 543 453 775 724 79.2 464 204 192 65 155 551 -3 -100 624 -93 130 493 5 988 848 387 606 725 397 510 4 831 329 589 513 506 6.52 182 242 280 724 468 61 276 529 566 95.71 -95 729 67 760 16.12 24 20.64 334 686 962 239)